@@ -0,0 +1,73 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * \brief Adds a benchmark function to the list run by max_benchmarks. Use through BENCHMARK().
+ */
+class BenchmarkRegistration {
+public:
+    BenchmarkRegistration(const char* name, void (*function)());
+};
+
+/**
+ * \brief Prints one result line of the running benchmark.
+ *
+ * \param format printf style format of the measurement, e.g. "%dx%d: %.1f frames/s".
+ */
+void Benchmark_Report(const char* format, ...);
+
+/**
+ * \brief Folds a value into a global sink so that the compiler cannot drop the work that produced it.
+ *
+ * \param value Any result of the measured work.
+ */
+void Benchmark_Consume(uint64_t value);
+
+/**
+ * \brief Runs a function repeatedly and measures the elapsed wall-clock time.
+ *
+ * \param iterations Number of calls.
+ * \param function Callable that performs one iteration of the measured work.
+ * \return Elapsed time in seconds.
+ */
+template <typename Function>
+double Benchmark_Measure(int32_t iterations, Function&& function) {
+    const auto start = std::chrono::steady_clock::now();
+
+    for (int32_t i = 0; i < iterations; ++i) {
+        function();
+    }
+
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+#define BENCHMARK(name)                                                                           \
+    static void Benchmark_##name();                                                               \
+    static const BenchmarkRegistration Benchmark_##name##_Registration(#name, &Benchmark_##name); \
+    static void Benchmark_##name()
+
+#endif /* BENCHMARK_HPP */
@@ -0,0 +1,79 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "benchmark.hpp"
+
+struct BenchmarkEntry {
+    const char* name;
+    void (*function)();
+};
+
+static std::vector<BenchmarkEntry>& Benchmark_GetEntries() {
+    static std::vector<BenchmarkEntry> entries;
+
+    return entries;
+}
+
+static const char* Benchmark_ActiveName;
+static volatile uint64_t Benchmark_Sink;
+
+BenchmarkRegistration::BenchmarkRegistration(const char* name, void (*function)()) {
+    Benchmark_GetEntries().push_back({name, function});
+}
+
+void Benchmark_Report(const char* format, ...) {
+    va_list args;
+
+    va_start(args, format);
+    std::printf("%-24s ", Benchmark_ActiveName);
+    std::vprintf(format, args);
+    std::printf("\n");
+    va_end(args);
+}
+
+void Benchmark_Consume(uint64_t value) { Benchmark_Sink = Benchmark_Sink + value; }
+
+int main(int argc, char** argv) {
+    const char* filter = (argc > 1) ? argv[1] : "";
+    int32_t count = 0;
+
+    for (const auto& entry : Benchmark_GetEntries()) {
+        if (std::strstr(entry.name, filter)) {
+            Benchmark_ActiveName = entry.name;
+            entry.function();
+            std::fflush(stdout);
+            ++count;
+        }
+    }
+
+    if (count == 0) {
+        std::fprintf(stderr, "No benchmark name contains \"%s\".\n", filter);
+
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,97 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "blitkernels.h"
+
+#include <vector>
+
+#include "benchmark.hpp"
+#include "blitreference.hpp"
+
+struct BlitSize {
+    int32_t width;
+    int32_t height;
+    int32_t iterations;
+};
+
+template <typename Reference, typename Kernel>
+static void BlitKernels_Compare(const char* name, const BlitSize& size, Reference&& reference, Kernel&& kernel) {
+    const double pixels = static_cast<double>(size.width) * size.height * size.iterations / 1000000.0;
+    const double reference_seconds = Benchmark_Measure(size.iterations, reference);
+    const double kernel_seconds = Benchmark_Measure(size.iterations, kernel);
+
+    Benchmark_Report("%-18s %4dx%-4d scalar %8.1f Mpixel/s, %s %8.1f Mpixel/s, speedup %.2f", name, size.width,
+                     size.height, pixels / reference_seconds, BlitKernels_GetInstructionSet(), pixels / kernel_seconds,
+                     reference_seconds / kernel_seconds);
+}
+
+BENCHMARK(BlitKernels) {
+    for (const auto& size : {BlitSize{64, 64, 5000}, BlitSize{640, 480, 100}, BlitSize{1920, 1080, 20}}) {
+        const int32_t pitch = size.width;
+        const int32_t length = size.height;
+        const auto source = MakePixels(pitch * length, 1, 30);
+        const auto mask = MakePixels(pitch * length, 2, 50);
+        auto target = MakePixels(pitch * length, 3, 0);
+        uint8_t color_table[256];
+
+        for (int32_t i = 0; i < 256; ++i) {
+            color_table[i] = static_cast<uint8_t>(255 - i);
+        }
+
+        BlitKernels_Compare(
+            "TransCopy", size,
+            [&]() { ReferenceTransCopy(source.data(), pitch, length, pitch, target.data(), pitch); },
+            [&]() { BlitKernels_TransCopy(source.data(), pitch, length, pitch, target.data(), pitch); });
+
+        BlitKernels_Compare(
+            "MaskTransCopy", size,
+            [&]() {
+                ReferenceMaskCopy(source.data(), pitch, length, pitch, mask.data(), pitch, target.data(), pitch, true);
+            },
+            [&]() {
+                BlitKernels_MaskTransCopy(source.data(), pitch, length, pitch, mask.data(), pitch, target.data(),
+                                          pitch);
+            });
+
+        BlitKernels_Compare(
+            "SwapColors", size, [&]() { ReferenceSwapColors(target.data(), pitch, length, pitch, 7, 0); },
+            [&]() { BlitKernels_SwapColors(target.data(), pitch, length, pitch, 7, 0); });
+
+        BlitKernels_Compare(
+            "Remap", size, [&]() { ReferenceRemap(target.data(), pitch, length, pitch, color_table); },
+            [&]() { BlitKernels_Remap(target.data(), pitch, length, pitch, color_table); });
+
+        for (const bool transparent : {false, true}) {
+            BlitKernels_Compare(
+                transparent ? "Scale transparent" : "Scale", size,
+                [&]() {
+                    ReferenceScale(source.data(), pitch / 2, length / 2, pitch, target.data(), pitch, length, pitch,
+                                   transparent);
+                },
+                [&]() {
+                    BlitKernels_Scale(source.data(), pitch / 2, length / 2, pitch, target.data(), pitch, length, pitch,
+                                      transparent);
+                });
+        }
+
+        Benchmark_Consume(target[target.size() / 2]);
+    }
+}
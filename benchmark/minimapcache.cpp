@@ -0,0 +1,103 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "minimapcache.hpp"
+
+#include <vector>
+
+#include "benchmark.hpp"
+#include "minimapreference.hpp"
+
+BENCHMARK(MinimapCache) {
+    constexpr int32_t map_size = 112;
+    constexpr int32_t target_size = 224;
+    constexpr int32_t frames = 2000;
+    constexpr int32_t unit_count = 400;
+    constexpr int32_t moving_units = 8;
+
+    std::vector<uint8_t> base(map_size * map_size);
+    std::vector<TestDot> dots;
+    std::vector<uint32_t> changed_cells;
+    uint32_t seed = 12345;
+
+    const auto random = [&seed](uint32_t range) {
+        seed = seed * 1103515245u + 12345u;
+
+        return (seed >> 8) % range;
+    };
+
+    for (auto& color : base) {
+        color = static_cast<uint8_t>(16 + random(64));
+    }
+
+    for (int32_t i = 0; i < unit_count; ++i) {
+        dots.push_back({static_cast<int32_t>(random(map_size)), static_cast<int32_t>(random(map_size)),
+                        static_cast<int32_t>(1 + random(2)), static_cast<uint8_t>(1 + random(4))});
+    }
+
+    /* a typical frame moves a few units by one cell and uncovers a few cells of the fog of war */
+    const auto advance = [&]() {
+        for (int32_t i = 0; i < moving_units; ++i) {
+            auto& dot = dots[random(unit_count)];
+
+            dot.grid_x = (dot.grid_x + 1) % map_size;
+        }
+
+        changed_cells.clear();
+
+        for (int32_t i = 0; i < 4; ++i) {
+            const uint32_t cell = random(base.size());
+
+            base[cell] ^= 0x80;
+            changed_cells.push_back(cell);
+        }
+    };
+
+    const double reference_seconds = Benchmark_Measure(frames, [&]() {
+        advance();
+        Benchmark_Consume(ReferenceMinimap(base, dots, map_size, map_size, target_size, target_size)[0]);
+    });
+
+    MinimapCache cache;
+
+    cache.Configure(map_size, map_size, target_size, target_size);
+
+    const double cache_seconds = Benchmark_Measure(frames, [&]() {
+        advance();
+
+        for (const uint32_t cell : changed_cells) {
+            cache.InvalidateCell(cell);
+        }
+
+        cache.ClearUnitDots();
+
+        for (const auto& dot : dots) {
+            cache.AddUnitDot(dot.grid_x, dot.grid_y, dot.size, dot.color);
+        }
+
+        cache.Compose(base.data());
+        Benchmark_Consume(cache.GetPixels()[0]);
+    });
+
+    Benchmark_Report("%dx%d map, %d units: full redraw %.0f frames/s, layered cache %.0f frames/s", map_size, map_size,
+                     unit_count, frames / reference_seconds, frames / cache_seconds);
+    Benchmark_Report("redrawn cells per frame %.1f", static_cast<double>(cache.GetStatistics().redrawn_cells) / frames);
+}
@@ -0,0 +1,54 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "pixelconvert.hpp"
+
+#include <utility>
+#include <vector>
+
+#include "benchmark.hpp"
+
+BENCHMARK(PixelConvert) {
+    std::vector<uint32_t> color_table(256);
+
+    for (uint32_t i = 0; i < color_table.size(); ++i) {
+        color_table[i] = 0xFF000000 | ((i * 0x010203) ^ (i << 17));
+    }
+
+    for (const auto& [width, height] : {std::pair{640, 480}, std::pair{1920, 1080}}) {
+        constexpr int32_t frames = 200;
+
+        std::vector<uint8_t> source(width * height);
+        std::vector<uint32_t> target(width * height);
+
+        for (size_t i = 0; i < source.size(); ++i) {
+            source[i] = static_cast<uint8_t>(i * 31 + 7);
+        }
+
+        const double seconds = Benchmark_Measure(frames, [&]() {
+            PixelConvert_Index8ToRgb32(source.data(), width, target.data(), width * sizeof(uint32_t), width, height,
+                                       color_table.data());
+            Benchmark_Consume(target[target.size() / 2]);
+        });
+
+        Benchmark_Report("%dx%d: %.1f full-screen blits/s", width, height, frames / seconds);
+    }
+}
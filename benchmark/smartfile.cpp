@@ -0,0 +1,215 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "smartfile.hpp"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "point.hpp"
+#include "registerarray.hpp"
+
+static uint32_t BenchmarkObject_TypeIndex;
+
+/* stands in for the small game objects of a save file, a handful of members saved one by one */
+class BenchmarkObject : public FileObject {
+    int16_t hits{0};
+    uint32_t id{0};
+    Point position;
+
+public:
+    BenchmarkObject() noexcept = default;
+    ~BenchmarkObject() noexcept = default;
+
+    static FileObject* Allocate() noexcept { return new (std::nothrow) BenchmarkObject(); }
+
+    [[nodiscard]] uint32_t GetTypeIndex() const override { return BenchmarkObject_TypeIndex; }
+    void FileLoad(SmartFileReader& file) noexcept override {
+        file.Read(hits);
+        file.Read(id);
+        file.Read(position);
+    }
+    void FileSave(SmartFileWriter& file) noexcept override {
+        file.Write(hits);
+        file.Write(id);
+        file.Write(position);
+    }
+
+    void Set(int16_t _hits, uint32_t _id, const Point& _position) {
+        hits = _hits;
+        id = _id;
+        position = _position;
+    }
+};
+
+static RegisterClass BenchmarkObject_ClassRegister("BenchmarkObject", &BenchmarkObject_TypeIndex,
+                                                   &BenchmarkObject::Allocate);
+
+static std::string SmartFile_GetBenchmarkPath() {
+    return (std::filesystem::temp_directory_path() / "max_benchmark.dat").string();
+}
+
+BENCHMARK(SmartFileLateGameSave) {
+    constexpr uint32_t map_cell_count = 112 * 112;
+    constexpr uint32_t heat_map_count = 4;
+    constexpr uint32_t object_count = 4000;
+    constexpr int32_t iterations = 20;
+    const std::string path = SmartFile_GetBenchmarkPath();
+    const uint16_t formats[] = {static_cast<uint16_t>(SmartFileFormat::V71),
+                                static_cast<uint16_t>(SmartFileFormat::V72)};
+
+    /* per cell arrays of a late game, heat maps are counters that are zero outside scan ranges */
+    std::vector<uint8_t> surface_map(map_cell_count);
+    std::vector<uint16_t> cargo_map(map_cell_count);
+    std::vector<uint32_t> heat_maps(heat_map_count * map_cell_count * 3);
+    std::vector<SmartPointer<BenchmarkObject>> objects;
+    uint32_t seed = 4242;
+
+    for (uint32_t i = 0; i < map_cell_count; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        surface_map[i] = static_cast<uint8_t>(1 << (((i / 112) / 28 + (i % 112) / 37 + (seed >> 30)) % 4));
+        cargo_map[i] = (seed >> 20) % 10 == 0 ? static_cast<uint16_t>((seed >> 8) % 24) : 0;
+    }
+
+    for (size_t i = 0; i < heat_maps.size(); ++i) {
+        const uint32_t cell = static_cast<uint32_t>(i / 3) % map_cell_count;
+
+        heat_maps[i] = ((cell / 112) % 16 < 6 && (cell % 112) % 20 < 9) ? (cell % 5) + 1 : 0;
+    }
+
+    for (uint32_t i = 0; i < object_count; ++i) {
+        objects.emplace_back(dynamic_cast<BenchmarkObject*>(BenchmarkObject::Allocate()));
+        seed = seed * 1103515245u + 12345u;
+        objects.back()->Set(static_cast<int16_t>(seed >> 16), i,
+                            Point(static_cast<int32_t>(seed % 112), static_cast<int32_t>((seed >> 8) % 112)));
+    }
+
+    for (const uint16_t format : formats) {
+        bool success = true;
+
+        const double save_seconds = Benchmark_Measure(iterations, [&]() {
+            SmartFileWriter writer;
+
+            success &= writer.Open(path);
+            success &= writer.SetFormat(format);
+            success &= writer.Write(surface_map.data(), surface_map.size());
+            success &= writer.Write(cargo_map.data(), cargo_map.size() * sizeof(uint16_t));
+            writer.WriteObjectCount(object_count);
+
+            for (auto& object : objects) {
+                writer.WriteObject(object.Get());
+            }
+
+            success &= writer.Write(heat_maps.data(), heat_maps.size() * sizeof(uint32_t));
+            success &= writer.Close();
+        });
+
+        const double load_seconds = Benchmark_Measure(iterations, [&]() {
+            SmartFileReader reader;
+
+            success &= reader.Open(path);
+            success &= reader.Read(surface_map.data(), surface_map.size());
+            success &= reader.Read(cargo_map.data(), cargo_map.size() * sizeof(uint16_t));
+            success &= reader.ReadObjectCount() == object_count;
+
+            for (uint32_t i = 0; i < object_count; ++i) {
+                SmartPointer<FileObject> object(reader.ReadObject());
+
+                success &= object.Get() != nullptr;
+            }
+
+            success &= reader.Read(heat_maps.data(), heat_maps.size() * sizeof(uint32_t));
+            success &= reader.Close();
+        });
+
+        if (!success) {
+            Benchmark_Report("format %u: save or load failed", format);
+
+            continue;
+        }
+
+        Benchmark_Report("format %u: save %.2f ms, load %.2f ms, %llu bytes", format,
+                         save_seconds * 1000.0 / iterations, load_seconds * 1000.0 / iterations,
+                         static_cast<unsigned long long>(std::filesystem::file_size(path)));
+    }
+
+    std::filesystem::remove(path);
+}
+
+BENCHMARK(SmartFileFieldByField) {
+    constexpr uint32_t unit_count = 20000;
+    constexpr uint32_t field_count = 64;
+    const std::string path = SmartFile_GetBenchmarkPath();
+    const uint16_t formats[] = {static_cast<uint16_t>(SmartFileFormat::V71),
+                                static_cast<uint16_t>(SmartFileFormat::V72)};
+
+    /* unit objects save dozens of small members each, one call per member */
+    for (const uint16_t format : formats) {
+        bool success = true;
+
+        const double save_seconds = Benchmark_Measure(1, [&]() {
+            SmartFileWriter writer;
+
+            success &= writer.Open(path);
+            success &= writer.SetFormat(format);
+
+            for (uint32_t i = 0; i < unit_count; ++i) {
+                for (uint32_t j = 0; j < field_count; j += 2) {
+                    success &= writer.Write(static_cast<uint16_t>(i + j));
+                    success &= writer.Write(i * j);
+                }
+            }
+
+            success &= writer.Close();
+        });
+
+        const double load_seconds = Benchmark_Measure(1, [&]() {
+            SmartFileReader reader;
+
+            success &= reader.Open(path);
+
+            for (uint32_t i = 0; i < unit_count; ++i) {
+                for (uint32_t j = 0; j < field_count; j += 2) {
+                    uint16_t small_field;
+                    uint32_t large_field;
+
+                    success &= reader.Read(small_field) && small_field == static_cast<uint16_t>(i + j);
+                    success &= reader.Read(large_field) && large_field == i * j;
+                }
+            }
+
+            success &= reader.Close();
+        });
+
+        if (!success) {
+            Benchmark_Report("format %u: save or load failed", format);
+
+            continue;
+        }
+
+        Benchmark_Report("format %u, %u fields: save %.2f ms, load %.2f ms", format, unit_count * field_count,
+                         save_seconds * 1000.0, load_seconds * 1000.0);
+    }
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,81 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "textruncache.hpp"
+
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "textrunreference.hpp"
+
+BENCHMARK(TextRunCache) {
+    constexpr int32_t pitch = 640;
+    constexpr int32_t height = 480;
+    constexpr int32_t line_height = 24;
+    constexpr int32_t width_limit = 600;
+    constexpr int32_t string_count = 300;
+    constexpr int32_t frames = 200;
+
+    const TestFont font = MakeTestFont(7);
+    std::vector<std::string> strings;
+    std::vector<uint8_t> frame(pitch * height, 0);
+
+    for (int32_t i = 0; i < string_count; ++i) {
+        strings.push_back(MakeTestString(i, 8 + i % 32));
+    }
+
+    /* every frame redraws the same interface text, the lines wrap around the frame */
+    const auto line_origin = [&](int32_t index) {
+        return &frame[((index * line_height) % (height - line_height) + 2) * pitch + 2];
+    };
+
+    const double reference_seconds = Benchmark_Measure(frames, [&]() {
+        for (int32_t i = 0; i < string_count; ++i) {
+            ReferenceBlit(font, strings[i], line_origin(i), width_limit, pitch, 0x55);
+        }
+
+        Benchmark_Consume(frame[pitch * 4]);
+    });
+
+    TextRunCache cache(1024 * 1024);
+
+    const double cache_seconds = Benchmark_Measure(frames, [&]() {
+        for (int32_t i = 0; i < string_count; ++i) {
+            const TextRun* run = cache.Find(0, width_limit, strings[i]);
+
+            if (!run) {
+                run = &cache.Insert(0, width_limit, strings[i], RenderTestRun(font, strings[i], width_limit));
+            }
+
+            TextRun_Blit(*run, line_origin(i), pitch, 0x55);
+        }
+
+        Benchmark_Consume(frame[pitch * 4]);
+    });
+
+    const auto& statistics = cache.GetStatistics();
+
+    Benchmark_Report("%d strings per frame: glyph loop %.0f frames/s, text run cache %.0f frames/s", string_count,
+                     frames / reference_seconds, frames / cache_seconds);
+    Benchmark_Report("cache hits %llu, misses %llu", static_cast<unsigned long long>(statistics.hits),
+                     static_cast<unsigned long long>(statistics.misses));
+}
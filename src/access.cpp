@@ -21,11 +21,14 @@
 
 #include "access.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cstdlib>
 
 #include "ai.hpp"
 #include "ailog.hpp"
 #include "buildmenu.hpp"
+#include "drawmap.hpp"
 #include "game_manager.hpp"
 #include "hash.hpp"
 #include "heatmap.hpp"
@@ -550,6 +553,7 @@ uint32_t Access_OnCellRevealed(const UnitInfo* unit, int32_t grid_x, int32_t gri
 
     if (team == GameManager_PlayerTeam) {
         ResourceManager_MinimapFov[map_offset] = ResourceManager_Minimap[map_offset];
+        DrawMap_InvalidateMinimapCell(map_offset);
     }
 
     // Spot all units at this cell
@@ -584,6 +588,7 @@ void Access_OnCellHidden(const UnitInfo* unit, int32_t grid_x, int32_t grid_y) {
     if (team == GameManager_PlayerTeam) {
         ResourceManager_MinimapFov[map_offset] =
             ResourceManager_DarkeningColorIndexTable[ResourceManager_Minimap[map_offset]];
+        DrawMap_InvalidateMinimapCell(map_offset);
     }
 
     const auto units = Hash_MapHash[Point(grid_x, grid_y)];
@@ -608,86 +613,46 @@ void Access_OnCellHidden(const UnitInfo* unit, int32_t grid_x, int32_t grid_y) {
     }
 }
 
-void Access_OnSeaStealthRevealed(const UnitInfo* unit, int32_t grid_x, int32_t grid_y) {
+uint32_t Access_OnSeaStealthRevealed(const UnitInfo* unit, int32_t grid_x, int32_t grid_y) {
     const uint16_t team = unit->team;
     const auto units = Hash_MapHash[Point(grid_x, grid_y)];
+    uint32_t revealed_target_class = TARGET_CLASS_NONE;
 
     if (units) {
         // the end node must be cached in case Hash_MapHash.Remove() deletes the list
         for (auto it = units->Begin(), it_end = units->End(); it != it_end; ++it) {
             if (UnitsManager_IsUnitUnderWater(it->Get())) {
                 (*it).SpotByTeam(team);
+
+                if ((*it).team != team) {
+                    revealed_target_class |= Access_GetAttackTargetGroup(it->Get());
+                }
             }
         }
     }
+
+    return revealed_target_class;
 }
 
-void Access_OnLandStealthRevealed(const UnitInfo* unit, int32_t grid_x, int32_t grid_y) {
+uint32_t Access_OnLandStealthRevealed(const UnitInfo* unit, int32_t grid_x, int32_t grid_y) {
     const uint16_t team = unit->team;
     const auto units = Hash_MapHash[Point(grid_x, grid_y)];
+    uint32_t revealed_target_class = TARGET_CLASS_NONE;
 
     if (units) {
         // the end node must be cached in case Hash_MapHash.Remove() deletes the list
         for (auto it = units->Begin(), it_end = units->End(); it != it_end; ++it) {
             if ((*it).GetUnitType() == COMMANDO) {
                 (*it).SpotByTeam(team);
-            }
-        }
-    }
-}
-
-uint32_t Access_UpdateMapStatusAddUnit(UnitInfo* unit, int32_t grid_x, int32_t grid_y) {
-    uint32_t result = TARGET_CLASS_NONE;
-    const uint16_t team = unit->team;
-    HeatMap* heat_map = UnitsManager_TeamInfo[team].heat_map.get();
-
-    // Check stealth states before Add() to detect transitions for target class accumulation. The complete map needs no
-    // such flag: its transition spans a per-unit visibility change that only the reveal callout can observe, so that
-    // accumulation happens inside Access_OnCellRevealed() and arrives through revealed_target_class.
-    const bool sea_stealth_was_zero = (heat_map->GetStealthSea(grid_x, grid_y) == 0);
-    const bool land_stealth_was_zero = (heat_map->GetStealthLand(grid_x, grid_y) == 0);
-    uint32_t revealed_target_class = TARGET_CLASS_NONE;
-
-    // Add() handles all increment logic and invokes callouts for side effects
-    heat_map->Add(unit, grid_x, grid_y, &revealed_target_class);
-
-    // Accumulate target classes for sea stealth transition (callout already spotted units)
-    if (unit->GetUnitType() == CORVETTE && sea_stealth_was_zero) {
-        const auto units = Hash_MapHash[Point(grid_x, grid_y)];
-
-        if (units) {
-            for (auto it = units->Begin(), it_end = units->End(); it != it_end; ++it) {
-                if (UnitsManager_IsUnitUnderWater(it->Get()) && unit->team != (*it).team) {
-                    result |= Access_GetAttackTargetGroup(it->Get());
-                }
-            }
-        }
-    }
-
-    // Accumulate target classes for land stealth transition (callout already spotted units)
-    if ((unit->GetUnitType() == COMMANDO || unit->GetUnitType() == INFANTRY) && land_stealth_was_zero) {
-        const auto units = Hash_MapHash[Point(grid_x, grid_y)];
 
-        if (units) {
-            for (auto it = units->Begin(), it_end = units->End(); it != it_end; ++it) {
-                if ((*it).GetUnitType() == COMMANDO && unit->team != (*it).team) {
-                    result |= Access_GetAttackTargetGroup(it->Get());
+                if ((*it).team != team) {
+                    revealed_target_class |= Access_GetAttackTargetGroup(it->Get());
                 }
             }
         }
     }
 
-    // Target classes for the complete map transition, accumulated by the reveal callout for the units it uncovered
-    result |= revealed_target_class;
-
-    return result;
-}
-
-void Access_UpdateMapStatusRemoveUnit(UnitInfo* unit, int32_t grid_x, int32_t grid_y) {
-    HeatMap* heat_map = UnitsManager_TeamInfo[unit->team].heat_map.get();
-
-    // Remove() handles all decrement logic and invokes callouts for side effects
-    heat_map->Remove(unit, grid_x, grid_y);
+    return revealed_target_class;
 }
 
 void Access_DrawUnit(UnitInfo* unit) {
@@ -761,11 +726,65 @@ uint32_t Access_GetTargetClass(UnitInfo* unit) {
     return result;
 }
 
+static int32_t Access_GetScanRadius(UnitInfo* unit) {
+    return (unit->GetOrder() == ORDER_DISABLE) ? 0 : unit->GetBaseValues()->GetAttribute(ATTRIB_SCAN);
+}
+
+static bool Access_IsScanDiscOnHeatMap(UnitInfo* unit) {
+    return unit->GetOrder() != ORDER_DISABLE && !GameManager_AllVisible && unit->GetOrder() != ORDER_IDLE &&
+           (unit->flags & SELECTABLE) && UnitsManager_TeamInfo[unit->team].team_type != TEAM_TYPE_NONE;
+}
+
+static bool Access_IsSurveyingUnit(UnitInfo* unit) {
+    return unit->GetUnitType() == SURVEYOR || unit->GetUnitType() == MINELAYR || unit->GetUnitType() == SEAMNLYR ||
+           unit->GetUnitType() == COMMANDO;
+}
+
+static void Access_StopOnEnemyContact(UnitInfo* unit, uint32_t enemy_target_class) {
+    if (enemy_target_class != TARGET_CLASS_NONE &&
+        (UnitsManager_TeamInfo[unit->team].team_type == TEAM_TYPE_PLAYER ||
+         UnitsManager_TeamInfo[unit->team].team_type == TEAM_TYPE_COMPUTER) &&
+        unit->GetOrder() != ORDER_AWAIT && ResourceManager_GetSettings()->GetNumericValue("enemy_halt")) {
+        uint32_t friendly_target_class = Access_GetTargetClass(unit);
+
+        if (unit->GetUnitList()) {
+            for (auto it = unit->GetUnitList()->Begin(), it_end = unit->GetUnitList()->End(); it != it_end; ++it) {
+                friendly_target_class |= Access_GetTargetClass(it->Get());
+            }
+        }
+
+        if (friendly_target_class & enemy_target_class) {
+            AILOG(log, "Access: {} at [{},{}] spotted enemies",
+                  ResourceManager_GetUnit(unit->GetUnitType()).GetSingularName().data(), unit->grid_x + 1,
+                  unit->grid_y + 1);
+
+            if (unit->GetUnitList()) {
+                for (auto it = unit->GetUnitList()->Begin(), it_end = unit->GetUnitList()->End(); it != it_end; ++it) {
+                    UnitEventEmergencyStop* unit_event = new (std::nothrow) UnitEventEmergencyStop(it->Get());
+
+                    UnitEvent_UnitEvents.PushBack(*unit_event);
+
+                    if (Remote_IsNetworkGame) {
+                        Remote_SendNetPacket_50(it->Get());
+                    }
+                }
+
+            } else {
+                UnitEventEmergencyStop* unit_event = new (std::nothrow) UnitEventEmergencyStop(unit);
+
+                UnitEvent_UnitEvents.PushBack(*unit_event);
+
+                if (Remote_IsNetworkGame) {
+                    Remote_SendNetPacket_50(unit);
+                }
+            }
+        }
+    }
+}
+
 void Access_UpdateMapStatus(UnitInfo* unit, bool mode) {
     if (unit->GetOrder() != ORDER_DISABLE) {
-        if ((unit->GetUnitType() == SURVEYOR || unit->GetUnitType() == MINELAYR || unit->GetUnitType() == SEAMNLYR ||
-             unit->GetUnitType() == COMMANDO) &&
-            mode) {
+        if (Access_IsSurveyingUnit(unit) && mode) {
             Survey_SurveyArea(unit, 1);
         }
 
@@ -787,90 +806,58 @@ void Access_UpdateMapStatus(UnitInfo* unit, bool mode) {
             }
 
             if ((unit->flags & SELECTABLE) && UnitsManager_TeamInfo[unit->team].team_type != TEAM_TYPE_NONE) {
+                HeatMap* heat_map = UnitsManager_TeamInfo[unit->team].heat_map.get();
                 uint32_t enemy_target_class = TARGET_CLASS_NONE;
-                int32_t scan = unit->GetBaseValues()->GetAttribute(ATTRIB_SCAN);
-                Rect zone;
-
-                if (unit->GetOrder() == ORDER_DISABLE) {
-                    scan = 0;
-                }
-
-                rect_init(&zone, unit->grid_x - scan, unit->grid_y - scan, unit->grid_x + scan, unit->grid_y + scan);
+                const int32_t scan = Access_GetScanRadius(unit);
 
-                if (zone.ulx < 0) {
-                    zone.ulx = 0;
-                }
-
-                if (zone.uly < 0) {
-                    zone.uly = 0;
-                }
-
-                if (zone.lrx > ResourceManager_MapSize.x - 1) {
-                    zone.lrx = ResourceManager_MapSize.x - 1;
-                }
+                // the heat map callouts spot the uncovered units and report the target classes of the enemies found
+                if (mode) {
+                    enemy_target_class = heat_map->AddDisc(unit, unit->grid_x, unit->grid_y, scan);
 
-                if (zone.lry > ResourceManager_MapSize.y - 1) {
-                    zone.lry = ResourceManager_MapSize.y - 1;
+                } else {
+                    heat_map->RemoveDisc(unit, unit->grid_x, unit->grid_y, scan);
                 }
 
-                for (int32_t grid_y = zone.uly; grid_y <= zone.lry; ++grid_y) {
-                    for (int32_t grid_x = zone.ulx; grid_x <= zone.lrx; ++grid_x) {
-                        if (Access_IsWithinScanRange(unit, grid_x, grid_y, scan)) {
-                            if (mode) {
-                                enemy_target_class |= Access_UpdateMapStatusAddUnit(unit, grid_x, grid_y);
-
-                            } else {
-                                Access_UpdateMapStatusRemoveUnit(unit, grid_x, grid_y);
-                            }
-                        }
-                    }
-                }
+                Access_StopOnEnemyContact(unit, enemy_target_class);
+            }
+        }
+    }
+}
 
-                if (enemy_target_class != TARGET_CLASS_NONE &&
-                    (UnitsManager_TeamInfo[unit->team].team_type == TEAM_TYPE_PLAYER ||
-                     UnitsManager_TeamInfo[unit->team].team_type == TEAM_TYPE_COMPUTER) &&
-                    unit->GetOrder() != ORDER_AWAIT && ResourceManager_GetSettings()->GetNumericValue("enemy_halt")) {
-                    uint32_t friendly_target_class = Access_GetTargetClass(unit);
+void Access_UpdateMapStatusMove(UnitInfo* unit, UnitInfo* unit_copy) {
+    const int32_t step_x = unit->grid_x - unit_copy->grid_x;
+    const int32_t step_y = unit->grid_y - unit_copy->grid_y;
 
-                    if (unit->GetUnitList()) {
-                        for (auto it = unit->GetUnitList()->Begin(), it_end = unit->GetUnitList()->End(); it != it_end;
-                             ++it) {
-                            friendly_target_class |= Access_GetTargetClass(it->Get());
-                        }
-                    }
+    // the delta covers the common single step move of a unit whose scan disc is otherwise unchanged, anything else
+    // takes the full remove and add path
+    if (std::abs(step_x) > 1 || std::abs(step_y) > 1 || unit->team != unit_copy->team ||
+        unit->GetUnitType() != unit_copy->GetUnitType() || !Access_IsScanDiscOnHeatMap(unit) ||
+        !Access_IsScanDiscOnHeatMap(unit_copy) || Access_GetScanRadius(unit) != Access_GetScanRadius(unit_copy)) {
+        Access_UpdateMapStatus(unit, true);
+        Access_UpdateMapStatus(unit_copy, false);
 
-                    if (friendly_target_class & enemy_target_class) {
-                        AILOG(log, "Access: {} at [{},{}] spotted enemies",
-                              ResourceManager_GetUnit(unit->GetUnitType()).GetSingularName().data(), unit->grid_x + 1,
-                              unit->grid_y + 1);
+        return;
+    }
 
-                        if (unit->GetUnitList()) {
-                            for (auto it = unit->GetUnitList()->Begin(), it_end = unit->GetUnitList()->End();
-                                 it != it_end; ++it) {
-                                UnitEventEmergencyStop* unit_event =
-                                    new (std::nothrow) UnitEventEmergencyStop(it->Get());
+    HeatMap* heat_map = UnitsManager_TeamInfo[unit->team].heat_map.get();
+    const int32_t scan = Access_GetScanRadius(unit);
 
-                                UnitEvent_UnitEvents.PushBack(*unit_event);
+    if (Access_IsSurveyingUnit(unit)) {
+        Survey_SurveyArea(unit, 1);
+    }
 
-                                if (Remote_IsNetworkGame) {
-                                    Remote_SendNetPacket_50(it->Get());
-                                }
-                            }
+    Access_DrawUnit(unit);
 
-                        } else {
-                            UnitEventEmergencyStop* unit_event = new (std::nothrow) UnitEventEmergencyStop(unit);
+    const uint32_t enemy_target_class =
+        heat_map->AddDiscDelta(unit, unit_copy->grid_x, unit_copy->grid_y, unit->grid_x, unit->grid_y, scan);
 
-                            UnitEvent_UnitEvents.PushBack(*unit_event);
+    Access_StopOnEnemyContact(unit, enemy_target_class);
 
-                            if (Remote_IsNetworkGame) {
-                                Remote_SendNetPacket_50(unit);
-                            }
-                        }
-                    }
-                }
-            }
-        }
+    for (int32_t team = PLAYER_TEAM_GRAY; team >= PLAYER_TEAM_RED; --team) {
+        unit_copy->Draw(team);
     }
+
+    heat_map->RemoveDiscDelta(unit_copy, unit_copy->grid_x, unit_copy->grid_y, unit->grid_x, unit->grid_y, scan);
 }
 
 void Access_UpdateUnitVisibilityStatus(SmartList<UnitInfo>& units) {
@@ -897,15 +884,29 @@ void Access_UpdateVisibilityStatus(bool all_visible, bool reset_visibility) {
 
 void Access_UpdateMinimapFogOfWar(uint16_t team, bool all_visible, bool ignore_team_heat_map) {
     const uint32_t map_cell_count{static_cast<uint32_t>(ResourceManager_MapSize.x * ResourceManager_MapSize.y)};
-
-    memcpy(ResourceManager_MinimapFov, ResourceManager_Minimap, map_cell_count);
+    const VisibilityBitset::Word* words = nullptr;
 
     if (!all_visible && UnitsManager_TeamInfo[team].heat_map) {
-        const auto& cells = UnitsManager_TeamInfo[team].heat_map->GetCells();
+        words = UnitsManager_TeamInfo[team].heat_map->GetVisibility().GetWords();
+    }
+
+    // only cells whose fog state flips are written and reported, so the minimap cache redraws just those cells
+    for (uint32_t first = 0; first < map_cell_count; first += VisibilityBitset::WORD_BITS) {
+        VisibilityBitset::Word word = ~VisibilityBitset::Word{0};
+        const uint32_t last = std::min<uint32_t>(first + VisibilityBitset::WORD_BITS, map_cell_count);
+
+        if (words) {
+            word = ignore_team_heat_map ? 0 : words[first / VisibilityBitset::WORD_BITS];
+        }
+
+        for (uint32_t i = first; i < last; ++i) {
+            const uint8_t color = ((word >> (i - first)) & 1)
+                                      ? ResourceManager_Minimap[i]
+                                      : ResourceManager_DarkeningColorIndexTable[ResourceManager_Minimap[i]];
 
-        for (uint32_t i = 0; i < map_cell_count; ++i) {
-            if (cells[i].complete == 0 || ignore_team_heat_map) {
-                ResourceManager_MinimapFov[i] = ResourceManager_DarkeningColorIndexTable[ResourceManager_MinimapFov[i]];
+            if (ResourceManager_MinimapFov[i] != color) {
+                ResourceManager_MinimapFov[i] = color;
+                DrawMap_InvalidateMinimapCell(i);
             }
         }
     }
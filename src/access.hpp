@@ -46,11 +46,10 @@ bool Access_FindReachableSpot(ResourceID unit_type, UnitInfo* unit, int16_t* gri
                               int32_t exclusion_zone, int32_t mode);
 uint32_t Access_GetAttackTargetGroup(UnitInfo* unit);
 bool Access_IsVisibleOnHeatMap(UnitInfo* const unit, const uint16_t team);
-uint32_t Access_UpdateMapStatusAddUnit(UnitInfo* unit, int32_t grid_x, int32_t grid_y);
-void Access_UpdateMapStatusRemoveUnit(UnitInfo* unit, int32_t grid_x, int32_t grid_y);
 void Access_DrawUnit(UnitInfo* unit);
 uint32_t Access_GetTargetClass(UnitInfo* unit);
 void Access_UpdateMapStatus(UnitInfo* unit, bool mode);
+void Access_UpdateMapStatusMove(UnitInfo* unit, UnitInfo* unit_copy);
 void Access_UpdateUnitVisibilityStatus(SmartList<UnitInfo>& units);
 void Access_UpdateVisibilityStatus(bool all_visible, bool reset_visibility = true);
 void Access_UpdateMinimapFogOfWar(uint16_t team, bool all_visible, bool ignore_team_scan_map = false);
@@ -105,7 +104,7 @@ bool Access_IsInsideBounds(Rect* bounds, Point* point);
 // Heat map transition callout functions for use by HeatMap class
 uint32_t Access_OnCellRevealed(const UnitInfo* unit, int32_t grid_x, int32_t grid_y);
 void Access_OnCellHidden(const UnitInfo* unit, int32_t grid_x, int32_t grid_y);
-void Access_OnSeaStealthRevealed(const UnitInfo* unit, int32_t grid_x, int32_t grid_y);
-void Access_OnLandStealthRevealed(const UnitInfo* unit, int32_t grid_x, int32_t grid_y);
+uint32_t Access_OnSeaStealthRevealed(const UnitInfo* unit, int32_t grid_x, int32_t grid_y);
+uint32_t Access_OnLandStealthRevealed(const UnitInfo* unit, int32_t grid_x, int32_t grid_y);
 
 #endif /* ACCESS_HPP */
@@ -259,8 +259,7 @@ bool AirPath::Execute(UnitInfo* unit) {
 
             } else {
                 if (grid_x || grid_y) {
-                    Access_UpdateMapStatus(unit, true);
-                    Access_UpdateMapStatus(&*target_unit, false);
+                    Access_UpdateMapStatusMove(unit, &*target_unit);
 
                     if (GameManager_SelectedUnit == unit && m_length == 1) {
                         ResourceManager_GetSoundManager().PlaySfx(unit, Unit::SFX_TYPE_STOP);
@@ -0,0 +1,170 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "bandrenderer.hpp"
+
+#include <SDL3/SDL.h>
+
+#include <algorithm>
+#include <new>
+
+BandRenderer::BandRenderer()
+    : m_worker_count(0),
+      m_done(nullptr),
+      m_exit_requested(false),
+      m_function(nullptr),
+      m_band_count(0),
+      m_next_band(0) {}
+
+BandRenderer::~BandRenderer() { Stop(); }
+
+bool BandRenderer::Start(uint32_t worker_count) {
+    Stop();
+
+    if (worker_count == 0) {
+        return true;
+    }
+
+    m_done = SDL_CreateSemaphore(0);
+
+    if (!m_done) {
+        return false;
+    }
+
+    m_workers.reset(new (std::nothrow) Worker[worker_count]);
+
+    if (!m_workers) {
+        return false;
+    }
+
+    m_exit_requested.store(false, std::memory_order_release);
+
+    for (uint32_t i = 0; i < worker_count; ++i) {
+        Worker& worker = m_workers[i];
+
+        worker.owner = this;
+        worker.thread = nullptr;
+        worker.start = SDL_CreateSemaphore(0);
+
+        if (worker.start) {
+            worker.thread = SDL_CreateThread(ThreadFunction, "BandRenderer", &worker);
+        }
+
+        if (!worker.thread) {
+            SDL_Log("BandRenderer: failed to start render thread %u of %u.\n", i + 1, worker_count);
+
+            if (worker.start) {
+                SDL_DestroySemaphore(worker.start);
+            }
+
+            return false;
+        }
+
+        ++m_worker_count;
+    }
+
+    return true;
+}
+
+void BandRenderer::Stop() {
+    m_exit_requested.store(true, std::memory_order_release);
+
+    for (uint32_t i = 0; i < m_worker_count; ++i) {
+        SDL_SignalSemaphore(m_workers[i].start);
+    }
+
+    for (uint32_t i = 0; i < m_worker_count; ++i) {
+        SDL_WaitThread(m_workers[i].thread, nullptr);
+        SDL_DestroySemaphore(m_workers[i].start);
+    }
+
+    m_workers.reset();
+    m_worker_count = 0;
+
+    if (m_done) {
+        SDL_DestroySemaphore(m_done);
+        m_done = nullptr;
+    }
+}
+
+int SDLCALL BandRenderer::ThreadFunction(void* data) {
+    auto worker = static_cast<Worker*>(data);
+    BandRenderer* const owner = worker->owner;
+
+    for (;;) {
+        SDL_WaitSemaphore(worker->start);
+
+        if (owner->m_exit_requested.load(std::memory_order_acquire)) {
+            break;
+        }
+
+        owner->ProcessBands();
+
+        SDL_SignalSemaphore(owner->m_done);
+    }
+
+    return 0;
+}
+
+void BandRenderer::ProcessBands() {
+    for (;;) {
+        const int32_t band = m_next_band.fetch_add(1, std::memory_order_relaxed);
+
+        if (band >= m_band_count) {
+            break;
+        }
+
+        (*m_function)(band);
+    }
+}
+
+void BandRenderer::Run(int32_t band_count, const std::function<void(int32_t band)>& function) {
+    if (band_count <= 0) {
+        return;
+    }
+
+    if (m_worker_count == 0 || band_count == 1) {
+        for (int32_t band = 0; band < band_count; ++band) {
+            function(band);
+        }
+
+        return;
+    }
+
+    m_function = &function;
+    m_band_count = band_count;
+    m_next_band.store(0, std::memory_order_relaxed);
+
+    // the semaphores order the job setup above before the worker reads
+    const uint32_t helper_count = std::min<uint32_t>(m_worker_count, band_count - 1);
+
+    for (uint32_t i = 0; i < helper_count; ++i) {
+        SDL_SignalSemaphore(m_workers[i].start);
+    }
+
+    ProcessBands();
+
+    for (uint32_t i = 0; i < helper_count; ++i) {
+        SDL_WaitSemaphore(m_done);
+    }
+
+    m_function = nullptr;
+}
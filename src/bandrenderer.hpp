@@ -0,0 +1,96 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef BANDRENDERER_HPP
+#define BANDRENDERER_HPP
+
+#include <SDL3/SDL_mutex.h>
+#include <SDL3/SDL_thread.h>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+/**
+ * \class BandRenderer
+ * \brief Pool of render threads that process the horizontal bands of a frame buffer region in parallel.
+ *
+ * The caller splits its work into bands that write disjoint rows of the target buffer and calls Run(). The calling
+ * thread works on bands as well and Run() returns once every band is complete, so the banded pass is a drop in
+ * replacement for a serial loop over the same rows. Like WorkerThread, the pool uses SDL threads and primitives.
+ *
+ * Run() must only be called from one thread at a time, in practice the main thread.
+ */
+class BandRenderer {
+    struct Worker {
+        BandRenderer* owner;
+        SDL_Thread* thread;
+        SDL_Semaphore* start;
+    };
+
+    std::unique_ptr<Worker[]> m_workers;
+    uint32_t m_worker_count;
+    SDL_Semaphore* m_done;
+    std::atomic<bool> m_exit_requested;
+
+    const std::function<void(int32_t band)>* m_function;
+    int32_t m_band_count;
+    std::atomic<int32_t> m_next_band;
+
+    static int SDLCALL ThreadFunction(void* data);
+
+    void ProcessBands();
+
+public:
+    BandRenderer();
+    ~BandRenderer();
+
+    BandRenderer(const BandRenderer&) = delete;
+    BandRenderer& operator=(const BandRenderer&) = delete;
+
+    /**
+     * \brief Spawns the render threads.
+     *
+     * \param worker_count Number of threads in addition to the calling thread. 0 keeps all work on the caller.
+     * \return True if all threads were started. On failure the threads that did start are kept.
+     */
+    bool Start(uint32_t worker_count);
+
+    /**
+     * \brief Stops and joins the render threads.
+     */
+    void Stop();
+
+    /**
+     * \brief Invokes a function for every band and waits for completion.
+     *
+     * Bands are handed out in ascending order but may complete in any order and on any thread.
+     *
+     * \param band_count Number of bands.
+     * \param function Renders one band. Must not write rows that belong to another band.
+     */
+    void Run(int32_t band_count, const std::function<void(int32_t band)>& function);
+
+    [[nodiscard]] inline uint32_t GetThreadCount() const noexcept { return m_worker_count + 1; }
+};
+
+#endif /* BANDRENDERER_HPP */
@@ -0,0 +1,428 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "blitkernels.h"
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_intrin.h>
+
+#include <cstring>
+#include <vector>
+
+struct BlitKernels_RowFunctions {
+    const char* name;
+    void (*trans_copy)(const uint8_t* src, uint8_t* dst, int32_t width);
+    void (*mask_copy)(const uint8_t* src, const uint8_t* msk, uint8_t* dst, int32_t width);
+    void (*mask_trans_copy)(const uint8_t* src, const uint8_t* msk, uint8_t* dst, int32_t width);
+    void (*swap_colors)(uint8_t* buf, int32_t width, uint8_t color1, uint8_t color2);
+    void (*double_pixels)(const uint8_t* src, uint8_t* dst, int32_t width);
+};
+
+static void BlitKernels_TransCopyRowGeneric(const uint8_t* src, uint8_t* dst, int32_t width) {
+    for (int32_t x = 0; x < width; ++x) {
+        if (src[x]) {
+            dst[x] = src[x];
+        }
+    }
+}
+
+static void BlitKernels_MaskCopyRowGeneric(const uint8_t* src, const uint8_t* msk, uint8_t* dst, int32_t width) {
+    for (int32_t x = 0; x < width; ++x) {
+        if (msk[x]) {
+            dst[x] = src[x];
+        }
+    }
+}
+
+static void BlitKernels_MaskTransCopyRowGeneric(const uint8_t* src, const uint8_t* msk, uint8_t* dst, int32_t width) {
+    for (int32_t x = 0; x < width; ++x) {
+        if (msk[x] && src[x]) {
+            dst[x] = src[x];
+        }
+    }
+}
+
+static void BlitKernels_SwapColorsRowGeneric(uint8_t* buf, int32_t width, uint8_t color1, uint8_t color2) {
+    for (int32_t x = 0; x < width; ++x) {
+        if (buf[x] == color1) {
+            buf[x] = color2;
+
+        } else if (buf[x] == color2) {
+            buf[x] = color1;
+        }
+    }
+}
+
+static void BlitKernels_DoublePixelsRowGeneric(const uint8_t* src, uint8_t* dst, int32_t width) {
+    for (int32_t x = 0; x < width; ++x) {
+        dst[2 * x] = src[x];
+        dst[2 * x + 1] = src[x];
+    }
+}
+
+#ifdef SDL_SSE2_INTRINSICS
+/* the destination is read and written back in full vectors, kept pixels are rewritten with their own value */
+static void SDL_TARGETING("sse2") BlitKernels_TransCopyRowSse2(const uint8_t* src, uint8_t* dst, int32_t width) {
+    const __m128i zero = _mm_setzero_si128();
+    int32_t x = 0;
+
+    for (; x + 16 <= width; x += 16) {
+        const __m128i source = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[x]));
+        const __m128i target = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&dst[x]));
+        const __m128i keep = _mm_cmpeq_epi8(source, zero);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[x]),
+                         _mm_or_si128(_mm_and_si128(keep, target), _mm_andnot_si128(keep, source)));
+    }
+
+    BlitKernels_TransCopyRowGeneric(&src[x], &dst[x], width - x);
+}
+
+static void SDL_TARGETING("sse2")
+    BlitKernels_MaskCopyRowSse2(const uint8_t* src, const uint8_t* msk, uint8_t* dst, int32_t width) {
+    const __m128i zero = _mm_setzero_si128();
+    int32_t x = 0;
+
+    for (; x + 16 <= width; x += 16) {
+        const __m128i source = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[x]));
+        const __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&msk[x]));
+        const __m128i target = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&dst[x]));
+        const __m128i keep = _mm_cmpeq_epi8(mask, zero);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[x]),
+                         _mm_or_si128(_mm_and_si128(keep, target), _mm_andnot_si128(keep, source)));
+    }
+
+    BlitKernels_MaskCopyRowGeneric(&src[x], &msk[x], &dst[x], width - x);
+}
+
+static void SDL_TARGETING("sse2")
+    BlitKernels_MaskTransCopyRowSse2(const uint8_t* src, const uint8_t* msk, uint8_t* dst, int32_t width) {
+    const __m128i zero = _mm_setzero_si128();
+    int32_t x = 0;
+
+    for (; x + 16 <= width; x += 16) {
+        const __m128i source = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[x]));
+        const __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&msk[x]));
+        const __m128i target = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&dst[x]));
+        const __m128i keep = _mm_or_si128(_mm_cmpeq_epi8(mask, zero), _mm_cmpeq_epi8(source, zero));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[x]),
+                         _mm_or_si128(_mm_and_si128(keep, target), _mm_andnot_si128(keep, source)));
+    }
+
+    BlitKernels_MaskTransCopyRowGeneric(&src[x], &msk[x], &dst[x], width - x);
+}
+
+/* x ^ (color1 ^ color2) turns either color into the other one */
+static void SDL_TARGETING("sse2")
+    BlitKernels_SwapColorsRowSse2(uint8_t* buf, int32_t width, uint8_t color1, uint8_t color2) {
+    const __m128i first = _mm_set1_epi8(static_cast<char>(color1));
+    const __m128i second = _mm_set1_epi8(static_cast<char>(color2));
+    const __m128i difference = _mm_xor_si128(first, second);
+    int32_t x = 0;
+
+    for (; x + 16 <= width; x += 16) {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&buf[x]));
+        const __m128i match = _mm_or_si128(_mm_cmpeq_epi8(pixels, first), _mm_cmpeq_epi8(pixels, second));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&buf[x]),
+                         _mm_xor_si128(pixels, _mm_and_si128(match, difference)));
+    }
+
+    BlitKernels_SwapColorsRowGeneric(&buf[x], width - x, color1, color2);
+}
+
+static void SDL_TARGETING("sse2") BlitKernels_DoublePixelsRowSse2(const uint8_t* src, uint8_t* dst, int32_t width) {
+    int32_t x = 0;
+
+    for (; x + 16 <= width; x += 16) {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[x]));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[2 * x]), _mm_unpacklo_epi8(pixels, pixels));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[2 * x + 16]), _mm_unpackhi_epi8(pixels, pixels));
+    }
+
+    BlitKernels_DoublePixelsRowGeneric(&src[x], &dst[2 * x], width - x);
+}
+#endif /* SDL_SSE2_INTRINSICS */
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_TARGETING("avx2") BlitKernels_TransCopyRowAvx2(const uint8_t* src, uint8_t* dst, int32_t width) {
+    const __m256i zero = _mm256_setzero_si256();
+    int32_t x = 0;
+
+    for (; x + 32 <= width; x += 32) {
+        const __m256i source = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[x]));
+        const __m256i target = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&dst[x]));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dst[x]),
+                            _mm256_blendv_epi8(source, target, _mm256_cmpeq_epi8(source, zero)));
+    }
+
+    BlitKernels_TransCopyRowGeneric(&src[x], &dst[x], width - x);
+}
+
+static void SDL_TARGETING("avx2")
+    BlitKernels_MaskCopyRowAvx2(const uint8_t* src, const uint8_t* msk, uint8_t* dst, int32_t width) {
+    const __m256i zero = _mm256_setzero_si256();
+    int32_t x = 0;
+
+    for (; x + 32 <= width; x += 32) {
+        const __m256i source = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[x]));
+        const __m256i mask = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&msk[x]));
+        const __m256i target = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&dst[x]));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dst[x]),
+                            _mm256_blendv_epi8(source, target, _mm256_cmpeq_epi8(mask, zero)));
+    }
+
+    BlitKernels_MaskCopyRowGeneric(&src[x], &msk[x], &dst[x], width - x);
+}
+
+static void SDL_TARGETING("avx2")
+    BlitKernels_MaskTransCopyRowAvx2(const uint8_t* src, const uint8_t* msk, uint8_t* dst, int32_t width) {
+    const __m256i zero = _mm256_setzero_si256();
+    int32_t x = 0;
+
+    for (; x + 32 <= width; x += 32) {
+        const __m256i source = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[x]));
+        const __m256i mask = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&msk[x]));
+        const __m256i target = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&dst[x]));
+        const __m256i keep = _mm256_or_si256(_mm256_cmpeq_epi8(mask, zero), _mm256_cmpeq_epi8(source, zero));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dst[x]), _mm256_blendv_epi8(source, target, keep));
+    }
+
+    BlitKernels_MaskTransCopyRowGeneric(&src[x], &msk[x], &dst[x], width - x);
+}
+
+static void SDL_TARGETING("avx2")
+    BlitKernels_SwapColorsRowAvx2(uint8_t* buf, int32_t width, uint8_t color1, uint8_t color2) {
+    const __m256i first = _mm256_set1_epi8(static_cast<char>(color1));
+    const __m256i second = _mm256_set1_epi8(static_cast<char>(color2));
+    const __m256i difference = _mm256_xor_si256(first, second);
+    int32_t x = 0;
+
+    for (; x + 32 <= width; x += 32) {
+        const __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&buf[x]));
+        const __m256i match = _mm256_or_si256(_mm256_cmpeq_epi8(pixels, first), _mm256_cmpeq_epi8(pixels, second));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&buf[x]),
+                            _mm256_xor_si256(pixels, _mm256_and_si256(match, difference)));
+    }
+
+    BlitKernels_SwapColorsRowGeneric(&buf[x], width - x, color1, color2);
+}
+
+static void SDL_TARGETING("avx2") BlitKernels_DoublePixelsRowAvx2(const uint8_t* src, uint8_t* dst, int32_t width) {
+    int32_t x = 0;
+
+    for (; x + 32 <= width; x += 32) {
+        const __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[x]));
+        // the unpacks work within 128 bit lanes, the permutes put the lane halves back in order
+        const __m256i low = _mm256_unpacklo_epi8(pixels, pixels);
+        const __m256i high = _mm256_unpackhi_epi8(pixels, pixels);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dst[2 * x]), _mm256_permute2x128_si256(low, high, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dst[2 * x + 32]), _mm256_permute2x128_si256(low, high, 0x31));
+    }
+
+    BlitKernels_DoublePixelsRowGeneric(&src[x], &dst[2 * x], width - x);
+}
+#endif /* SDL_AVX2_INTRINSICS */
+
+static const BlitKernels_RowFunctions& BlitKernels_SelectRowFunctions() {
+    static const BlitKernels_RowFunctions generic{"generic",
+                                                  &BlitKernels_TransCopyRowGeneric,
+                                                  &BlitKernels_MaskCopyRowGeneric,
+                                                  &BlitKernels_MaskTransCopyRowGeneric,
+                                                  &BlitKernels_SwapColorsRowGeneric,
+                                                  &BlitKernels_DoublePixelsRowGeneric};
+
+#ifdef SDL_AVX2_INTRINSICS
+    static const BlitKernels_RowFunctions avx2{"avx2",
+                                               &BlitKernels_TransCopyRowAvx2,
+                                               &BlitKernels_MaskCopyRowAvx2,
+                                               &BlitKernels_MaskTransCopyRowAvx2,
+                                               &BlitKernels_SwapColorsRowAvx2,
+                                               &BlitKernels_DoublePixelsRowAvx2};
+
+    if (SDL_HasAVX2()) {
+        return avx2;
+    }
+#endif /* SDL_AVX2_INTRINSICS */
+
+#ifdef SDL_SSE2_INTRINSICS
+    static const BlitKernels_RowFunctions sse2{"sse2",
+                                               &BlitKernels_TransCopyRowSse2,
+                                               &BlitKernels_MaskCopyRowSse2,
+                                               &BlitKernels_MaskTransCopyRowSse2,
+                                               &BlitKernels_SwapColorsRowSse2,
+                                               &BlitKernels_DoublePixelsRowSse2};
+
+    if (SDL_HasSSE2()) {
+        return sse2;
+    }
+#endif /* SDL_SSE2_INTRINSICS */
+
+    return generic;
+}
+
+static inline const BlitKernels_RowFunctions& BlitKernels_GetRowFunctions() {
+    static const BlitKernels_RowFunctions& functions = BlitKernels_SelectRowFunctions();
+
+    return functions;
+}
+
+void BlitKernels_TransCopy(const uint8_t* src, int32_t width, int32_t length, int32_t src_pitch, uint8_t* dst,
+                           int32_t dst_pitch) {
+    const auto trans_copy = BlitKernels_GetRowFunctions().trans_copy;
+
+    for (int32_t y = 0; y < length; ++y) {
+        trans_copy(src, dst, width);
+
+        src = &src[src_pitch];
+        dst = &dst[dst_pitch];
+    }
+}
+
+void BlitKernels_MaskCopy(const uint8_t* src, int32_t width, int32_t length, int32_t src_pitch, const uint8_t* msk,
+                          int32_t msk_pitch, uint8_t* dst, int32_t dst_pitch) {
+    const auto mask_copy = BlitKernels_GetRowFunctions().mask_copy;
+
+    for (int32_t y = 0; y < length; ++y) {
+        mask_copy(src, msk, dst, width);
+
+        src = &src[src_pitch];
+        msk = &msk[msk_pitch];
+        dst = &dst[dst_pitch];
+    }
+}
+
+void BlitKernels_MaskTransCopy(const uint8_t* src, int32_t width, int32_t length, int32_t src_pitch,
+                               const uint8_t* msk, int32_t msk_pitch, uint8_t* dst, int32_t dst_pitch) {
+    const auto mask_trans_copy = BlitKernels_GetRowFunctions().mask_trans_copy;
+
+    for (int32_t y = 0; y < length; ++y) {
+        mask_trans_copy(src, msk, dst, width);
+
+        src = &src[src_pitch];
+        msk = &msk[msk_pitch];
+        dst = &dst[dst_pitch];
+    }
+}
+
+void BlitKernels_Remap(uint8_t* buf, int32_t width, int32_t length, int32_t pitch, const uint8_t* color_table) {
+    for (int32_t y = 0; y < length; ++y) {
+        int32_t x = 0;
+
+        for (; x + 4 <= width; x += 4) {
+            const uint8_t pixel0 = color_table[buf[x + 0]];
+            const uint8_t pixel1 = color_table[buf[x + 1]];
+            const uint8_t pixel2 = color_table[buf[x + 2]];
+            const uint8_t pixel3 = color_table[buf[x + 3]];
+
+            buf[x + 0] = pixel0;
+            buf[x + 1] = pixel1;
+            buf[x + 2] = pixel2;
+            buf[x + 3] = pixel3;
+        }
+
+        for (; x < width; ++x) {
+            buf[x] = color_table[buf[x]];
+        }
+
+        buf = &buf[pitch];
+    }
+}
+
+void BlitKernels_SwapColors(uint8_t* buf, int32_t width, int32_t length, int32_t pitch, uint8_t color1,
+                            uint8_t color2) {
+    const auto swap_colors = BlitKernels_GetRowFunctions().swap_colors;
+
+    for (int32_t y = 0; y < length; ++y) {
+        swap_colors(buf, width, color1, color2);
+
+        buf = &buf[pitch];
+    }
+}
+
+static void BlitKernels_ExpandRow(const uint8_t* src, int32_t ow, uint32_t mx, uint8_t* row) {
+    if (mx == (2u << 16)) {
+        BlitKernels_GetRowFunctions().double_pixels(src, row, ow);
+
+    } else if ((mx & 0xFFFF) == 0) {
+        const int32_t factor = static_cast<int32_t>(mx >> 16);
+
+        for (int32_t x = 0; x < ow; ++x) {
+            memset(&row[x * factor], src[x], factor);
+        }
+
+    } else {
+        uint32_t start = 0;
+
+        for (int32_t x = 0; x < ow; ++x) {
+            const uint32_t end = start + mx;
+
+            memset(&row[start >> 16], src[x], (end >> 16) - (start >> 16));
+
+            start = end;
+        }
+    }
+}
+
+void BlitKernels_Scale(const uint8_t* src, int32_t ow, int32_t ol, int32_t src_pitch, uint8_t* dst, int32_t nw,
+                       int32_t nl, int32_t dst_pitch, bool transparent) {
+    static thread_local std::vector<uint8_t> row;
+
+    if (ow <= 0 || ol <= 0) {
+        return;
+    }
+
+    const int32_t my = (nl << 16) / ol;
+    const uint32_t mx = static_cast<uint32_t>((nw << 16) / ow);
+    const int32_t row_width = static_cast<int32_t>((static_cast<uint32_t>(ow) * mx) >> 16);
+    const auto trans_copy = BlitKernels_GetRowFunctions().trans_copy;
+
+    row.resize(row_width);
+
+    for (int32_t y = 0; y < ol; ++y) {
+        const int32_t first_row = (my * y) >> 16;
+        const int32_t last_row = (my + my * y) >> 16;
+
+        // source rows that map to no destination row are skipped when shrinking
+        if (first_row < last_row) {
+            BlitKernels_ExpandRow(&src[y * src_pitch], ow, mx, row.data());
+
+            for (int32_t target_row = first_row; target_row < last_row; ++target_row) {
+                if (transparent) {
+                    trans_copy(row.data(), &dst[target_row * dst_pitch], row_width);
+
+                } else {
+                    memcpy(&dst[target_row * dst_pitch], row.data(), row_width);
+                }
+            }
+        }
+    }
+}
+
+const char* BlitKernels_GetInstructionSet(void) { return BlitKernels_GetRowFunctions().name; }
@@ -0,0 +1,72 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef BLITKERNELS_H
+#define BLITKERNELS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Rectangle kernels behind the grbuf primitives. Every kernel has a scalar, an SSE2 and an AVX2 implementation that
+ * produce identical output, the fastest one supported by the processor is selected on first use. Palette index 0 is
+ * the transparent color of the source and mask buffers.
+ */
+
+/* Copies the non transparent source pixels. */
+void BlitKernels_TransCopy(const uint8_t* src, int32_t width, int32_t length, int32_t src_pitch, uint8_t* dst,
+                           int32_t dst_pitch);
+
+/* Copies the source pixels where the mask is not transparent. */
+void BlitKernels_MaskCopy(const uint8_t* src, int32_t width, int32_t length, int32_t src_pitch, const uint8_t* msk,
+                          int32_t msk_pitch, uint8_t* dst, int32_t dst_pitch);
+
+/* Copies the non transparent source pixels where the mask is not transparent. */
+void BlitKernels_MaskTransCopy(const uint8_t* src, int32_t width, int32_t length, int32_t src_pitch,
+                               const uint8_t* msk, int32_t msk_pitch, uint8_t* dst, int32_t dst_pitch);
+
+/* Replaces every pixel by its entry in a 256 entry palette index table. */
+void BlitKernels_Remap(uint8_t* buf, int32_t width, int32_t length, int32_t pitch, const uint8_t* color_table);
+
+/* Exchanges two palette indices. */
+void BlitKernels_SwapColors(uint8_t* buf, int32_t width, int32_t length, int32_t pitch, uint8_t color1,
+                            uint8_t color2);
+
+/*
+ * Nearest neighbour scaling with the 16.16 fixed point source pixel boundaries of cscale(). Each source row is expanded
+ * once and copied to all of its destination rows, integer ratios expand by replication. Transparent scaling leaves the
+ * destination untouched where the source pixel is transparent.
+ */
+void BlitKernels_Scale(const uint8_t* src, int32_t ow, int32_t ol, int32_t src_pitch, uint8_t* dst, int32_t nw,
+                       int32_t nl, int32_t dst_pitch, bool transparent);
+
+/* Name of the selected implementation, for benchmarks and logs. */
+const char* BlitKernels_GetInstructionSet(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BLITKERNELS_H */
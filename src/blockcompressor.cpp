@@ -0,0 +1,250 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "blockcompressor.hpp"
+
+#include <cstring>
+
+static constexpr uint32_t BlockCompressor_HashBits = 12;
+static constexpr size_t BlockCompressor_MinimumMatch = 4;
+static constexpr size_t BlockCompressor_MaximumOffset = UINT16_MAX;
+
+static inline uint32_t BlockCompressor_Load32(const uint8_t* address) noexcept {
+    uint32_t value;
+
+    memcpy(&value, address, sizeof(value));
+
+    return value;
+}
+
+static inline uint32_t BlockCompressor_Hash(uint32_t prefix) noexcept {
+    return (prefix * 2654435761u) >> (32 - BlockCompressor_HashBits);
+}
+
+static inline bool BlockCompressor_PutLength(uint8_t*& target, const uint8_t* const target_end,
+                                             size_t length) noexcept {
+    while (length >= UINT8_MAX) {
+        if (target == target_end) {
+            return false;
+        }
+
+        *target++ = UINT8_MAX;
+        length -= UINT8_MAX;
+    }
+
+    if (target == target_end) {
+        return false;
+    }
+
+    *target++ = static_cast<uint8_t>(length);
+
+    return true;
+}
+
+static inline bool BlockCompressor_GetLength(const uint8_t*& source, const uint8_t* const source_end,
+                                             size_t& length) noexcept {
+    uint8_t value;
+
+    do {
+        if (source == source_end) {
+            return false;
+        }
+
+        value = *source++;
+        length += value;
+    } while (value == UINT8_MAX);
+
+    return true;
+}
+
+static bool BlockCompressor_PutSequence(uint8_t*& target, const uint8_t* const target_end, const uint8_t* literals,
+                                        size_t literal_count, size_t offset, size_t match_length) noexcept {
+    if (target == target_end) {
+        return false;
+    }
+
+    uint8_t* const token = target++;
+    const size_t match_code = match_length ? match_length - BlockCompressor_MinimumMatch : 0;
+
+    const size_t literal_code = literal_count < 15 ? literal_count : 15;
+
+    *token = static_cast<uint8_t>((literal_code << 4) | (match_code < 15 ? match_code : 15));
+
+    if (literal_count >= 15 && !BlockCompressor_PutLength(target, target_end, literal_count - 15)) {
+        return false;
+    }
+
+    if (static_cast<size_t>(target_end - target) < literal_count) {
+        return false;
+    }
+
+    if (literal_count) {
+        memcpy(target, literals, literal_count);
+        target += literal_count;
+    }
+
+    // the closing sequence of a block carries no match
+    if (match_length == 0) {
+        return true;
+    }
+
+    if (target_end - target < 2) {
+        return false;
+    }
+
+    *target++ = static_cast<uint8_t>(offset);
+    *target++ = static_cast<uint8_t>(offset >> 8);
+
+    return match_code < 15 || BlockCompressor_PutLength(target, target_end, match_code - 15);
+}
+
+size_t BlockCompressor_Compress(const uint8_t* const source, const size_t size, uint8_t* const target,
+                                const size_t capacity) noexcept {
+    uint32_t table[1 << BlockCompressor_HashBits];
+    const uint8_t* const target_end = &target[capacity];
+    uint8_t* output = target;
+    size_t anchor = 0;
+    size_t position = 0;
+    uint32_t misses = 0;
+
+    if (size > UINT32_MAX) {
+        return 0;
+    }
+
+    memset(table, 0xFF, sizeof(table));
+
+    while (size >= BlockCompressor_MinimumMatch && position <= size - BlockCompressor_MinimumMatch) {
+        const uint32_t prefix = BlockCompressor_Load32(&source[position]);
+        const uint32_t hash = BlockCompressor_Hash(prefix);
+        const uint32_t candidate = table[hash];
+
+        table[hash] = static_cast<uint32_t>(position);
+
+        if (candidate == UINT32_MAX || position - candidate > BlockCompressor_MaximumOffset ||
+            BlockCompressor_Load32(&source[candidate]) != prefix) {
+            // skip ahead faster through data that does not compress
+            position += 1 + (misses++ >> 6);
+
+            continue;
+        }
+
+        misses = 0;
+
+        size_t match_start = position;
+        size_t match_source = candidate;
+
+        while (match_start > anchor && match_source > 0 && source[match_start - 1] == source[match_source - 1]) {
+            --match_start;
+            --match_source;
+        }
+
+        size_t match_end = position + BlockCompressor_MinimumMatch;
+
+        while (match_end < size && source[match_end] == source[match_source + (match_end - match_start)]) {
+            ++match_end;
+        }
+
+        if (!BlockCompressor_PutSequence(output, target_end, &source[anchor], match_start - anchor,
+                                         match_start - match_source, match_end - match_start)) {
+            return 0;
+        }
+
+        anchor = match_end;
+        position = match_end;
+
+        // index a position near the match end so that long runs keep matching
+        if (match_end + 2 <= size) {
+            table[BlockCompressor_Hash(BlockCompressor_Load32(&source[match_end - 2]))] =
+                static_cast<uint32_t>(match_end - 2);
+        }
+    }
+
+    if (!BlockCompressor_PutSequence(output, target_end, &source[anchor], size - anchor, 0, 0)) {
+        return 0;
+    }
+
+    return static_cast<size_t>(output - target);
+}
+
+bool BlockCompressor_Decompress(const uint8_t* source, const size_t size, uint8_t* const target,
+                                const size_t raw_size) noexcept {
+    const uint8_t* const source_end = &source[size];
+    size_t position = 0;
+
+    while (source != source_end) {
+        const uint8_t token = *source++;
+        size_t literal_count = token >> 4;
+
+        if (literal_count == 15 && !BlockCompressor_GetLength(source, source_end, literal_count)) {
+            return false;
+        }
+
+        if (static_cast<size_t>(source_end - source) < literal_count || raw_size - position < literal_count) {
+            return false;
+        }
+
+        if (literal_count) {
+            memcpy(&target[position], source, literal_count);
+            source += literal_count;
+            position += literal_count;
+        }
+
+        if (source == source_end) {
+            break;
+        }
+
+        if (source_end - source < 2) {
+            return false;
+        }
+
+        const size_t offset = source[0] | (source[1] << 8);
+        size_t match_length = token & 0x0F;
+
+        source += 2;
+
+        if (match_length == 15 && !BlockCompressor_GetLength(source, source_end, match_length)) {
+            return false;
+        }
+
+        match_length += BlockCompressor_MinimumMatch;
+
+        if (offset == 0 || offset > position || raw_size - position < match_length) {
+            return false;
+        }
+
+        uint8_t* output = &target[position];
+        const uint8_t* match = output - offset;
+
+        if (offset >= match_length) {
+            memcpy(output, match, match_length);
+
+        } else {
+            // overlapping copies repeat the last offset bytes
+            for (size_t i = 0; i < match_length; ++i) {
+                output[i] = match[i];
+            }
+        }
+
+        position += match_length;
+    }
+
+    return position == raw_size;
+}
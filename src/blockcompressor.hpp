@@ -0,0 +1,75 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef BLOCKCOMPRESSOR_HPP
+#define BLOCKCOMPRESSOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * \file blockcompressor.hpp
+ * \brief Byte oriented LZ77 block codec in the spirit of LZ4, used by the compressed save file format.
+ *
+ * A block is a series of sequences. Each sequence is a token byte, whose high nibble is the literal count and low
+ * nibble is the match length minus 4, a literal count extension, the literals, a 16 bit little endian match offset
+ * and a match length extension. A nibble of 15 is extended by bytes that are added to it up to and including the
+ * first byte below 255. The last sequence of a block consists of literals only.
+ *
+ * The encoder favours speed over ratio, it looks for matches through a small hash table of 4 byte prefixes. The
+ * decoder checks every length and offset against the buffer bounds, so damaged input is rejected rather than read or
+ * written out of bounds.
+ */
+
+/**
+ * \brief Gets the worst case encoded size of a block.
+ *
+ * \param size Raw size of the block.
+ * \return Upper bound of the encoded size of any block of the given raw size.
+ */
+[[nodiscard]] constexpr size_t BlockCompressor_GetBound(size_t size) noexcept { return size + size / 255 + 16; }
+
+/**
+ * \brief Encodes a block.
+ *
+ * \param source Raw data.
+ * \param size Raw size in bytes, at most 4 GiB.
+ * \param target Destination of the encoded block.
+ * \param capacity Size of the destination buffer.
+ * \return Encoded size, or 0 if the encoded block would not fit into capacity bytes. Incompressible data is best
+ * stored raw by passing a capacity smaller than size.
+ */
+[[nodiscard]] size_t BlockCompressor_Compress(const uint8_t* source, size_t size, uint8_t* target,
+                                              size_t capacity) noexcept;
+
+/**
+ * \brief Decodes a block.
+ *
+ * \param source Encoded block.
+ * \param size Encoded size in bytes.
+ * \param target Destination of the raw data.
+ * \param raw_size Exact raw size of the block.
+ * \return True if the block was intact and decoded to exactly raw_size bytes.
+ */
+[[nodiscard]] bool BlockCompressor_Decompress(const uint8_t* source, size_t size, uint8_t* target,
+                                              size_t raw_size) noexcept;
+
+#endif /* BLOCKCOMPRESSOR_HPP */
@@ -31,6 +31,7 @@ static uint8_t Color_ColorPalette[PALETTE_STRIDE * PALETTE_SIZE];
 static uint8_t Color_SystemPalette[PALETTE_STRIDE * PALETTE_SIZE];
 static ColorIndex Color_RgbIndexTable[RGB555_COLOR_COUNT];
 static Color Color_IntensityColorTable[256][PALETTE_SIZE];
+static uint32_t Color_ColorPaletteVersion;
 
 Color Color_RGB2Color(ColorRGB c) { return Color_RgbIndexTable[c]; }
 Color Color_ColorIntensity(int32_t intensity, Color color) { return Color_IntensityColorTable[color][intensity / 512]; }
@@ -89,7 +90,12 @@ void Color_SetSystemPaletteEntry(int32_t entry, uint8_t r, uint8_t g, uint8_t b)
 
 uint8_t* Color_GetColorPalette(void) { return Color_ColorPalette; }
 
-void Color_SetColorPalette(uint8_t* palette) { memmove(Color_ColorPalette, palette, sizeof(Color_ColorPalette)); }
+void Color_SetColorPalette(uint8_t* palette) {
+    memmove(Color_ColorPalette, palette, sizeof(Color_ColorPalette));
+    ++Color_ColorPaletteVersion;
+}
+
+uint32_t Color_GetColorPaletteVersion(void) { return Color_ColorPaletteVersion; }
 
 int32_t Color_Init(void) {
     int32_t result;
@@ -111,6 +117,7 @@ int32_t Color_Init(void) {
 
             Color_SetSystemPalette(Color_ColorPalette);
 
+            ++Color_ColorPaletteVersion;
             Color_Inited = 1;
             result = 1;
         }
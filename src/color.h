@@ -65,6 +65,7 @@ void Color_SetSystemPalette(uint8_t* palette);
 void Color_SetSystemPaletteEntry(int32_t entry, uint8_t r, uint8_t g, uint8_t b);
 uint8_t* Color_GetColorPalette(void);
 void Color_SetColorPalette(uint8_t* palette);
+uint32_t Color_GetColorPaletteVersion(void);
 ColorIndex Color_MapColor(uint8_t* palette, Color r, Color g, Color b, bool full_scan);
 
 #ifdef __cplusplus
@@ -0,0 +1,152 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "dirtyregion.hpp"
+
+#include <algorithm>
+
+static inline int64_t DirtyRegion_GetArea(const Rect& bounds) {
+    return static_cast<int64_t>(bounds.lrx - bounds.ulx) * (bounds.lry - bounds.uly);
+}
+
+static inline bool DirtyRegion_IsIntersecting(const Rect& bounds1, const Rect& bounds2) {
+    return bounds1.ulx < bounds2.lrx && bounds2.ulx < bounds1.lrx && bounds1.uly < bounds2.lry &&
+           bounds2.uly < bounds1.lry;
+}
+
+static inline Rect DirtyRegion_GetUnion(const Rect& bounds1, const Rect& bounds2) {
+    return {std::min(bounds1.ulx, bounds2.ulx), std::min(bounds1.uly, bounds2.uly), std::max(bounds1.lrx, bounds2.lrx),
+            std::max(bounds1.lry, bounds2.lry)};
+}
+
+static inline int64_t DirtyRegion_GetIntersectionArea(const Rect& bounds1, const Rect& bounds2) {
+    if (!DirtyRegion_IsIntersecting(bounds1, bounds2)) {
+        return 0;
+    }
+
+    const Rect intersection = {std::max(bounds1.ulx, bounds2.ulx), std::max(bounds1.uly, bounds2.uly),
+                               std::min(bounds1.lrx, bounds2.lrx), std::min(bounds1.lry, bounds2.lry)};
+
+    return DirtyRegion_GetArea(intersection);
+}
+
+DirtyRegion::DirtyRegion(int64_t merge_cost) : m_merge_cost(merge_cost), m_requested_area(0) {}
+
+void DirtyRegion::Add(const Rect& bounds) {
+    if (bounds.lrx <= bounds.ulx || bounds.lry <= bounds.uly) {
+        return;
+    }
+
+    m_requested_area += DirtyRegion_GetArea(bounds);
+
+    Rect rect = bounds;
+
+    // grow the new rectangle as long as absorbing a neighbour is cheaper than keeping it separate
+    for (bool is_merged = true; is_merged;) {
+        is_merged = false;
+
+        for (size_t i = 0; i < m_rects.size(); ++i) {
+            const Rect& other = m_rects[i];
+            const Rect merged = DirtyRegion_GetUnion(rect, other);
+            const int64_t waste = DirtyRegion_GetArea(merged) - DirtyRegion_GetArea(rect) - DirtyRegion_GetArea(other) +
+                                  DirtyRegion_GetIntersectionArea(rect, other);
+
+            if (waste <= m_merge_cost) {
+                rect = merged;
+
+                m_rects[i] = m_rects.back();
+                m_rects.pop_back();
+
+                is_merged = true;
+                break;
+            }
+        }
+    }
+
+    AddDisjoint(rect, 0);
+}
+
+void DirtyRegion::AddDisjoint(const Rect& bounds, size_t first_index) {
+    for (size_t i = first_index; i < m_rects.size(); ++i) {
+        const Rect other = m_rects[i];
+
+        if (DirtyRegion_IsIntersecting(bounds, other)) {
+            if (bounds.ulx >= other.ulx && bounds.lrx <= other.lrx && bounds.uly >= other.uly &&
+                bounds.lry <= other.lry) {
+                return;
+            }
+
+            // cut the rectangle into the up to four parts that lie outside of the existing one
+            const int32_t band_uly = std::max(bounds.uly, other.uly);
+            const int32_t band_lry = std::min(bounds.lry, other.lry);
+
+            if (bounds.uly < other.uly) {
+                AddDisjoint({bounds.ulx, bounds.uly, bounds.lrx, other.uly}, i + 1);
+            }
+
+            if (bounds.lry > other.lry) {
+                AddDisjoint({bounds.ulx, other.lry, bounds.lrx, bounds.lry}, i + 1);
+            }
+
+            if (bounds.ulx < other.ulx) {
+                AddDisjoint({bounds.ulx, band_uly, other.ulx, band_lry}, i + 1);
+            }
+
+            if (bounds.lrx > other.lrx) {
+                AddDisjoint({other.lrx, band_uly, bounds.lrx, band_lry}, i + 1);
+            }
+
+            return;
+        }
+    }
+
+    m_rects.push_back(bounds);
+}
+
+void DirtyRegion::Clear() noexcept {
+    m_rects.clear();
+    m_requested_area = 0;
+}
+
+bool DirtyRegion::Intersects(const Rect& bounds) const noexcept {
+    return std::any_of(m_rects.begin(), m_rects.end(),
+                       [&bounds](const Rect& rect) { return DirtyRegion_IsIntersecting(bounds, rect); });
+}
+
+Rect DirtyRegion::GetBounds() const noexcept {
+    Rect bounds = m_rects.front();
+
+    for (const Rect& rect : m_rects) {
+        bounds = DirtyRegion_GetUnion(bounds, rect);
+    }
+
+    return bounds;
+}
+
+int64_t DirtyRegion::GetArea() const noexcept {
+    int64_t area = 0;
+
+    for (const Rect& rect : m_rects) {
+        area += DirtyRegion_GetArea(rect);
+    }
+
+    return area;
+}
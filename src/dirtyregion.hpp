@@ -0,0 +1,93 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef DIRTYREGION_HPP
+#define DIRTYREGION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "rect.h"
+
+/**
+ * \class DirtyRegion
+ * \brief Set of disjoint rectangles that need to be redrawn.
+ *
+ * Rectangles use exclusive lower right corners. A new rectangle is merged with an existing one if their bounding box
+ * wastes at most merge_cost area units compared to keeping both, because every rectangle costs a fixed amount of work
+ * downstream (a render pass over the unit lists, a window blit or a texture lock). Otherwise the parts of the new
+ * rectangle that are already covered are cut away, so no pixel is redrawn twice in a frame.
+ *
+ * The region counts the area that was requested and the area that it covers since the last Clear().
+ */
+class DirtyRegion {
+public:
+    /**
+     * \brief Creates an empty region.
+     *
+     * \param merge_cost Area that may be redrawn needlessly to save a rectangle.
+     */
+    explicit DirtyRegion(int64_t merge_cost);
+
+    /**
+     * \brief Adds a rectangle to the region. Empty rectangles are ignored.
+     */
+    void Add(const Rect& bounds);
+
+    /**
+     * \brief Removes all rectangles and resets the requested area.
+     */
+    void Clear() noexcept;
+
+    /**
+     * \brief Tests whether a rectangle intersects the region.
+     */
+    [[nodiscard]] bool Intersects(const Rect& bounds) const noexcept;
+
+    /**
+     * \brief Gets the bounding box of all rectangles. Only valid if the region is not empty.
+     */
+    [[nodiscard]] Rect GetBounds() const noexcept;
+
+    /**
+     * \brief Gets the area covered by the region, the area that is going to be redrawn.
+     */
+    [[nodiscard]] int64_t GetArea() const noexcept;
+
+    /**
+     * \brief Gets the sum of the areas of all rectangles added since the last Clear(), overlaps counted repeatedly.
+     */
+    [[nodiscard]] inline int64_t GetRequestedArea() const noexcept { return m_requested_area; }
+
+    [[nodiscard]] inline size_t GetCount() const noexcept { return m_rects.size(); }
+    [[nodiscard]] inline bool IsEmpty() const noexcept { return m_rects.empty(); }
+    [[nodiscard]] inline const Rect& operator[](size_t index) const noexcept { return m_rects[index]; }
+
+private:
+    std::vector<Rect> m_rects;
+    int64_t m_merge_cost;
+    int64_t m_requested_area;
+
+    void AddDisjoint(const Rect& bounds, size_t first_index);
+};
+
+#endif /* DIRTYREGION_HPP */
@@ -23,6 +23,7 @@
 
 #include "access.hpp"
 #include "color.h"
+#include "frameprofiler.hpp"
 #include "game_manager.hpp"
 #include "gfx.hpp"
 #include "researchmenu.hpp"
@@ -35,21 +36,17 @@
 #include "window_manager.hpp"
 #include "world.hpp"
 
-enum {
-    OVERLAP_2IN1,
-    OVERLAP_1B2_SIDE_IS_LOWER,
-    OVERLAP_2B1_SIDE_IS_HIGHER,
-    OVERLAP_1IN2,
-};
+/* redrawing one map tile worth of needless pixels is cheaper than another pass over the unit lists */
+#define DRAWMAP_DIRTY_REGION_MERGE_COST (GFX_MAP_TILE_SIZE * GFX_MAP_TILE_SIZE)
+
+static DirtyRegion DrawMap_DirtyRegion(DRAWMAP_DIRTY_REGION_MERGE_COST);
+static MinimapCache DrawMap_MinimapCache;
 
-static ObjectArray<Rect> DrawMap_DirtyRectangles;
 static struct ImageSimpleHeader* DrawMap_BuildMarkImage;
 static int32_t DrawMap_BuildMMarkDelayCounter = 2;
 static int32_t DrawMap_BuildMarkImageIndex;
 static ResourceID DrawMap_BuildMarkImages[] = {BLDMRK1, BLDMRK2, BLDMRK3, BLDMRK4, BLDMRK5};
 
-static int32_t DrawMap_GetSideOverlap(int32_t lr1, int32_t ul1, int32_t lr2, int32_t ul2);
-static void Drawmap_AddDirtyZone(Rect* bounds1, Rect* bounds2, int32_t horizontal_side, int32_t vertical_side);
 static void DrawMap_Callback1(int32_t ulx, int32_t uly);
 static void DrawMap_RedrawUnit(UnitInfo* unit, void (*callback)(int32_t ulx, int32_t uly));
 static void DrawMap_Callback2(int32_t ulx, int32_t uly);
@@ -116,83 +113,6 @@ int32_t DrawMapBuffer::GetHeight() const { return bounds.lry - bounds.uly; }
 
 Rect* DrawMapBuffer::GetBounds() { return &bounds; }
 
-int32_t DrawMap_GetSideOverlap(int32_t lr1, int32_t ul1, int32_t lr2, int32_t ul2) {
-    int32_t result;
-
-    if (lr1 >= lr2 && ul1 <= ul2) {
-        result = OVERLAP_2IN1;
-
-    } else if (lr1 <= lr2 && ul1 >= ul2) {
-        result = OVERLAP_1IN2;
-
-    } else if (lr1 >= lr2) {
-        result = OVERLAP_2B1_SIDE_IS_HIGHER;
-
-    } else {
-        result = OVERLAP_1B2_SIDE_IS_LOWER;
-    }
-
-    return result;
-}
-
-void Drawmap_AddDirtyZone(Rect* bounds1, Rect* bounds2, int32_t horizontal_side, int32_t vertical_side) {
-    if (horizontal_side != OVERLAP_2IN1) {
-        if (horizontal_side == OVERLAP_1B2_SIDE_IS_LOWER) {
-            if (vertical_side != OVERLAP_2IN1) {
-                Rect bounds;
-
-                SDL_assert(vertical_side == OVERLAP_1B2_SIDE_IS_LOWER);
-
-                rect_init(&bounds, bounds1->ulx, bounds1->uly, bounds1->lrx, bounds2->uly);
-
-                bounds1->uly = bounds2->uly;
-                bounds1->lrx = bounds2->ulx;
-
-                Drawmap_UpdateDirtyZones(&bounds);
-
-            } else {
-                bounds1->lrx = bounds2->ulx;
-            }
-
-        } else {
-            SDL_assert(horizontal_side == OVERLAP_2B1_SIDE_IS_HIGHER);
-
-            if (vertical_side != OVERLAP_2IN1) {
-                Rect bounds;
-
-                SDL_assert(vertical_side == OVERLAP_1B2_SIDE_IS_LOWER);
-
-                rect_init(&bounds, bounds1->ulx, bounds1->uly, bounds1->lrx, bounds2->uly);
-
-                bounds1->uly = bounds2->uly;
-                bounds1->ulx = bounds2->lrx;
-
-                Drawmap_UpdateDirtyZones(&bounds);
-
-            } else {
-                bounds1->ulx = bounds2->lrx;
-            }
-        }
-
-    } else {
-        if (vertical_side == OVERLAP_2B1_SIDE_IS_HIGHER) {
-            bounds1->uly = bounds2->lry;
-
-        } else if (vertical_side == OVERLAP_1IN2) {
-            Rect bounds;
-
-            rect_init(&bounds, bounds1->ulx, bounds1->uly, bounds1->lrx, bounds2->uly);
-
-            bounds1->uly = bounds2->lry;
-
-            Drawmap_UpdateDirtyZones(&bounds);
-
-        } else if (vertical_side == OVERLAP_1B2_SIDE_IS_LOWER) {
-            bounds1->lry = bounds2->uly;
-        }
-    }
-}
-
 void Drawmap_UpdateDirtyZones(Rect* bounds) {
     Rect local;
 
@@ -219,74 +139,7 @@ void Drawmap_UpdateDirtyZones(Rect* bounds) {
             GameManager_LastZoomLevel = 0;
         }
 
-        if (local.lrx > local.ulx && local.lry > local.uly) {
-            for (int64_t i = static_cast<int64_t>(DrawMap_DirtyRectangles.GetCount()) - 1; i >= 0; --i) {
-                Rect dirty;
-                int32_t overlap_x;
-                int32_t overlap_y;
-
-                dirty = *DrawMap_DirtyRectangles[i];
-
-                if (local.lrx > dirty.ulx && local.ulx < dirty.lrx && local.lry > dirty.uly && local.uly < dirty.lry) {
-                    overlap_x = DrawMap_GetSideOverlap(local.ulx, local.lrx, dirty.ulx, dirty.lrx);
-                    overlap_y = DrawMap_GetSideOverlap(local.uly, local.lry, dirty.uly, dirty.lry);
-
-                    if (!overlap_x && !overlap_y) {
-                        return;
-                    }
-
-                    if (overlap_x == OVERLAP_1IN2 && overlap_y == OVERLAP_1IN2) {
-                        DrawMap_DirtyRectangles.Remove(i);
-
-                    } else if (overlap_x == OVERLAP_1IN2 ||
-                               (overlap_x && overlap_y && overlap_y != OVERLAP_1B2_SIDE_IS_LOWER)) {
-                        Drawmap_AddDirtyZone(DrawMap_DirtyRectangles[i], &local, OVERLAP_1IN2 - overlap_x,
-                                             OVERLAP_1IN2 - overlap_y);
-
-                        dirty = *DrawMap_DirtyRectangles[i];
-
-                        if (dirty.lrx <= dirty.ulx || dirty.lry <= dirty.uly) {
-                            DrawMap_DirtyRectangles.Remove(i);
-                        }
-
-                    } else {
-                        Drawmap_AddDirtyZone(&local, DrawMap_DirtyRectangles[i], overlap_x, overlap_y);
-
-                        if (local.lrx <= local.ulx || local.lry <= local.uly) {
-                            return;
-                        }
-                    }
-
-                    if (DrawMap_DirtyRectangles.GetCount() < i) {
-                        i = DrawMap_DirtyRectangles.GetCount();
-                    }
-                }
-            }
-
-            for (int32_t i = DrawMap_DirtyRectangles.GetCount() - 1; i >= 0; --i) {
-                Rect dirty;
-
-                dirty = *DrawMap_DirtyRectangles[i];
-
-                if (local.ulx == dirty.ulx && local.lrx == dirty.lrx &&
-                    (dirty.uly == local.lry || dirty.lry == local.uly)) {
-                    DrawMap_DirtyRectangles[i]->uly = std::min(local.uly, dirty.uly);
-                    DrawMap_DirtyRectangles[i]->lry = std::max(local.lry, dirty.lry);
-
-                    return;
-                }
-
-                if (local.uly == dirty.uly && local.lry == dirty.lry &&
-                    (dirty.ulx == local.lrx || dirty.lrx == local.ulx)) {
-                    DrawMap_DirtyRectangles[i]->ulx = std::min(local.ulx, dirty.ulx);
-                    DrawMap_DirtyRectangles[i]->lrx = std::max(local.lrx, dirty.lrx);
-
-                    return;
-                }
-            }
-
-            DrawMap_DirtyRectangles.Append(&local);
-        }
+        DrawMap_DirtyRegion.Add(local);
     }
 }
 
@@ -864,7 +717,7 @@ void DrawMap_RenderMiniMapUnitList(SmartList<UnitInfo>* units) {
                 SDL_assert(grid_x >= 0 && grid_x < ResourceManager_MapSize.x);
                 SDL_assert(grid_y >= 0 && grid_y < ResourceManager_MapSize.y);
 
-                ResourceManager_MinimapUnits[grid_y * ResourceManager_MapSize.x + grid_x] = color;
+                DrawMap_MinimapCache.AddUnitDot(grid_x, grid_y, 1, color);
 
             } else {
                 grid_x = std::min<int32_t>(grid_x, ResourceManager_MapSize.x - 2);
@@ -872,22 +725,39 @@ void DrawMap_RenderMiniMapUnitList(SmartList<UnitInfo>* units) {
 
                 SDL_assert(grid_x >= 0 && grid_y >= 0);
 
-                ResourceManager_MinimapUnits[grid_y * ResourceManager_MapSize.x + grid_x] = color;
-                ResourceManager_MinimapUnits[grid_y * ResourceManager_MapSize.x + grid_x + 1] = color;
-                ResourceManager_MinimapUnits[(grid_y + 1) * ResourceManager_MapSize.x + grid_x] = color;
-                ResourceManager_MinimapUnits[(grid_y + 1) * ResourceManager_MapSize.x + grid_x + 1] = color;
+                DrawMap_MinimapCache.AddUnitDot(grid_x, grid_y, 2, color);
             }
         }
     }
 }
 
 void DrawMap_RenderMiniMap() {
+    DrawMap_MinimapCache.Configure(ResourceManager_MapSize.x, ResourceManager_MapSize.y,
+                                   DrawMap_MinimapCache.GetTargetWidth(), DrawMap_MinimapCache.GetTargetHeight());
+    DrawMap_MinimapCache.ClearUnitDots();
+
     DrawMap_RenderMiniMapUnitList(&UnitsManager_StationaryUnits);
     DrawMap_RenderMiniMapUnitList(&UnitsManager_MobileLandSeaUnits);
     DrawMap_RenderMiniMapUnitList(&UnitsManager_MobileAirUnits);
 }
 
+void DrawMap_InvalidateMinimap() { DrawMap_MinimapCache.Invalidate(); }
+
+void DrawMap_InvalidateMinimapCell(int32_t map_offset) { DrawMap_MinimapCache.InvalidateCell(map_offset); }
+
+void DrawMap_RenderMinimapLayers(uint8_t* buffer, int32_t pitch, int32_t width, int32_t height) {
+    DrawMap_MinimapCache.Configure(ResourceManager_MapSize.x, ResourceManager_MapSize.y, width, height);
+    DrawMap_MinimapCache.Compose(ResourceManager_MinimapFov);
+
+    buf_to_buf(const_cast<uint8_t*>(DrawMap_MinimapCache.GetPixels()), DrawMap_MinimapCache.GetCoveredWidth(),
+               DrawMap_MinimapCache.GetCoveredHeight(), DrawMap_MinimapCache.GetPitch(), buffer, pitch);
+}
+
+const MinimapCacheStatistics& DrawMap_GetMinimapStatistics() { return DrawMap_MinimapCache.GetStatistics(); }
+
 void DrawMap_RenderUnits() {
+    FRAME_PROFILER_SCOPE("RenderUnits");
+
     UnitInfoGroup group;
     WindowInfo* window;
 
@@ -895,8 +765,8 @@ void DrawMap_RenderUnits() {
 
     Gfx_MapWindowBuffer = window->buffer;
 
-    for (int32_t i = DrawMap_DirtyRectangles.GetCount() - 1; i >= 0; --i) {
-        group.ProcessDirtyZone(DrawMap_DirtyRectangles[i]);
+    for (size_t i = 0; i < DrawMap_DirtyRegion.GetCount(); ++i) {
+        group.ProcessDirtyZone(&DrawMap_DirtyRegion[i]);
     }
 
     if (GameManager_RenderMinimapDisplay) {
@@ -996,27 +866,15 @@ void DrawMap_RenderComplexGridOverlay(WindowInfo* window, Rect pixel_bounds, int
 }
 
 void DrawMap_RenderMapTiles(DrawMapBuffer* drawmap, bool display_button_grid) {
-    int32_t index;
-
-    index = DrawMap_DirtyRectangles.GetCount();
+    FRAME_PROFILER_SCOPE("RenderMapTiles");
 
-    if (index > 0) {
+    if (!DrawMap_DirtyRegion.IsEmpty()) {
         WindowInfo* window{WindowManager_GetWindow(WINDOW_MAIN_MAP)};
         Rect dirty;
         Point point;
         uint8_t** buffer;
 
-        --index;
-        dirty = *DrawMap_DirtyRectangles[index];
-
-        for (--index; index >= 0; --index) {
-            Rect pixel_bounds = *DrawMap_DirtyRectangles[index];
-
-            dirty.ulx = std::min(dirty.ulx, pixel_bounds.ulx);
-            dirty.uly = std::min(dirty.uly, pixel_bounds.uly);
-            dirty.lrx = std::max(dirty.lrx, pixel_bounds.lrx);
-            dirty.lry = std::max(dirty.lry, pixel_bounds.lry);
-        }
+        dirty = DrawMap_DirtyRegion.GetBounds();
 
         dirty.ulx /= GFX_MAP_TILE_SIZE;
         dirty.uly /= GFX_MAP_TILE_SIZE;
@@ -1029,8 +887,8 @@ void DrawMap_RenderMapTiles(DrawMapBuffer* drawmap, bool display_button_grid) {
 
         buffer = drawmap->GetBuffer();
 
-        for (int32_t i = DrawMap_DirtyRectangles.GetCount() - 1; i >= 0; --i) {
-            Rect pixel_bounds = *DrawMap_DirtyRectangles[i];
+        for (size_t i = 0; i < DrawMap_DirtyRegion.GetCount(); ++i) {
+            Rect pixel_bounds = DrawMap_DirtyRegion[i];
             Rect grid_bounds;
 
             grid_bounds.ulx = pixel_bounds.ulx / GFX_MAP_TILE_SIZE;
@@ -1103,8 +961,8 @@ void DrawMap_RedrawDirtyZones() {
         DrawMap_RedrawUnit(&*GameManager_SelectedUnit, &DrawMap_Callback2);
     }
 
-    for (int32_t i = DrawMap_DirtyRectangles.GetCount() - 1; i >= 0; --i) {
-        bounds = *DrawMap_DirtyRectangles[i];
+    for (size_t i = 0; i < DrawMap_DirtyRegion.GetCount(); ++i) {
+        bounds = DrawMap_DirtyRegion[i];
 
         bounds.ulx = (bounds.ulx * GFX_SCALE_DENOMINATOR) / Gfx_MapScalingFactor - Gfx_MapWindowUlx;
         bounds.uly = (bounds.uly * GFX_SCALE_DENOMINATOR) / Gfx_MapScalingFactor - Gfx_MapWindowUly;
@@ -1124,7 +982,7 @@ void DrawMap_RedrawDirtyZones() {
         win_draw_rect(window->id, &bounds);
     }
 
-    DrawMap_DirtyRectangles.Clear();
+    DrawMap_DirtyRegion.Clear();
 
     const int32_t map_width = ResourceManager_MapSize.x * Gfx_ZoomLevel;
     const int32_t map_height = ResourceManager_MapSize.y * Gfx_ZoomLevel;
@@ -1169,18 +1027,8 @@ void DrawMap_RedrawDirtyZones() {
     }
 }
 
-bool DrawMap_IsInsideBounds(Rect* bounds) {
-    Rect dirty;
+bool DrawMap_IsInsideBounds(Rect* bounds) { return DrawMap_DirtyRegion.Intersects(*bounds); }
 
-    for (int32_t i = DrawMap_DirtyRectangles.GetCount() - 1; i >= 0; --i) {
-        dirty = *DrawMap_DirtyRectangles[i];
-
-        if (bounds->lrx > dirty.ulx && bounds->ulx < dirty.lrx && bounds->lry > dirty.uly && bounds->uly < dirty.lry) {
-            return 1;
-        }
-    }
-
-    return false;
-}
+void DrawMap_ClearDirtyZones() { DrawMap_DirtyRegion.Clear(); }
 
-void DrawMap_ClearDirtyZones() { DrawMap_DirtyRectangles.Clear(); }
+const DirtyRegion& DrawMap_GetDirtyRegion() { return DrawMap_DirtyRegion; }
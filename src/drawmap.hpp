@@ -22,7 +22,9 @@
 #ifndef DRAWMAP_HPP
 #define DRAWMAP_HPP
 
+#include "dirtyregion.hpp"
 #include "gnw.h"
+#include "minimapcache.hpp"
 #include "unitinfogroup.hpp"
 
 class DrawMapBuffer {
@@ -53,5 +55,10 @@ void DrawMap_RenderSurveyDisplay(DrawMapBuffer* drawmap);
 void DrawMap_RedrawDirtyZones();
 bool DrawMap_IsInsideBounds(Rect* bounds);
 void DrawMap_ClearDirtyZones();
+const DirtyRegion& DrawMap_GetDirtyRegion();
+void DrawMap_InvalidateMinimap();
+void DrawMap_InvalidateMinimapCell(int32_t map_offset);
+void DrawMap_RenderMinimapLayers(uint8_t* buffer, int32_t pitch, int32_t width, int32_t height);
+const MinimapCacheStatistics& DrawMap_GetMinimapStatistics();
 
 #endif /* DRAWMAP_HPP */
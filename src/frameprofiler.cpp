@@ -0,0 +1,205 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "frameprofiler.hpp"
+
+#include <SDL3/SDL_assert.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+FrameProfiler::FrameProfiler()
+    : m_enabled(false),
+      m_depth(0),
+      m_overflow_depth(0),
+      m_current{},
+      m_frame_head(0),
+      m_frame_count(0),
+      m_trace_head(0),
+      m_trace_count(0) {}
+
+void FrameProfiler::SetEnabled(bool enabled) {
+    if (enabled) {
+        m_owner = std::this_thread::get_id();
+        m_depth = 0;
+        m_overflow_depth = 0;
+        m_frames.assign(FRAME_HISTORY, Frame{});
+        m_frame_head = 0;
+        m_frame_count = 0;
+        m_trace.resize(TRACE_CAPACITY);
+        m_trace_head = 0;
+        m_trace_count = 0;
+
+        memset(&m_current, 0, sizeof(m_current));
+        m_current.start_ns = GetTime();
+    }
+
+    m_enabled = enabled;
+}
+
+uint32_t FrameProfiler::GetSectionId(const char* name) {
+    for (uint32_t i = 0; i < m_names.size(); ++i) {
+        if (m_names[i] == name) {
+            return i;
+        }
+    }
+
+    if (m_names.size() >= MAX_SECTIONS) {
+        return INVALID_SECTION;
+    }
+
+    m_names.emplace_back(name);
+
+    return static_cast<uint32_t>(m_names.size() - 1);
+}
+
+bool FrameProfiler::BeginScope(uint32_t section, uint64_t now_ns) noexcept {
+    if (!m_enabled || section >= MAX_SECTIONS || std::this_thread::get_id() != m_owner) {
+        return false;
+    }
+
+    // scopes nested deeper than the stack are not timed separately, their time stays with the enclosing scope
+    if (m_depth == MAX_DEPTH) {
+        ++m_overflow_depth;
+
+    } else {
+        m_scopes[m_depth] = {section, now_ns, 0};
+        ++m_depth;
+    }
+
+    return true;
+}
+
+void FrameProfiler::EndScope(uint64_t now_ns) noexcept {
+    if (m_overflow_depth > 0) {
+        --m_overflow_depth;
+
+        return;
+    }
+
+    // SetEnabled() may have reset the stack while scopes were open
+    if (m_depth == 0) {
+        return;
+    }
+
+    --m_depth;
+
+    const OpenScope& scope = m_scopes[m_depth];
+    const uint64_t duration = now_ns > scope.start_ns ? now_ns - scope.start_ns : 0;
+    const uint64_t self = duration > scope.child_ns ? duration - scope.child_ns : 0;
+
+    m_current.section_ns[scope.section] += self;
+    ++m_current.section_calls[scope.section];
+
+    if (m_depth > 0) {
+        m_scopes[m_depth - 1].child_ns += duration;
+    }
+
+    AddTraceEvent({scope.start_ns, duration, scope.section, m_depth});
+}
+
+void FrameProfiler::MarkFrame(uint64_t now_ns) noexcept {
+    if (!m_enabled) {
+        return;
+    }
+
+    m_current.duration_ns = now_ns > m_current.start_ns ? now_ns - m_current.start_ns : 0;
+
+    m_frame_head = (m_frame_head + 1) % FRAME_HISTORY;
+    m_frames[m_frame_head] = m_current;
+
+    if (m_frame_count < FRAME_HISTORY) {
+        ++m_frame_count;
+    }
+
+    memset(&m_current, 0, sizeof(m_current));
+    m_current.start_ns = now_ns;
+
+    AddTraceEvent({now_ns, 0, INVALID_SECTION, 0});
+}
+
+const FrameProfiler::Frame& FrameProfiler::GetFrame(uint32_t age) const noexcept {
+    SDL_assert(age < m_frame_count);
+
+    return m_frames[(m_frame_head + FRAME_HISTORY - age) % FRAME_HISTORY];
+}
+
+void FrameProfiler::AddTraceEvent(const TraceEvent& event) noexcept {
+    m_trace[m_trace_head] = event;
+    m_trace_head = (m_trace_head + 1) % TRACE_CAPACITY;
+
+    if (m_trace_count < TRACE_CAPACITY) {
+        ++m_trace_count;
+    }
+}
+
+bool FrameProfiler::WriteChromeTrace(std::ostream& stream) const {
+    const size_t first = (m_trace_head + TRACE_CAPACITY - m_trace_count) % TRACE_CAPACITY;
+    char line[256];
+
+    stream << "{\"traceEvents\":[";
+
+    for (size_t i = 0; i < m_trace_count; ++i) {
+        const TraceEvent& event = m_trace[(first + i) % TRACE_CAPACITY];
+
+        if (event.section == INVALID_SECTION) {
+            std::snprintf(line, sizeof(line),
+                          "%s\n{\"name\":\"Frame\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%.3f,\"pid\":1,\"tid\":1}",
+                          i ? "," : "", static_cast<double>(event.start_ns) / 1000.);
+
+            stream << line;
+
+        } else {
+            stream << (i ? ",\n" : "\n") << "{\"name\":\"";
+
+            // section names are identifiers in practice, escape anyway to always produce valid JSON
+            for (const char c : m_names[event.section]) {
+                if (c == '"' || c == '\\') {
+                    stream << '\\';
+                }
+
+                stream << c;
+            }
+
+            std::snprintf(line, sizeof(line), "\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":1}",
+                          static_cast<double>(event.start_ns) / 1000., static_cast<double>(event.duration_ns) / 1000.);
+
+            stream << line;
+        }
+    }
+
+    stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    return stream.good();
+}
+
+uint64_t FrameProfiler::GetTime() noexcept {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+FrameProfiler& FrameProfiler_Get() {
+    static FrameProfiler FrameProfiler_Instance;
+
+    return FrameProfiler_Instance;
+}
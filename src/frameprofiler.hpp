@@ -0,0 +1,205 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef FRAMEPROFILER_HPP
+#define FRAMEPROFILER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * \class FrameProfiler
+ * \brief Aggregates the time spent in named code sections per presented frame and records a trace of every scope.
+ *
+ * Sections are registered once by name and timed by nested Begin / End pairs, usually through FRAME_PROFILER_SCOPE().
+ * The time of a scope minus the time of the scopes nested in it is its self time, so the per section times of a frame
+ * add up to at most the frame time and can be drawn as a stacked graph. MarkFrame() closes the current frame into a
+ * ring buffer of the last FRAME_HISTORY frames. Each completed scope is also appended to a ring buffer of trace events
+ * that can be written as a Chrome trace (chrome://tracing, Perfetto) for offline analysis.
+ *
+ * Only the thread that enabled the profiler records, scopes entered on other threads are ignored. A disabled profiler
+ * costs a flag test per scope.
+ */
+class FrameProfiler {
+public:
+    static constexpr uint32_t MAX_SECTIONS = 32;
+    static constexpr uint32_t MAX_DEPTH = 16;
+    static constexpr uint32_t FRAME_HISTORY = 128;
+    static constexpr uint32_t TRACE_CAPACITY = 65536;
+    static constexpr uint32_t INVALID_SECTION = UINT32_MAX;
+
+    struct Frame {
+        uint64_t start_ns;
+        uint64_t duration_ns;
+        uint64_t section_ns[MAX_SECTIONS];
+        uint32_t section_calls[MAX_SECTIONS];
+    };
+
+    struct TraceEvent {
+        uint64_t start_ns;
+        uint64_t duration_ns;
+        /// Timed section or INVALID_SECTION for a frame boundary.
+        uint32_t section;
+        uint32_t depth;
+    };
+
+    FrameProfiler();
+
+    /**
+     * \brief Starts or stops recording. Starting drops the recorded frames and trace events.
+     *
+     * \param enabled True to record on the calling thread.
+     */
+    void SetEnabled(bool enabled);
+
+    /**
+     * \brief Gets the identifier of a section, registering the name on first use.
+     *
+     * \param name Section name. The text is copied.
+     * \return Section identifier or INVALID_SECTION if MAX_SECTIONS sections are registered already.
+     */
+    uint32_t GetSectionId(const char* name);
+
+    /**
+     * \brief Opens a scope of a section.
+     *
+     * \param section Section identifier.
+     * \param now_ns Current time in nanoseconds.
+     * \return True if the scope is recorded and must be closed by EndScope().
+     */
+    bool BeginScope(uint32_t section, uint64_t now_ns) noexcept;
+
+    /**
+     * \brief Closes the innermost open scope.
+     *
+     * \param now_ns Current time in nanoseconds.
+     */
+    void EndScope(uint64_t now_ns) noexcept;
+
+    /**
+     * \brief Closes the current frame and starts the next one. Scopes that are still open are accounted to the frame
+     * in which they end.
+     *
+     * \param now_ns Current time in nanoseconds.
+     */
+    void MarkFrame(uint64_t now_ns) noexcept;
+
+    /**
+     * \brief Gets a recorded frame.
+     *
+     * \param age 0 for the last completed frame, up to GetFrameCount() - 1 for the oldest one.
+     * \return Frame record.
+     */
+    [[nodiscard]] const Frame& GetFrame(uint32_t age) const noexcept;
+
+    /**
+     * \brief Writes the recorded trace events in Chrome trace event JSON format.
+     *
+     * \param stream Output stream.
+     * \return True if the stream is still good after writing.
+     */
+    bool WriteChromeTrace(std::ostream& stream) const;
+
+    [[nodiscard]] static uint64_t GetTime() noexcept;
+
+    [[nodiscard]] inline bool IsEnabled() const noexcept { return m_enabled; }
+    [[nodiscard]] inline uint32_t GetFrameCount() const noexcept { return m_frame_count; }
+    [[nodiscard]] inline uint32_t GetSectionCount() const noexcept { return static_cast<uint32_t>(m_names.size()); }
+    [[nodiscard]] inline const std::string& GetSectionName(uint32_t section) const noexcept {
+        return m_names[section];
+    }
+    [[nodiscard]] inline size_t GetTraceEventCount() const noexcept { return m_trace_count; }
+
+private:
+    struct OpenScope {
+        uint32_t section;
+        uint64_t start_ns;
+        uint64_t child_ns;
+    };
+
+    bool m_enabled;
+    std::thread::id m_owner;
+    std::vector<std::string> m_names;
+
+    OpenScope m_scopes[MAX_DEPTH];
+    uint32_t m_depth;
+    uint32_t m_overflow_depth;
+
+    Frame m_current;
+    std::vector<Frame> m_frames;
+    uint32_t m_frame_head;
+    uint32_t m_frame_count;
+
+    std::vector<TraceEvent> m_trace;
+    size_t m_trace_head;
+    size_t m_trace_count;
+
+    void AddTraceEvent(const TraceEvent& event) noexcept;
+};
+
+/**
+ * \brief Gets the profiler of the game loop.
+ *
+ * \return Process wide profiler instance.
+ */
+FrameProfiler& FrameProfiler_Get();
+
+/**
+ * \class FrameProfilerScope
+ * \brief Times the enclosing block as a section of the game loop profiler.
+ */
+class FrameProfilerScope {
+    bool m_active;
+
+public:
+    explicit FrameProfilerScope(uint32_t section) noexcept {
+        FrameProfiler& profiler = FrameProfiler_Get();
+
+        m_active = profiler.IsEnabled() && profiler.BeginScope(section, FrameProfiler::GetTime());
+    }
+
+    ~FrameProfilerScope() {
+        if (m_active) {
+            FrameProfiler_Get().EndScope(FrameProfiler::GetTime());
+        }
+    }
+
+    FrameProfilerScope(const FrameProfilerScope&) = delete;
+    FrameProfilerScope& operator=(const FrameProfilerScope&) = delete;
+};
+
+#define FRAME_PROFILER_CONCAT2(a, b) a##b
+#define FRAME_PROFILER_CONCAT(a, b) FRAME_PROFILER_CONCAT2(a, b)
+
+/**
+ * \brief Times the rest of the enclosing block as the named section of the game loop profiler.
+ */
+#define FRAME_PROFILER_SCOPE(name)                                                                                     \
+    static const uint32_t FRAME_PROFILER_CONCAT(FrameProfiler_Section, __LINE__) =                                     \
+        FrameProfiler_Get().GetSectionId(name);                                                                        \
+    FrameProfilerScope FRAME_PROFILER_CONCAT(FrameProfiler_Scope, __LINE__)(                                           \
+        FRAME_PROFILER_CONCAT(FrameProfiler_Section, __LINE__))
+
+#endif /* FRAMEPROFILER_HPP */
@@ -36,6 +36,7 @@
 #include "cursor.hpp"
 #include "drawmap.hpp"
 #include "flicsmgr.hpp"
+#include "frameprofiler.hpp"
 #include "gfx.hpp"
 #include "hash.hpp"
 #include "helpmenu.hpp"
@@ -45,6 +46,7 @@
 #include "missionmanager.hpp"
 #include "mouseevent.hpp"
 #include "movie.hpp"
+#include "objectpool.hpp"
 #include "paths.hpp"
 #include "paths_manager.hpp"
 #include "production_manager.hpp"
@@ -575,6 +577,19 @@ bool GameManager_TeamTurnFinish(uint32_t turn_counter_session_start, uint16_t te
     if (GameManager_GameState == GAME_STATE_9_END_TURN) {
         AILOG(log, "End turn {}.", GameManager_TurnCounter);
 
+        // the pool counters cover one game turn, the turns of all teams included
+        if (AiLog_IsEnabled()) {
+            ObjectPool::ForEach([&](ObjectPool& pool) {
+                [[maybe_unused]] const ObjectPoolStatistics statistics = pool.GetTurnStatistics();
+
+                AILOG_LOG(log, "{} pool: {} allocations ({} recycled), {} releases, {} new slabs, {} live, {} peak",
+                          pool.GetName(), statistics.allocations, statistics.recycled_allocations, statistics.releases,
+                          statistics.slabs, statistics.live_objects, statistics.peak_live_objects);
+            });
+        }
+
+        ObjectPool::ResetTurnStatistics();
+
         GameManager_GameState = GAME_STATE_8_IN_GAME;
 
         AILOG_LOG(log, "Checking victory conditions.");
@@ -637,6 +652,9 @@ void GameManager_GameLoop(int32_t game_state) {
 
     turn_counter_session_start = GameManager_TurnCounter;
 
+    // allocations of the game setup are not churn of the first turn
+    ObjectPool::ResetTurnStatistics();
+
     while (GameManager_GameState == GAME_STATE_8_IN_GAME) {
         team_winner = GameManager_EvaluateWinner();
         GameManager_DrawTurnCounter(GameManager_TurnCounter);
@@ -1035,14 +1053,15 @@ void GameManager_RenderMinimap() {
         buf_to_buf(ResourceManager_MinimapBgImage, mmw_width, mmw_height, mmw_width, mmw->buffer, mmw->width);
 
         if (map_size.x == ResourceManager_MinimapWindowSize.x && map_size.y == ResourceManager_MinimapWindowSize.y) {
-            buf_to_buf(ResourceManager_MinimapUnits, map_size.x, map_size.y, map_size.x, mmw->buffer, mmw->width);
+            DrawMap_RenderMinimapLayers(mmw->buffer, mmw->width, map_size.x, map_size.y);
 
         } else {
-            cscale(ResourceManager_MinimapUnits, map_size.x, map_size.y, map_size.x,
-                   &mmw->buffer[ResourceManager_MinimapWindowOffset.y * mmw->width +
-                                ResourceManager_MinimapWindowOffset.x],
-                   mmw_width - ResourceManager_MinimapWindowOffset.x * 2,
-                   mmw_height - ResourceManager_MinimapWindowOffset.y * 2, mmw->width);
+            const int32_t offset{ResourceManager_MinimapWindowOffset.y * mmw->width +
+                                 ResourceManager_MinimapWindowOffset.x};
+
+            DrawMap_RenderMinimapLayers(&mmw->buffer[offset], mmw->width,
+                                        mmw_width - ResourceManager_MinimapWindowOffset.x * 2,
+                                        mmw_height - ResourceManager_MinimapWindowOffset.y * 2);
         }
 
         draw_box(
@@ -1102,17 +1121,14 @@ void GameManager_RenderMap() {
 
     DrawMap_RenderBuildMarker();
 
-    if (GameManager_RenderFlag1) {
-        if (GameManager_RenderMinimapDisplay) {
-            if (GameManager_GameState == GAME_STATE_7_SITE_SELECT ||
-                GameManager_GameState == GAME_STATE_12_DEPLOYING_UNITS ||
-                GameManager_GameState == GAME_STATE_13_SITE_SELECTED) {
-                GameManager_RenderMinimapDisplay = false;
+    TacticalOverlay_UpdateFrameProfileBounds();
 
-            } else {
-                memcpy(ResourceManager_MinimapUnits, ResourceManager_MinimapFov,
-                       ResourceManager_MapSize.x * ResourceManager_MapSize.y);
-            }
+    if (GameManager_RenderFlag1) {
+        // the minimap cache keeps the terrain and fog layer, only the unit dots are rebuilt by DrawMap_RenderUnits()
+        if (GameManager_RenderMinimapDisplay && (GameManager_GameState == GAME_STATE_7_SITE_SELECT ||
+                                                 GameManager_GameState == GAME_STATE_12_DEPLOYING_UNITS ||
+                                                 GameManager_GameState == GAME_STATE_13_SITE_SELECTED)) {
+            GameManager_RenderMinimapDisplay = false;
         }
 
         if (GameManager_RenderEnable) {
@@ -1167,6 +1183,8 @@ void GameManager_RenderMap() {
 
         if (GameManager_HumanPlayerCount && GameManager_GameState == GAME_STATE_11_TURN_ACTIVE &&
             GameManager_ActiveTurnTeam != GameManager_PlayerTeam) {
+            TacticalOverlay_RenderFrameProfile();
+
             DrawMap_RedrawDirtyZones();
 
             GameManager_RenderMinimapDisplay = false;
@@ -1189,6 +1207,8 @@ void GameManager_RenderMap() {
             TacticalOverlay_Render();
 #endif /* !defined(NDEBUG) */
 
+            TacticalOverlay_RenderFrameProfile();
+
             GameManager_RenderScanRangeIndicators();
 
             if (is_message_box_active) {
@@ -2471,7 +2491,7 @@ void GameManager_UpdateGui(uint16_t team, int32_t game_state, bool enable_autosa
 
             snprintf(log_message, sizeof(log_message), _(263f), GameManager_TurnCounter);
 
-            SaveLoadMenu_Save(file_name.c_str(), log_message, false, true);
+            SaveLoadMenu_Save(file_name.c_str(), log_message, false, true, true);
         }
 
         if (GameManager_ActiveTurnTeam == GameManager_PlayerTeam) {
@@ -5061,6 +5081,8 @@ void GameManager_ProcessState(bool process_tick, bool clear_mouse_events) {
 }
 
 bool GameManager_ProcessTick(bool render_screen) {
+    FRAME_PROFILER_SCOPE("ProcessTick");
+
     uint64_t time_stamp;
     bool result;
 
@@ -5546,6 +5568,21 @@ void GameManager_ProcessKey() {
         } break;
 #endif /* !defined(NDEBUG) */
 
+        case GNW_KB_KEY_CTRL_F4: {
+            TacticalOverlay_ToggleFrameProfile();
+            GameManager_UpdateDrawBounds();
+        } break;
+
+        case GNW_KB_KEY_CTRL_F5: {
+            if (TacticalOverlay_SaveFrameTrace()) {
+                MessageManager_DrawMessage("Frame trace saved to frame_trace.json.", MESSAGE_BOX_INFO,
+                                           MESSAGE_BOX_MODELESS);
+
+            } else {
+                MessageManager_DrawMessage("Failed to save frame trace.", MESSAGE_BOX_WARNING, MESSAGE_BOX_MODELESS);
+            }
+        } break;
+
         case GNW_KB_KEY_CTRL_1:
         case GNW_KB_KEY_CTRL_2:
         case GNW_KB_KEY_CTRL_3:
@@ -21,7 +21,14 @@
 
 #include "gfx.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "bandrenderer.hpp"
+#include "maptilecache.hpp"
 #include "resource_manager.hpp"
+#include "spritecache.hpp"
 #include "window_manager.hpp"
 #include "world.hpp"
 
@@ -58,6 +65,9 @@ uint32_t Gfx_ScalingFactorWidth;
 uint32_t Gfx_ScalingFactorHeight;
 int32_t Gfx_TargetScreenBufferOffset;
 
+static uint16_t Gfx_FrameScaledWidth;
+static uint16_t Gfx_FrameScaledHeight;
+
 const Rect Gfx_DirectionCorrections[8] = {
     {1, 0, 0, 1},   {0, -1, -1, 0}, {0, 1, -1, 0}, {1, 0, 0, -1},
     {-1, 0, 0, -1}, {0, 1, 1, 0},   {0, -1, 1, 0}, {-1, 0, 0, 1},
@@ -107,6 +117,8 @@ bool Gfx_DecodeSpriteSetup(Point point, uint8_t* buffer, int32_t divisor, Rect*
             Gfx_ScaledHeight = 2;
         }
 
+        Gfx_FrameScaledWidth = Gfx_ScaledWidth;
+        Gfx_FrameScaledHeight = Gfx_ScaledHeight;
         Gfx_ScalingFactorWidth = (((width - 1) << GFX_SCALE_BASE) / (Gfx_ScaledWidth - 1)) + 8;
         Gfx_ScalingFactorHeight = (((height - 1) << GFX_SCALE_BASE) / (Gfx_ScaledHeight - 1)) + 8;
         Gfx_ScaledOffset.x = target_bounds.ulx - scaled_bounds.ulx;
@@ -122,11 +134,51 @@ bool Gfx_DecodeSpriteSetup(Point point, uint8_t* buffer, int32_t divisor, Rect*
     return result;
 }
 
+static MapTileCache& Gfx_GetMapTileCache() {
+    static MapTileCache cache(GFX_MAP_TILE_CACHE_SIZE);
+
+    return cache;
+}
+
+static BandRenderer& Gfx_GetBandRenderer() {
+    static BandRenderer renderer;
+    static bool is_started{false};
+
+    if (!is_started) {
+        const int32_t core_count{SDL_GetNumLogicalCPUCores()};
+
+        renderer.Start(std::clamp<int32_t>(core_count - 1, 0, GFX_BAND_RENDERER_MAX_THREADS));
+
+        is_started = true;
+    }
+
+    return renderer;
+}
+
+static void Gfx_BlitMapTileRows(const MapTileRegion& region, const int32_t first_row, const int32_t last_row) {
+    const int32_t row_count{last_row - first_row};
+    const int32_t tile_pixels{static_cast<int32_t>(region.zoom_level * region.zoom_level)};
+    const int32_t pixel_count{row_count * region.tile_count_x * tile_pixels};
+
+    if (row_count > 1 && pixel_count >= GFX_BAND_RENDERER_MIN_PIXELS) {
+        // each band is one tile row, the rows of a band are contiguous in the window buffer
+        Gfx_GetBandRenderer().Run(row_count, [&region, first_row](int32_t band) {
+            MapTileCache_BlitRows(region, first_row + band, first_row + band + 1, Gfx_MapWindowBuffer,
+                                  WindowManager_WindowWidth);
+        });
+
+    } else {
+        MapTileCache_BlitRows(region, first_row, last_row, Gfx_MapWindowBuffer, WindowManager_WindowWidth);
+    }
+}
+
+void Gfx_InvalidateMapTileCache() { Gfx_GetMapTileCache().Invalidate(); }
+
+const MapTileCacheStatistics& Gfx_GetMapTileCacheStatistics() { return Gfx_GetMapTileCache().GetStatistics(); }
+
 void Gfx_DecodeMapTile(const Rect* const pixel_bounds, const uint32_t tile_size, const uint32_t tile_base,
                        const uint8_t quotient) {
     if (pixel_bounds->lry - 1 > pixel_bounds->uly && pixel_bounds->lrx - 1 > pixel_bounds->ulx) {
-        const uint32_t map_tile_zoom_factor{(((tile_size - 1) << GFX_SCALE_BASE) / (Gfx_ZoomLevel - 1)) + 8};
-
         const ColorIndex* color_table{&ResourceManager_BrightnessColorIndexTable[(Gfx_MapBrightness & (~31)) * 8]};
 
         const Rect clipped_bounds = {.ulx = pixel_bounds->ulx & (~63),
@@ -140,207 +192,94 @@ void Gfx_DecodeMapTile(const Rect* const pixel_bounds, const uint32_t tile_size,
 
         const int32_t scaling_error_ulx = Gfx_ScaleInt32(pixel_bounds->ulx) - Gfx_ScaleInt32(clipped_bounds.ulx);
 
-        const int32_t scaling_error_ulx_factor = scaling_error_ulx * map_tile_zoom_factor;
-
         const int32_t scaling_error_uly = Gfx_ScaleInt32(pixel_bounds->uly) - Gfx_ScaleInt32(clipped_bounds.uly);
 
-        const int32_t scaling_error_uly_factor = scaling_error_uly * map_tile_zoom_factor;
-
         const int32_t scaling_error_lrx = Gfx_ScaleInt32(clipped_bounds.lrx) - Gfx_ScaleInt32(pixel_bounds->lrx - 1);
 
         const int32_t scaling_error_lry = Gfx_ScaleInt32(clipped_bounds.lry) - Gfx_ScaleInt32(pixel_bounds->lry - 1);
 
-        uint8_t* map_buffer{Gfx_MapWindowBuffer};
-        int32_t tile_position{0};
-
-        for (int32_t y{tile_count_y}; y > 0; --y) {
-            uint32_t tile_stride_y{Gfx_ZoomLevel};
-            int32_t offset_y{0};
-            uint8_t* map_address_y{map_buffer};
+        const World* world = ResourceManager_GetActiveWorld();
+        const uint8_t* const world_tiles{world->GetTileBuffer()};
+        const uint16_t* const world_tile_ids{world->GetTileIds()};
+        const uint32_t world_tile_count{world->GetTileCount()};
+        MapTileCache& cache{Gfx_GetMapTileCache()};
 
-            if (y == tile_count_y) {
-                tile_stride_y -= scaling_error_uly;
-                offset_y = scaling_error_uly_factor;
-            }
-
-            if (y == 1) {
-                tile_stride_y -= scaling_error_lry;
-            }
+        // scaled tile pointers are resolved on the main thread as the cache is not thread safe
+        static std::vector<const uint8_t*> tiles;
 
-            map_buffer = &map_buffer[WindowManager_WindowWidth * tile_stride_y];
+        tiles.resize(tile_count_x * tile_count_y);
 
-            for (int32_t x{tile_count_x}; x > 0; --x) {
-                const World* world = ResourceManager_GetActiveWorld();
-                uint8_t* const tile_buffer{const_cast<uint8_t*>(
-                    &world->GetTileBuffer()[world->GetTileIds()[tile_base + tile_position] << quotient])};
-                uint8_t* map_tile_buffer = &tile_buffer[(offset_y >> GFX_SCALE_BASE) << (quotient >> 1)];
+        const MapTileRegion region{.tiles = tiles.data(),
+                                   .tile_count_x = tile_count_x,
+                                   .tile_count_y = tile_count_y,
+                                   .zoom_level = Gfx_ZoomLevel,
+                                   .clip_left = static_cast<uint32_t>(scaling_error_ulx),
+                                   .clip_top = static_cast<uint32_t>(scaling_error_uly),
+                                   .clip_right = static_cast<uint32_t>(scaling_error_lrx),
+                                   .clip_bottom = static_cast<uint32_t>(scaling_error_lry)};
 
-                uint32_t tile_stride_x{Gfx_ZoomLevel};
-                int32_t offset_x{0};
-                uint8_t* map_address_x{map_address_y};
+        int32_t tile_position{0};
+        int32_t first_pending_row{0};
 
-                if (x == tile_count_x) {
-                    tile_stride_x -= scaling_error_ulx;
-                    offset_x = scaling_error_ulx_factor;
-                }
+        SDL_assert((tile_size * tile_size) == (1u << quotient));
 
-                if (x == 1) {
-                    tile_stride_x -= scaling_error_lrx;
-                }
+        for (int32_t row{0}; row < tile_count_y; ++row) {
+            // copy the resolved rows before the least recently used cache slots could be reused for the next row
+            if (row > first_pending_row &&
+                static_cast<uint32_t>((row - first_pending_row + 1) * tile_count_x) > cache.GetCapacity()) {
+                Gfx_BlitMapTileRows(region, first_pending_row, row);
 
-                map_address_y = &map_address_y[tile_stride_x];
-
-                for (uint32_t j{0}; j < tile_stride_y; ++j) {
-                    for (uint32_t i{0}; i < tile_stride_x; ++i) {
-                        map_address_x[i] =
-                            color_table[map_tile_buffer[(offset_x + i * map_tile_zoom_factor) >> GFX_SCALE_BASE]];
-                    }
+                first_pending_row = row;
+            }
 
-                    map_address_x = &map_address_x[WindowManager_WindowWidth];
-                    map_tile_buffer = &tile_buffer[((offset_y + (j + 1) * map_tile_zoom_factor) >> GFX_SCALE_BASE)
-                                                   << (quotient >> 1)];
-                }
+            for (int32_t column{0}; column < tile_count_x; ++column) {
+                // tiles are resampled once per zoom level and brightness, scrolling only copies rows of cached tiles
+                tiles[row * tile_count_x + column] =
+                    cache.GetTile(world_tiles, world_tile_count, world_tile_ids[tile_base + tile_position], tile_size,
+                                  Gfx_ZoomLevel, color_table);
 
                 ++tile_position;
             }
 
+            SDL_assert(static_cast<uint32_t>(tile_count_x) <= cache.GetCapacity());
+
             tile_position += ResourceManager_MapSize.x - tile_count_x;
         }
+
+        Gfx_BlitMapTileRows(region, first_pending_row, tile_count_y);
     }
 }
 
-void Gfx_DecodeSprite() {
-    const ColorIndex* color_table{&ResourceManager_BrightnessColorIndexTable[(Gfx_UnitBrightnessBase & (~31)) * 8]};
+static SpriteCache& Gfx_GetSpriteCache() {
+    static SpriteCache cache(GFX_SPRITE_CACHE_SIZE);
 
-    for (uint32_t Gfx_SpriteRowIndex = Gfx_ScaledOffset.y * Gfx_ScalingFactorHeight;;
-         Gfx_SpriteRowIndex += Gfx_ScalingFactorHeight) {
-        uint8_t* Gfx_SpriteRowAddress =
-            &Gfx_ResourceBuffer[Gfx_SpriteRowAddresses[Gfx_SpriteRowIndex >> GFX_SCALE_BASE]];
-        uint32_t offset = Gfx_TargetScreenBufferOffset;
-        int16_t Gfx_PixelCount = 0;
-        int16_t Gfx_word_1686D6 = 0;
-        int16_t Gfx_word_1686D8 = Gfx_ScaledOffset.x;
-        int16_t Gfx_word_1686DA = Gfx_ScaledWidth;
-        constexpr uint8_t row_delimiter = 0xFF;
-        int32_t ebp;
-
-        for (;;) {
-            if (*Gfx_SpriteRowAddress == row_delimiter) {
-                Gfx_TargetScreenBufferOffset += WindowManager_WindowWidth;
-
-                if (!--Gfx_ScaledHeight) {
-                    return;
-                }
-
-                break;
-
-            } else {
-                int32_t temp;
-                const int32_t transparent_count = *Gfx_SpriteRowAddress++;
-                const int32_t pixel_count = *Gfx_SpriteRowAddress++;
-
-                uint8_t* row_address = Gfx_SpriteRowAddress;
-                Gfx_SpriteRowAddress += pixel_count;
-                Gfx_PixelCount += transparent_count;
-
-                if (Gfx_PixelCount) {
-                    temp = (((Gfx_PixelCount << GFX_SCALE_BASE) / Gfx_ScalingFactorWidth) + 1) - Gfx_word_1686D6;
-                    Gfx_word_1686D6 += temp;
-
-                    if (Gfx_word_1686D8) {
-                        Gfx_word_1686D8 -= temp;
-
-                        if (Gfx_word_1686D8 < 0) {
-                            temp = -Gfx_word_1686D8;
-                            Gfx_word_1686D8 = 0;
-
-                            Gfx_word_1686DA -= temp;
-
-                            if (Gfx_word_1686DA > 0) {
-                                offset += temp;
-
-                            } else {
-                                Gfx_TargetScreenBufferOffset += WindowManager_WindowWidth;
-
-                                if (!--Gfx_ScaledHeight) {
-                                    return;
-                                }
-
-                                break;
-                            }
-                        }
-
-                    } else {
-                        Gfx_word_1686DA -= temp;
-
-                        if (Gfx_word_1686DA > 0) {
-                            offset += temp;
-
-                        } else {
-                            Gfx_TargetScreenBufferOffset += WindowManager_WindowWidth;
-
-                            if (!--Gfx_ScaledHeight) {
-                                return;
-                            }
-
-                            break;
-                        }
-                    }
-                }
-
-                row_address -= Gfx_PixelCount;
-                Gfx_PixelCount += pixel_count;
-                ebp = Gfx_word_1686D6;
-                temp = (((Gfx_PixelCount << GFX_SCALE_BASE) / Gfx_ScalingFactorWidth) + 1) - ebp;
-                Gfx_word_1686D6 += temp;
-
-                if (Gfx_word_1686D8) {
-                    Gfx_word_1686D8 -= temp;
+    return cache;
+}
 
-                    if (Gfx_word_1686D8 >= 0) {
-                        continue;
+void Gfx_InvalidateSpriteCache() { Gfx_GetSpriteCache().Invalidate(); }
 
-                    } else {
-                        ebp += Gfx_word_1686D8 + temp;
-                        temp = -Gfx_word_1686D8;
-                        Gfx_word_1686D8 = 0;
-                    }
-                }
+const SpriteCacheStatistics& Gfx_GetSpriteCacheStatistics() { return Gfx_GetSpriteCache().GetStatistics(); }
 
-                Gfx_word_1686DA -= temp;
+size_t Gfx_GetSpriteCacheByteCount() { return Gfx_GetSpriteCache().GetByteCount(); }
 
-                if (Gfx_word_1686DA < 0) {
-                    temp += Gfx_word_1686DA;
-                    Gfx_word_1686DA = 0;
-                }
-
-                if (temp) {
-                    uint8_t* address;
-                    address = &Gfx_MapWindowBuffer[offset];
-
-                    if (Gfx_TeamColorIndexBase) {
-                        memset(address,
-                               reinterpret_cast<uint8_t*>(
-                                   (reinterpret_cast<uintptr_t>(color_table) & ~0xFF))[Gfx_TeamColorIndexBase],
-                               temp);
-                        offset += temp;
-                    } else {
-                        ebp *= Gfx_ScalingFactorWidth;
-
-                        for (int32_t i = 0; i < temp; ++i) {
-                            address[i] = reinterpret_cast<uint8_t*>(
-                                (reinterpret_cast<uintptr_t>(color_table) &
-                                 ~0xFF))[reinterpret_cast<uint8_t*>((reinterpret_cast<uintptr_t>(Gfx_ColorIndices) &
-                                                                     ~0xFF))[row_address[ebp >> GFX_SCALE_BASE]]];
-                            ebp += Gfx_ScalingFactorWidth;
-                        }
+void Gfx_DecodeSprite() {
+    const ColorIndex* color_table{&ResourceManager_BrightnessColorIndexTable[(Gfx_UnitBrightnessBase & (~31)) * 8]};
 
-                        offset += temp;
-                    }
-                }
-            }
-        }
-    }
+    // the same unit type, frame, zoom level, brightness and team colors are drawn many times, decode each combination
+    // once and copy the clipped area of the decoded frame
+    const SpriteCacheSource source{
+        .resource_buffer = Gfx_ResourceBuffer,
+        .row_offsets = Gfx_SpriteRowAddresses,
+        .scaling_factor_width = Gfx_ScalingFactorWidth,
+        .scaling_factor_height = Gfx_ScalingFactorHeight,
+        .scaled_width = Gfx_FrameScaledWidth,
+        .scaled_height = Gfx_FrameScaledHeight,
+        .color_indices = reinterpret_cast<uint8_t*>(reinterpret_cast<uintptr_t>(Gfx_ColorIndices) & ~0xFF),
+        .color_table = reinterpret_cast<const uint8_t*>(reinterpret_cast<uintptr_t>(color_table) & ~0xFF),
+        .team_color = Gfx_TeamColorIndexBase};
+
+    SpriteCache_Blit(Gfx_GetSpriteCache().GetFrame(source), Gfx_ScaledOffset.x, Gfx_ScaledOffset.y, Gfx_ScaledWidth,
+                     Gfx_ScaledHeight, &Gfx_MapWindowBuffer[Gfx_TargetScreenBufferOffset], WindowManager_WindowWidth);
 }
 
 void Gfx_DecodeShadow() {
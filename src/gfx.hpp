@@ -23,7 +23,9 @@
 #define GFX_HPP
 
 #include "gnw.h"
+#include "maptilecache.hpp"
 #include "point.hpp"
+#include "spritecache.hpp"
 
 #define GFX_MAP_TILE_SIZE (64)
 
@@ -31,12 +33,23 @@
 #define GFX_SCALE_DENOMINATOR (1 << GFX_SCALE_BASE)
 #define GFX_SCALE_NUMERATOR (GFX_MAP_TILE_SIZE * GFX_SCALE_DENOMINATOR)
 
+#define GFX_MAP_TILE_CACHE_SIZE (8 * 1024 * 1024)
+#define GFX_SPRITE_CACHE_SIZE (16 * 1024 * 1024)
+
+#define GFX_BAND_RENDERER_MAX_THREADS (7)
+#define GFX_BAND_RENDERER_MIN_PIXELS (64 * 1024)
+
 #define Gfx_ScaleInt32(param) (((param) << GFX_SCALE_BASE) / Gfx_MapScalingFactor)
 
 bool Gfx_DecodeSpriteSetup(Point point, uint8_t* buffer, int32_t divisor, Rect* bounds);
 void Gfx_DecodeMapTile(const Rect* const pixel_bounds, const uint32_t tile_size, const uint32_t tile_base,
                        const uint8_t quotient);
+void Gfx_InvalidateMapTileCache();
+const MapTileCacheStatistics& Gfx_GetMapTileCacheStatistics();
 void Gfx_DecodeSprite();
+void Gfx_InvalidateSpriteCache();
+const SpriteCacheStatistics& Gfx_GetSpriteCacheStatistics();
+size_t Gfx_GetSpriteCacheByteCount();
 void Gfx_DecodeShadow();
 void Gfx_RenderCircle(uint8_t* buffer, int32_t full_width, int32_t width, int32_t height, int32_t xc, int32_t yc,
                       int32_t radius, int32_t color);
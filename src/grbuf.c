@@ -24,6 +24,7 @@
 #include <SDL3/SDL.h>
 #include <string.h>
 
+#include "blitkernels.h"
 #include "gnw.h"
 
 void draw_line(uint8_t* buffer, int32_t width, int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t color) {
@@ -140,92 +141,12 @@ void draw_circle(uint8_t* buf, int32_t full, int32_t x, int32_t y, int32_t r, in
 }
 
 void cscale(uint8_t* src, int32_t ow, int32_t ol, int32_t full, uint8_t* dst, int32_t nw, int32_t nl, int32_t full2) {
-    uint8_t* src_addr;
-    uint8_t* dst_addr;
-
-    uint32_t sx_preshift;
-    uint32_t ex_preshift;
-
-    uint8_t pixel;
-
-    int32_t destx;
-    int32_t desty;
-
-    int32_t srcx;
-    int32_t srcy;
-
-    int32_t my;
-    int32_t mx;
-
-    my = (nl << 16) / ol;
-    mx = (nw << 16) / ow;
-
-    for (srcy = 0; srcy < ol; srcy++) {
-        sx_preshift = 0;
-        ex_preshift = (nw << 16) / ow;
-        src_addr = &src[srcy * full];
-
-        for (srcx = 0; srcx < ow; srcx++, src_addr++) {
-            pixel = *src_addr;
-
-            for (desty = my * srcy >> 16; desty < ((my + my * srcy) >> 16); desty++) {
-                dst_addr = &dst[desty * full2] + (sx_preshift >> 16);
-
-                for (destx = sx_preshift >> 16; destx < (ex_preshift >> 16); destx++) {
-                    *dst_addr++ = pixel;
-                }
-            }
-
-            sx_preshift += mx;
-            ex_preshift += mx;
-        }
-    }
+    BlitKernels_Scale(src, ow, ol, full, dst, nw, nl, full2, false);
 }
 
 void trans_cscale(uint8_t* src, int32_t ow, int32_t ol, int32_t full, uint8_t* dst, int32_t nw, int32_t nl,
                   int32_t full2) {
-    uint8_t* src_addr;
-    uint8_t* dst_addr;
-
-    uint32_t sx_preshift;
-    uint32_t ex_preshift;
-
-    uint8_t pixel;
-
-    int32_t destx;
-    int32_t desty;
-
-    int32_t srcx;
-    int32_t srcy;
-
-    int32_t my;
-    int32_t mx;
-
-    my = (nl << 16) / ol;
-    mx = (nw << 16) / ow;
-
-    for (srcy = 0; srcy < ol; srcy++) {
-        sx_preshift = 0;
-        ex_preshift = (nw << 16) / ow;
-        src_addr = &src[srcy * full];
-
-        for (srcx = 0; srcx < ow; srcx++, src_addr++) {
-            pixel = *src_addr;
-
-            if (*src_addr) {
-                for (desty = my * srcy >> 16; desty < ((my + my * srcy) >> 16); desty++) {
-                    dst_addr = &dst[desty * full2] + (sx_preshift >> 16);
-
-                    for (destx = sx_preshift >> 16; destx < (ex_preshift >> 16); destx++) {
-                        *dst_addr++ = pixel;
-                    }
-                }
-            }
-
-            sx_preshift += mx;
-            ex_preshift += mx;
-        }
-    }
+    BlitKernels_Scale(src, ow, ol, full, dst, nw, nl, full2, true);
 }
 
 void buf_to_buf(uint8_t* src, int32_t width, int32_t length, int32_t full, uint8_t* dst, int32_t full2) {
@@ -238,59 +159,17 @@ void buf_to_buf(uint8_t* src, int32_t width, int32_t length, int32_t full, uint8
 }
 
 void trans_buf_to_buf(uint8_t* src, int32_t width, int32_t length, int32_t full, uint8_t* dst, int32_t full2) {
-    for (int32_t i = 0; i < length; i++) {
-        for (int32_t j = 0; j < width; j++) {
-            if (*src) {
-                *dst = *src;
-            }
-
-            src++;
-            dst++;
-        }
-
-        src += full - width;
-        dst += full2 - width;
-    }
+    BlitKernels_TransCopy(src, width, length, full, dst, full2);
 }
 
 void mask_buf_to_buf(uint8_t* src, int32_t width, int32_t length, int32_t full, uint8_t* msk, int32_t full2,
                      uint8_t* dst, int32_t full3) {
-    for (int32_t i = 0; i < length; i++) {
-        for (int32_t j = 0; j < width; j++) {
-            if (*msk) {
-                if (*src) {
-                    *dst = *src;
-                }
-            }
-
-            src++;
-            msk++;
-            dst++;
-        }
-
-        src += full - width;
-        msk += full2 - width;
-        dst += full3 - width;
-    }
+    BlitKernels_MaskTransCopy(src, width, length, full, msk, full2, dst, full3);
 }
 
 void mask_trans_buf_to_buf(uint8_t* src, int32_t width, int32_t length, int32_t full, uint8_t* msk, int32_t full2,
                            uint8_t* dst, int32_t full3) {
-    for (int32_t i = 0; i < length; i++) {
-        for (int32_t j = 0; j < width; j++) {
-            if (*msk) {
-                *dst = *src;
-            }
-
-            src++;
-            msk++;
-            dst++;
-        }
-
-        src += full - width;
-        msk += full2 - width;
-        dst += full3 - width;
-    }
+    BlitKernels_MaskCopy(src, width, length, full, msk, full2, dst, full3);
 }
 
 void buf_fill(uint8_t* buf, int32_t width, int32_t length, int32_t full, int32_t color) {
@@ -353,29 +232,29 @@ void buf_texture(uint8_t* buf, int32_t width, int32_t length, int32_t full, uint
     }
 }
 
-void lighten_buf(uint8_t* buf, int32_t width, int32_t length, int32_t full) {
-    for (uint32_t y = 0; y < length; y++) {
-        for (uint32_t x = 0; x < width; x++) {
-            *buf = Color_ColorIntensity(0x12600, *buf);
-            buf++;
+/* the remap table is rebuilt only when the color palette or the requested intensity changes */
+static const uint8_t* intensity_table(int32_t intensity) {
+    static uint8_t color_table[PALETTE_SIZE];
+    static int32_t table_intensity = -1;
+    static uint32_t table_palette_version;
+    const uint32_t palette_version = Color_GetColorPaletteVersion();
+
+    if (table_intensity != intensity || table_palette_version != palette_version) {
+        for (int32_t i = 0; i < PALETTE_SIZE; i++) {
+            color_table[i] = Color_ColorIntensity(intensity, i);
         }
 
-        buf += full - width;
+        table_intensity = intensity;
+        table_palette_version = palette_version;
     }
-}
 
-void swap_color_buf(uint8_t* buf, int32_t width, int32_t length, int32_t full, int32_t c1, int32_t c2) {
-    for (uint32_t y = 0; y < length; y++) {
-        for (uint32_t x = 0; x < width; x++) {
-            if (*buf == c1) {
-                *buf = c2;
-            } else if (*buf == c2) {
-                *buf = c1;
-            }
+    return color_table;
+}
 
-            buf++;
-        }
+void lighten_buf(uint8_t* buf, int32_t width, int32_t length, int32_t full) {
+    BlitKernels_Remap(buf, width, length, full, intensity_table(0x12600));
+}
 
-        buf += full - width;
-    }
+void swap_color_buf(uint8_t* buf, int32_t width, int32_t length, int32_t full, int32_t c1, int32_t c2) {
+    BlitKernels_SwapColors(buf, width, length, full, c1, c2);
 }
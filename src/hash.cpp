@@ -21,6 +21,7 @@
 
 #include "hash.hpp"
 
+#include "objectpool.hpp"
 #include "resource_manager.hpp"
 
 #define HASH_HASH_SIZE 512
@@ -80,6 +81,9 @@ public:
     MapHashObject(uint16_t grid_x, uint16_t grid_y);
     ~MapHashObject();
 
+    /** Pooled allocation, see ObjectPool. */
+    OBJECTPOOL_DECLARE_ALLOCATOR();
+
     void FileLoad(SmartFileReader& file);
     void FileSave(SmartFileWriter& file);
 
@@ -95,6 +99,8 @@ MapHashObject::MapHashObject(uint16_t grid_x, uint16_t grid_y) : x(grid_x), y(gr
 
 MapHashObject::~MapHashObject() {}
 
+OBJECTPOOL_DEFINE_ALLOCATOR(MapHashObject)
+
 void MapHashObject::FileLoad(SmartFileReader& file) {
     file.Read(x);
     file.Read(y);
@@ -23,15 +23,27 @@
 
 #include <SDL3/SDL.h>
 
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <deque>
+#include <span>
+
 #include "smartfile.hpp"
 #include "unitinfo.hpp"
 
+/* guards the span tables shared by the heat maps of all teams */
+static SDL_SpinLock HeatMap_SpanLock;
+
 HeatMap::HeatMap(int32_t width, int32_t height, uint16_t team, HeatMapQualifier sea_qualifier,
                  HeatMapQualifier land_qualifier, const HeatMapCallouts& callouts)
     : m_width(width),
       m_height(height),
       m_team(team),
       m_cells(static_cast<size_t>(width) * height),
+      m_visibility(m_cells.size()),
+      m_stealth_sea_visibility(m_cells.size()),
+      m_stealth_land_visibility(m_cells.size()),
       m_sea_qualifier(std::move(sea_qualifier)),
       m_land_qualifier(std::move(land_qualifier)),
       m_callouts(callouts) {
@@ -45,6 +57,9 @@ HeatMap::HeatMap(SmartFileReader& file, int32_t width, int32_t height, uint16_t
       m_height(height),
       m_team(team),
       m_cells(static_cast<size_t>(width) * height),
+      m_visibility(m_cells.size()),
+      m_stealth_sea_visibility(m_cells.size()),
+      m_stealth_land_visibility(m_cells.size()),
       m_sea_qualifier(std::move(sea_qualifier)),
       m_land_qualifier(std::move(land_qualifier)),
       m_callouts(callouts) {
@@ -56,12 +71,9 @@ HeatMap::HeatMap(SmartFileReader& file, int32_t width, int32_t height, uint16_t
 bool HeatMap::Add(const UnitInfo* unit, int32_t grid_x, int32_t grid_y, uint32_t* revealed_info) {
     SDL_assert(IsValidCoordinate(grid_x, grid_y));
 
-    if (revealed_info) {
-        *revealed_info = 0;
-    }
-
     const size_t index = GetIndex(grid_x, grid_y);
     HeatMapCell& cell = m_cells[index];
+    uint32_t info = 0;
 
     // Check stealth qualifiers and update respective maps with transition callouts
     if (m_sea_qualifier && m_sea_qualifier(unit)) {
@@ -69,8 +81,12 @@ bool HeatMap::Add(const UnitInfo* unit, int32_t grid_x, int32_t grid_y, uint32_t
 
         ++cell.stealth_sea;
 
-        if (sea_was_zero && m_callouts.on_sea_revealed) {
-            m_callouts.on_sea_revealed(unit, grid_x, grid_y);
+        if (sea_was_zero) {
+            m_stealth_sea_visibility.Set(index);
+
+            if (m_callouts.on_sea_revealed) {
+                info |= m_callouts.on_sea_revealed(unit, grid_x, grid_y);
+            }
         }
     }
 
@@ -79,8 +95,12 @@ bool HeatMap::Add(const UnitInfo* unit, int32_t grid_x, int32_t grid_y, uint32_t
 
         ++cell.stealth_land;
 
-        if (land_was_zero && m_callouts.on_land_revealed) {
-            m_callouts.on_land_revealed(unit, grid_x, grid_y);
+        if (land_was_zero) {
+            m_stealth_land_visibility.Set(index);
+
+            if (m_callouts.on_land_revealed) {
+                info |= m_callouts.on_land_revealed(unit, grid_x, grid_y);
+            }
         }
     }
 
@@ -90,19 +110,19 @@ bool HeatMap::Add(const UnitInfo* unit, int32_t grid_x, int32_t grid_y, uint32_t
     ++cell.complete;
 
     // Invoke callout if cell just became visible
-    if (was_hidden && cell.complete == 1) {
-        if (m_callouts.on_cell_revealed) {
-            const uint32_t info = m_callouts.on_cell_revealed(unit, grid_x, grid_y);
+    if (was_hidden) {
+        m_visibility.Set(index);
 
-            if (revealed_info) {
-                *revealed_info = info;
-            }
+        if (m_callouts.on_cell_revealed) {
+            info |= m_callouts.on_cell_revealed(unit, grid_x, grid_y);
         }
+    }
 
-        return true;
+    if (revealed_info) {
+        *revealed_info = info;
     }
 
-    return false;
+    return was_hidden;
 }
 
 bool HeatMap::Remove(const UnitInfo* unit, int32_t grid_x, int32_t grid_y) {
@@ -116,12 +136,20 @@ bool HeatMap::Remove(const UnitInfo* unit, int32_t grid_x, int32_t grid_y) {
         SDL_assert(cell.stealth_sea > 0);  // Assert on underflow attempt
 
         cell.stealth_sea = (cell.stealth_sea > 0) ? cell.stealth_sea - 1 : 0;
+
+        if (cell.stealth_sea == 0) {
+            m_stealth_sea_visibility.Reset(index);
+        }
     }
 
     if (m_land_qualifier && m_land_qualifier(unit)) {
         SDL_assert(cell.stealth_land > 0);  // Assert on underflow attempt
 
         cell.stealth_land = (cell.stealth_land > 0) ? cell.stealth_land - 1 : 0;
+
+        if (cell.stealth_land == 0) {
+            m_stealth_land_visibility.Reset(index);
+        }
     }
 
     SDL_assert(cell.complete > 0);  // Assert on underflow attempt
@@ -131,6 +159,8 @@ bool HeatMap::Remove(const UnitInfo* unit, int32_t grid_x, int32_t grid_y) {
 
     // Invoke callout if cell just became hidden
     if (cell.complete == 0) {
+        m_visibility.Reset(index);
+
         if (m_callouts.on_cell_hidden) {
             m_callouts.on_cell_hidden(unit, grid_x, grid_y);
         }
@@ -141,6 +171,265 @@ bool HeatMap::Remove(const UnitInfo* unit, int32_t grid_x, int32_t grid_y) {
     return false;
 }
 
+uint32_t HeatMap::AddDisc(const UnitInfo* unit, int32_t center_x, int32_t center_y, int32_t radius) {
+    const std::vector<int32_t>& spans = GetDiscSpans(radius);
+    const bool sea = m_sea_qualifier && m_sea_qualifier(unit);
+    const bool land = m_land_qualifier && m_land_qualifier(unit);
+    const int32_t first_y = std::max(center_y - radius, 0);
+    const int32_t last_y = std::min(center_y + radius, m_height - 1);
+    uint32_t info = 0;
+
+    for (int32_t grid_y = first_y; grid_y <= last_y; ++grid_y) {
+        const int32_t half_width = spans[std::abs(grid_y - center_y)];
+
+        info |= AddSpan(unit, grid_y, std::max(center_x - half_width, 0),
+                        std::min(center_x + half_width, m_width - 1), sea, land);
+    }
+
+    return info;
+}
+
+void HeatMap::RemoveDisc(const UnitInfo* unit, int32_t center_x, int32_t center_y, int32_t radius) {
+    const std::vector<int32_t>& spans = GetDiscSpans(radius);
+    const bool sea = m_sea_qualifier && m_sea_qualifier(unit);
+    const bool land = m_land_qualifier && m_land_qualifier(unit);
+    const int32_t first_y = std::max(center_y - radius, 0);
+    const int32_t last_y = std::min(center_y + radius, m_height - 1);
+
+    for (int32_t grid_y = first_y; grid_y <= last_y; ++grid_y) {
+        const int32_t half_width = spans[std::abs(grid_y - center_y)];
+
+        RemoveSpan(unit, grid_y, std::max(center_x - half_width, 0), std::min(center_x + half_width, m_width - 1),
+                   sea, land);
+    }
+}
+
+const std::vector<int32_t>& HeatMap::GetDiscSpans(int32_t radius) {
+    // span tables are shared by all heat maps, scan ranges are small so the cache stays tiny; a deque keeps the tables
+    // of smaller radii in place while larger ones are added, so callers may hold on to the returned reference
+    static std::deque<std::vector<int32_t>> HeatMap_DiscSpans;
+
+    SDL_assert(radius >= 0);
+
+    radius = std::max(radius, 0);
+
+    SDL_LockSpinlock(&HeatMap_SpanLock);
+
+    if (static_cast<size_t>(radius) >= HeatMap_DiscSpans.size()) {
+        HeatMap_DiscSpans.resize(radius + 1);
+    }
+
+    std::vector<int32_t>& spans = HeatMap_DiscSpans[radius];
+
+    if (spans.empty()) {
+        // spans[dy] is the largest dx that satisfies dx * dx + dy * dy <= radius * radius
+        spans.resize(radius + 1);
+
+        int32_t half_width = radius;
+
+        for (int32_t dy = 0; dy <= radius; ++dy) {
+            while (half_width * half_width + dy * dy > radius * radius) {
+                --half_width;
+            }
+
+            spans[dy] = half_width;
+        }
+    }
+
+    SDL_UnlockSpinlock(&HeatMap_SpanLock);
+
+    return spans;
+}
+
+uint32_t HeatMap::AddDiscDelta(const UnitInfo* unit, int32_t from_x, int32_t from_y, int32_t to_x, int32_t to_y,
+                               int32_t radius) {
+    const std::vector<Span>& spans = GetCrescentSpans(radius, to_x - from_x, to_y - from_y);
+    const bool sea = m_sea_qualifier && m_sea_qualifier(unit);
+    const bool land = m_land_qualifier && m_land_qualifier(unit);
+    uint32_t info = 0;
+
+    for (const auto& span : spans) {
+        const int32_t grid_y = to_y + span.offset_y;
+
+        if (grid_y >= 0 && grid_y < m_height) {
+            info |= AddSpan(unit, grid_y, std::max(to_x + span.first_x, 0), std::min(to_x + span.last_x, m_width - 1),
+                            sea, land);
+        }
+    }
+
+    return info;
+}
+
+void HeatMap::RemoveDiscDelta(const UnitInfo* unit, int32_t from_x, int32_t from_y, int32_t to_x, int32_t to_y,
+                              int32_t radius) {
+    // the cells leaving the old disc mirror the cells entering the new disc of the opposite move
+    const std::vector<Span>& spans = GetCrescentSpans(radius, from_x - to_x, from_y - to_y);
+    const bool sea = m_sea_qualifier && m_sea_qualifier(unit);
+    const bool land = m_land_qualifier && m_land_qualifier(unit);
+
+    for (const auto& span : spans) {
+        const int32_t grid_y = from_y + span.offset_y;
+
+        if (grid_y >= 0 && grid_y < m_height) {
+            RemoveSpan(unit, grid_y, std::max(from_x + span.first_x, 0), std::min(from_x + span.last_x, m_width - 1),
+                       sea, land);
+        }
+    }
+}
+
+const std::vector<HeatMap::Span>& HeatMap::GetCrescentSpans(int32_t radius, int32_t step_x, int32_t step_y) {
+    // one table per radius and each of the nine step directions including the empty null move, stored at stable
+    // addresses like the disc spans
+    struct CrescentSpans {
+        bool ready{false};
+        std::array<std::vector<Span>, 9> directions;
+    };
+
+    static std::deque<CrescentSpans> HeatMap_CrescentSpans;
+
+    SDL_assert(radius >= 0);
+    SDL_assert(step_x >= -1 && step_x <= 1 && step_y >= -1 && step_y <= 1);
+
+    radius = std::max(radius, 0);
+
+    // taken before the lock, the span lock is not recursive
+    const std::vector<int32_t>& disc = GetDiscSpans(radius);
+
+    SDL_LockSpinlock(&HeatMap_SpanLock);
+
+    if (static_cast<size_t>(radius) >= HeatMap_CrescentSpans.size()) {
+        HeatMap_CrescentSpans.resize(radius + 1);
+    }
+
+    CrescentSpans& crescents = HeatMap_CrescentSpans[radius];
+
+    if (!crescents.ready) {
+        for (int32_t direction_y = -1; direction_y <= 1; ++direction_y) {
+            for (int32_t direction_x = -1; direction_x <= 1; ++direction_x) {
+                std::vector<Span>& spans = crescents.directions[(direction_y + 1) * 3 + (direction_x + 1)];
+
+                if (direction_x == 0 && direction_y == 0) {
+                    continue;
+                }
+
+                // rows relative to the new center; the old center lies at -direction, so row offset_y of the new disc
+                // is row offset_y + direction_y of the old disc shifted by direction_x
+                for (int32_t offset_y = -radius; offset_y <= radius; ++offset_y) {
+                    const int32_t new_first = -disc[std::abs(offset_y)];
+                    const int32_t new_last = disc[std::abs(offset_y)];
+                    const int32_t old_row = offset_y + direction_y;
+
+                    if (old_row < -radius || old_row > radius) {
+                        spans.push_back({offset_y, new_first, new_last});
+
+                    } else {
+                        const int32_t old_first = -disc[std::abs(old_row)] - direction_x;
+                        const int32_t old_last = disc[std::abs(old_row)] - direction_x;
+
+                        if (new_first < old_first) {
+                            spans.push_back({offset_y, new_first, std::min(new_last, old_first - 1)});
+                        }
+
+                        if (new_last > old_last) {
+                            spans.push_back({offset_y, std::max(new_first, old_last + 1), new_last});
+                        }
+                    }
+                }
+            }
+        }
+
+        crescents.ready = true;
+    }
+
+    SDL_UnlockSpinlock(&HeatMap_SpanLock);
+
+    return crescents.directions[(step_y + 1) * 3 + (step_x + 1)];
+}
+
+uint32_t HeatMap::AddSpan(const UnitInfo* unit, int32_t grid_y, int32_t first_x, int32_t last_x, bool sea,
+                          bool land) {
+    const size_t row_index = GetIndex(0, grid_y);
+    HeatMapCell* cells = &m_cells[row_index];
+    uint32_t info = 0;
+
+    for (int32_t grid_x = first_x; grid_x <= last_x; ++grid_x) {
+        HeatMapCell& cell = cells[grid_x];
+
+        if (sea && cell.stealth_sea++ == 0) {
+            m_stealth_sea_visibility.Set(row_index + grid_x);
+
+            if (m_callouts.on_sea_revealed) {
+                info |= m_callouts.on_sea_revealed(unit, grid_x, grid_y);
+            }
+        }
+
+        if (land && cell.stealth_land++ == 0) {
+            m_stealth_land_visibility.Set(row_index + grid_x);
+
+            if (m_callouts.on_land_revealed) {
+                info |= m_callouts.on_land_revealed(unit, grid_x, grid_y);
+            }
+        }
+
+        if (cell.complete++ == 0) {
+            m_visibility.Set(row_index + grid_x);
+
+            if (m_callouts.on_cell_revealed) {
+                info |= m_callouts.on_cell_revealed(unit, grid_x, grid_y);
+            }
+        }
+    }
+
+    return info;
+}
+
+void HeatMap::RemoveSpan(const UnitInfo* unit, int32_t grid_y, int32_t first_x, int32_t last_x, bool sea, bool land) {
+    const size_t row_index = GetIndex(0, grid_y);
+    HeatMapCell* cells = &m_cells[row_index];
+
+    for (int32_t grid_x = first_x; grid_x <= last_x; ++grid_x) {
+        HeatMapCell& cell = cells[grid_x];
+
+        if (sea) {
+            SDL_assert(cell.stealth_sea > 0);  // Assert on underflow attempt
+
+            if (cell.stealth_sea > 1) {
+                --cell.stealth_sea;
+
+            } else {
+                cell.stealth_sea = 0;
+                m_stealth_sea_visibility.Reset(row_index + grid_x);
+            }
+        }
+
+        if (land) {
+            SDL_assert(cell.stealth_land > 0);  // Assert on underflow attempt
+
+            if (cell.stealth_land > 1) {
+                --cell.stealth_land;
+
+            } else {
+                cell.stealth_land = 0;
+                m_stealth_land_visibility.Reset(row_index + grid_x);
+            }
+        }
+
+        SDL_assert(cell.complete > 0);  // Assert on underflow attempt
+
+        if (cell.complete > 1) {
+            --cell.complete;
+
+        } else {
+            cell.complete = 0;
+            m_visibility.Reset(row_index + grid_x);
+
+            if (m_callouts.on_cell_hidden) {
+                m_callouts.on_cell_hidden(unit, grid_x, grid_y);
+            }
+        }
+    }
+}
+
 uint32_t HeatMap::GetComplete(int32_t grid_x, int32_t grid_y) const noexcept {
     if (!IsValidCoordinate(grid_x, grid_y)) {
         return 0;
@@ -165,7 +454,9 @@ uint32_t HeatMap::GetStealthLand(int32_t grid_x, int32_t grid_y) const noexcept
     return m_cells[GetIndex(grid_x, grid_y)].stealth_land;
 }
 
-bool HeatMap::IsVisible(int32_t grid_x, int32_t grid_y) const noexcept { return GetComplete(grid_x, grid_y) > 0; }
+bool HeatMap::IsVisible(int32_t grid_x, int32_t grid_y) const noexcept {
+    return IsValidCoordinate(grid_x, grid_y) && m_visibility.Test(GetIndex(grid_x, grid_y));
+}
 
 bool HeatMap::IsVisible(const UnitInfo* unit) const noexcept {
     if (!unit) {
@@ -173,11 +464,11 @@ bool HeatMap::IsVisible(const UnitInfo* unit) const noexcept {
     }
 
     if (unit->flags & BUILDING) {
-        return GetComplete(unit->grid_x, unit->grid_y) || GetComplete(unit->grid_x + 1, unit->grid_y) ||
-               GetComplete(unit->grid_x, unit->grid_y + 1) || GetComplete(unit->grid_x + 1, unit->grid_y + 1);
+        return IsVisible(unit->grid_x, unit->grid_y) || IsVisible(unit->grid_x + 1, unit->grid_y) ||
+               IsVisible(unit->grid_x, unit->grid_y + 1) || IsVisible(unit->grid_x + 1, unit->grid_y + 1);
     }
 
-    return GetComplete(unit->grid_x, unit->grid_y) > 0;
+    return IsVisible(unit->grid_x, unit->grid_y);
 }
 
 void HeatMap::Clear() noexcept {
@@ -186,13 +477,21 @@ void HeatMap::Clear() noexcept {
         cell.stealth_sea = 0;
         cell.stealth_land = 0;
     }
+
+    m_visibility.Clear();
+    m_stealth_sea_visibility.Clear();
+    m_stealth_land_visibility.Clear();
 }
 
 void HeatMap::Save(SmartFileWriter& file) const noexcept {
-    file.Write(m_cells.data(), m_cells.size() * sizeof(HeatMapCell));
+    file.WriteSpan(std::span(m_cells));
 }
 
-void HeatMap::Load(SmartFileReader& file) noexcept { file.Read(m_cells.data(), m_cells.size() * sizeof(HeatMapCell)); }
+void HeatMap::Load(SmartFileReader& file) noexcept {
+    file.ReadSpan(std::span(m_cells));
+
+    RebuildVisibility();
+}
 
 void HeatMap::LoadV70(SmartFileReader& file, uint32_t map_cell_count) noexcept {
     SDL_assert(map_cell_count == m_cells.size());
@@ -203,9 +502,9 @@ void HeatMap::LoadV70(SmartFileReader& file, uint32_t map_cell_count) noexcept {
     std::vector<int8_t> legacy_stealth_land(map_cell_count);
 
     // Read the three arrays from the file
-    file.Read(legacy_complete.data(), map_cell_count);
-    file.Read(legacy_stealth_sea.data(), map_cell_count);
-    file.Read(legacy_stealth_land.data(), map_cell_count);
+    file.ReadSpan(std::span(legacy_complete));
+    file.ReadSpan(std::span(legacy_stealth_sea));
+    file.ReadSpan(std::span(legacy_stealth_land));
 
     // Convert to new format, correcting negative values to 0
     for (uint32_t i = 0; i < map_cell_count; ++i) {
@@ -213,6 +512,28 @@ void HeatMap::LoadV70(SmartFileReader& file, uint32_t map_cell_count) noexcept {
         m_cells[i].stealth_sea = (legacy_stealth_sea[i] < 0) ? 0 : static_cast<uint32_t>(legacy_stealth_sea[i]);
         m_cells[i].stealth_land = (legacy_stealth_land[i] < 0) ? 0 : static_cast<uint32_t>(legacy_stealth_land[i]);
     }
+
+    RebuildVisibility();
+}
+
+void HeatMap::RebuildVisibility() noexcept {
+    m_visibility.Clear();
+    m_stealth_sea_visibility.Clear();
+    m_stealth_land_visibility.Clear();
+
+    for (size_t i = 0; i < m_cells.size(); ++i) {
+        if (m_cells[i].complete) {
+            m_visibility.Set(i);
+        }
+
+        if (m_cells[i].stealth_sea) {
+            m_stealth_sea_visibility.Set(i);
+        }
+
+        if (m_cells[i].stealth_land) {
+            m_stealth_land_visibility.Set(i);
+        }
+    }
 }
 
 size_t HeatMap::GetIndex(int32_t grid_x, int32_t grid_y) const noexcept {
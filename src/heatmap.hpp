@@ -26,6 +26,8 @@
 #include <functional>
 #include <vector>
 
+#include "visibilitybitset.hpp"
+
 class SmartFileReader;
 class SmartFileWriter;
 class UnitInfo;
@@ -65,7 +67,7 @@ using HeatMapQualifier = std::function<bool(const UnitInfo* unit)>;
 using HeatMapTransitionCallout = std::function<void(const UnitInfo* unit, int32_t grid_x, int32_t grid_y)>;
 
 /**
- * \brief Callout function type for the complete map 0 -> 1 transition, which reports a value back to the caller.
+ * \brief Callout function type for the 0 -> 1 transitions, which report a value back to the caller.
  *
  * Behaves like HeatMapTransitionCallout but returns a value that Add() forwards, unexamined, to its caller. The reveal
  * callout is the only place that observes each unit's visibility both before and after the reveal, so it is the only
@@ -73,7 +75,8 @@ using HeatMapTransitionCallout = std::function<void(const UnitInfo* unit, int32_
  * produced here and handed back rather than recomputed afterwards, because once the callout returns, a unit uncovered
  * by this reveal is indistinguishable from one that was already visible.
  *
- * The value is opaque to HeatMap; its meaning is agreed between the callout and the caller of Add().
+ * The value is opaque to HeatMap; its meaning is agreed between the callout and the caller of Add(). Values returned by
+ * the callouts of different layers and cells are combined with bitwise OR.
  *
  * \param unit The unit causing the transition.
  * \param grid_x The x coordinate of the cell.
@@ -92,8 +95,8 @@ using HeatMapRevealCallout = std::function<uint32_t(const UnitInfo* unit, int32_
 struct HeatMapCallouts {
     HeatMapRevealCallout on_cell_revealed{nullptr};      ///< Complete map: 0 -> 1 transition
     HeatMapTransitionCallout on_cell_hidden{nullptr};    ///< Complete map: 1 -> 0 transition
-    HeatMapTransitionCallout on_sea_revealed{nullptr};   ///< Stealth sea map: 0 -> 1 transition
-    HeatMapTransitionCallout on_land_revealed{nullptr};  ///< Stealth land map: 0 -> 1 transition
+    HeatMapRevealCallout on_sea_revealed{nullptr};       ///< Stealth sea map: 0 -> 1 transition
+    HeatMapRevealCallout on_land_revealed{nullptr};      ///< Stealth land map: 0 -> 1 transition
 };
 
 /**
@@ -109,6 +112,9 @@ struct HeatMapCallouts {
  * Each cell value represents a reference count of how many units currently cover that position with scan range. Values
  * use unsigned 32-bit integers to support large maps with many overlapping scan ranges without overflow or underflow
  * concerns.
+ *
+ * Every layer is mirrored by a VisibilityBitset that is updated on the same zero crossings that invoke the callouts.
+ * Queries that only ask whether a cell is covered read the bitsets, which are a 96th of the counter storage.
  */
 class HeatMap {
 public:
@@ -156,12 +162,73 @@ public:
      * \param unit The unit being added to contribute scan coverage.
      * \param grid_x X coordinate of the cell.
      * \param grid_y Y coordinate of the cell.
-     * \param revealed_info Optional out parameter receiving the on_cell_revealed callout's return value. Set to 0 when
-     *        no reveal happened or no callout is registered, so the caller may read it unconditionally.
+     * \param revealed_info Optional out parameter receiving the bitwise OR of the reveal callouts' return values. Set
+     *        to 0 when no reveal happened or no callout is registered, so the caller may read it unconditionally.
      * \return True if the complete heat map transitioned from 0 to 1 at this cell.
      */
     bool Add(const UnitInfo* unit, int32_t grid_x, int32_t grid_y, uint32_t* revealed_info = nullptr);
 
+    /**
+     * \brief Adds a unit's contribution to every cell of a scan disc.
+     *
+     * Equivalent to calling Add() for each cell within radius of the center, visited row by row, but the qualifiers are
+     * evaluated once per call and the disc is clipped to the map through a cached span table instead of testing every
+     * cell of the bounding square. Callouts are invoked only for the cells whose layers transition from 0 to 1.
+     *
+     * \param unit The unit being added to contribute scan coverage.
+     * \param center_x X coordinate of the disc center. May lie outside of the map.
+     * \param center_y Y coordinate of the disc center. May lie outside of the map.
+     * \param radius Scan radius in grid cells. A cell is covered if its squared distance is at most radius squared.
+     * \return Bitwise OR of the values returned by the reveal callouts, 0 if no reveal happened.
+     */
+    uint32_t AddDisc(const UnitInfo* unit, int32_t center_x, int32_t center_y, int32_t radius);
+
+    /**
+     * \brief Removes a unit's contribution from every cell of a scan disc.
+     *
+     * Counterpart of AddDisc(). The unit must have been added with the same center and radius.
+     *
+     * \param unit The unit being removed from scan coverage.
+     * \param center_x X coordinate of the disc center.
+     * \param center_y Y coordinate of the disc center.
+     * \param radius Scan radius in grid cells.
+     */
+    void RemoveDisc(const UnitInfo* unit, int32_t center_x, int32_t center_y, int32_t radius);
+
+    /**
+     * \brief Adds the cells that enter a scan disc when its center moves by at most one cell in each direction.
+     *
+     * A one cell move changes coverage only in a crescent along the leading edge of the disc, so a move can be applied
+     * as AddDiscDelta() followed by RemoveDiscDelta() in O(radius) instead of a full AddDisc() and RemoveDisc() pair in
+     * O(radius^2). The crescents are cached per radius and direction. Counts of cells that stay covered are left
+     * untouched, which is invisible to the callouts as those cells never cross zero either way.
+     *
+     * \param unit The unit being moved.
+     * \param from_x X coordinate of the previous disc center.
+     * \param from_y Y coordinate of the previous disc center.
+     * \param to_x X coordinate of the new disc center.
+     * \param to_y Y coordinate of the new disc center.
+     * \param radius Scan radius in grid cells, identical before and after the move.
+     * \return Bitwise OR of the values returned by the reveal callouts, 0 if no reveal happened.
+     */
+    uint32_t AddDiscDelta(const UnitInfo* unit, int32_t from_x, int32_t from_y, int32_t to_x, int32_t to_y,
+                          int32_t radius);
+
+    /**
+     * \brief Removes the cells that leave a scan disc when its center moves by at most one cell in each direction.
+     *
+     * Counterpart of AddDiscDelta(). Must be called with the same arguments after AddDiscDelta() to complete the move.
+     *
+     * \param unit The unit being moved.
+     * \param from_x X coordinate of the previous disc center.
+     * \param from_y Y coordinate of the previous disc center.
+     * \param to_x X coordinate of the new disc center.
+     * \param to_y Y coordinate of the new disc center.
+     * \param radius Scan radius in grid cells, identical before and after the move.
+     */
+    void RemoveDiscDelta(const UnitInfo* unit, int32_t from_x, int32_t from_y, int32_t to_x, int32_t to_y,
+                         int32_t radius);
+
     /**
      * \brief Removes a unit's contribution from heat map values at the specified position.
      *
@@ -283,7 +350,48 @@ public:
      */
     [[nodiscard]] const std::vector<HeatMapCell>& GetCells() const noexcept { return m_cells; }
 
+    /**
+     * \brief Provides the packed coverage state of the complete heat map.
+     *
+     * \return Bitset with a set bit for every cell whose complete heat value is greater than 0.
+     */
+    [[nodiscard]] const VisibilityBitset& GetVisibility() const noexcept { return m_visibility; }
+
+    /**
+     * \brief Provides the packed coverage state of the stealth sea heat map.
+     *
+     * \return Bitset with a set bit for every cell whose stealth sea heat value is greater than 0.
+     */
+    [[nodiscard]] const VisibilityBitset& GetStealthSeaVisibility() const noexcept { return m_stealth_sea_visibility; }
+
+    /**
+     * \brief Provides the packed coverage state of the stealth land heat map.
+     *
+     * \return Bitset with a set bit for every cell whose stealth land heat value is greater than 0.
+     */
+    [[nodiscard]] const VisibilityBitset& GetStealthLandVisibility() const noexcept {
+        return m_stealth_land_visibility;
+    }
+
 private:
+    /**
+     * \struct Span
+     * \brief Horizontal run of cells relative to a disc center.
+     */
+    struct Span {
+        int32_t offset_y;
+        int32_t first_x;
+        int32_t last_x;
+    };
+
+    [[nodiscard]] static const std::vector<int32_t>& GetDiscSpans(int32_t radius);
+    [[nodiscard]] static const std::vector<Span>& GetCrescentSpans(int32_t radius, int32_t step_x, int32_t step_y);
+
+    uint32_t AddSpan(const UnitInfo* unit, int32_t grid_y, int32_t first_x, int32_t last_x, bool sea, bool land);
+    void RemoveSpan(const UnitInfo* unit, int32_t grid_y, int32_t first_x, int32_t last_x, bool sea, bool land);
+
+    void RebuildVisibility() noexcept;
+
     [[nodiscard]] size_t GetIndex(int32_t grid_x, int32_t grid_y) const noexcept;
     [[nodiscard]] bool IsValidCoordinate(int32_t grid_x, int32_t grid_y) const noexcept;
 
@@ -293,6 +401,10 @@ private:
 
     std::vector<HeatMapCell> m_cells;
 
+    VisibilityBitset m_visibility;
+    VisibilityBitset m_stealth_sea_visibility;
+    VisibilityBitset m_stealth_land_visibility;
+
     HeatMapQualifier m_sea_qualifier;
     HeatMapQualifier m_land_qualifier;
 
@@ -34,6 +34,10 @@
 using json = nlohmann::json;
 using validator = nlohmann::json_schema::json_validator;
 
+/* record layout: section, entry index within the section, ux, uy, lx, ly, language tag, text */
+static constexpr uint32_t Help_CacheKind = 2;
+static constexpr uint32_t Help_CacheFieldCount = 8;
+
 struct Coordinates {
     uint32_t ux;
     uint32_t uy;
@@ -107,16 +111,22 @@ std::string Help::LoadSchema() {
     return schema;
 }
 
-bool Help::LoadFile(const std::string& path) {
+bool Help::LoadFile(const std::string& path, const std::filesystem::path& cache_path) {
     std::ifstream fs(path.c_str());
     bool result{false};
 
     if (fs) {
         std::string contents((std::istreambuf_iterator<char>(fs)), std::istreambuf_iterator<char>());
+        const std::string schema = LoadSchema();
+        const JsonCacheKey key = JsonCache_ComputeKey(Help_CacheKind, {schema, contents});
+
+        if (!cache_path.empty() && LoadCache(cache_path, key)) {
+            return true;
+        }
 
         try {
             validator validator;
-            json jschema = json::parse(LoadSchema());
+            json jschema = json::parse(schema);
             json jscript = json::parse(contents);
 
             validator.set_root_schema(jschema);
@@ -132,11 +142,60 @@ bool Help::LoadFile(const std::string& path) {
         } catch (const std::exception& e) {
             SDL_Log("\n%s\n", (std::string("JSON parse error: ") + e.what()).c_str());
         }
+
+        if (result && !cache_path.empty()) {
+            SaveCache(cache_path, key);
+        }
     }
 
     return result;
 }
 
+bool Help::LoadCache(const std::filesystem::path& cache_path, const JsonCacheKey& key) {
+    JsonCache cache;
+
+    if (!cache.Open(cache_path, Help_CacheKind, key, Help_CacheFieldCount)) {
+        return false;
+    }
+
+    HelpObject object;
+
+    for (uint32_t i = 0; i < cache.GetRecordCount(); ++i) {
+        const uint32_t* const record = cache.GetRecord(i);
+        auto& entries = object.sections[std::string(cache.GetString(record[0]))];
+
+        // the records of an entry are consecutive, a new index starts the next entry of the section
+        if (record[1] >= entries.size()) {
+            entries.push_back({{record[2], record[3], record[4], record[5]}, {}});
+        }
+
+        entries.back().text.emplace(cache.GetString(record[6]), cache.GetString(record[7]));
+    }
+
+    *m_help = std::move(object);
+
+    return true;
+}
+
+void Help::SaveCache(const std::filesystem::path& cache_path, const JsonCacheKey& key) const {
+    JsonCacheWriter writer(Help_CacheFieldCount);
+
+    for (const auto& [section, entries] : m_help->sections) {
+        const uint32_t section_offset = writer.AddString(section);
+
+        for (uint32_t i = 0; i < entries.size(); ++i) {
+            const Coordinates& coordinates = entries[i].coordinates;
+
+            for (const auto& [lang_tag, text] : entries[i].text) {
+                writer.AddRecord({section_offset, i, coordinates.ux, coordinates.uy, coordinates.lx, coordinates.ly,
+                                  writer.AddString(lang_tag), writer.AddString(text)});
+            }
+        }
+    }
+
+    (void)writer.Write(cache_path, Help_CacheKind, key);
+}
+
 bool Help::GetEntry(const std::string& section, const int32_t position_x, const int32_t position_y, std::string& text) {
     bool result{false};
 
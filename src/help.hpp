@@ -23,10 +23,13 @@
 #define HELP_HPP
 
 #include <cstdint>
+#include <filesystem>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "jsoncache.hpp"
+
 struct HelpObject;
 
 class Help {
@@ -34,13 +37,15 @@ class Help {
     std::unique_ptr<HelpObject> m_help;
 
     [[nodiscard]] std::string LoadSchema();
+    [[nodiscard]] bool LoadCache(const std::filesystem::path& cache_path, const JsonCacheKey& key);
+    void SaveCache(const std::filesystem::path& cache_path, const JsonCacheKey& key) const;
 
 public:
     Help();
     Help(std::string& language);
     ~Help();
 
-    [[nodiscard]] bool LoadFile(const std::string& path);
+    [[nodiscard]] bool LoadFile(const std::string& path, const std::filesystem::path& cache_path = {});
     void SetLanguage(const std::string& language);
 
     [[nodiscard]] bool GetEntry(const std::string& section, const int32_t position_x, const int32_t position_y,
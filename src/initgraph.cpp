@@ -0,0 +1,303 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "initgraph.hpp"
+
+#include <SDL3/SDL.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <utility>
+
+uint32_t InitGraph::AddStage(std::string name, StageFunction function, std::initializer_list<uint32_t> dependencies,
+                             bool main_thread) {
+    const uint32_t stage = static_cast<uint32_t>(m_stages.size());
+
+    for (const uint32_t dependency : dependencies) {
+        SDL_assert(dependency < stage);
+
+        m_stages[dependency].dependents.push_back(stage);
+    }
+
+    m_stages.push_back({std::move(name), std::move(function), dependencies, {}, 0, main_thread, {}});
+
+    return stage;
+}
+
+void InitGraph::Run(uint32_t worker_count) {
+    m_ready.clear();
+    m_completed_count = 0;
+    m_exit_requested = false;
+    m_error = nullptr;
+
+    for (uint32_t i = 0; i < m_stages.size(); ++i) {
+        m_stages[i].remaining_count = static_cast<uint32_t>(m_stages[i].dependencies.size());
+        m_stages[i].timing = {};
+
+        if (m_stages[i].remaining_count == 0) {
+            m_ready.push_back(i);
+        }
+    }
+
+    m_start_ns = GetTime();
+
+    std::vector<Worker> workers;
+
+    m_mutex = SDL_CreateMutex();
+    m_changed = SDL_CreateCondition();
+
+    if (m_mutex && m_changed) {
+        workers.reserve(worker_count);
+
+        for (uint32_t i = 0; i < worker_count; ++i) {
+            workers.push_back({this, i + 1, nullptr});
+
+            workers.back().thread = SDL_CreateThread(ThreadFunction, "InitGraph", &workers.back());
+
+            if (!workers.back().thread) {
+                SDL_Log("InitGraph: failed to start worker thread %u of %u.\n", i + 1, worker_count);
+
+                workers.pop_back();
+
+                break;
+            }
+        }
+    }
+
+    // the caller prefers its pinned stages so that the workers are not left waiting for them
+    const bool prefer_pinned = !workers.empty();
+
+    SDL_LockMutex(m_mutex);
+
+    while (!m_error && m_completed_count < m_stages.size()) {
+        uint32_t stage;
+
+        if (TakeReadyStage(true, prefer_pinned, &stage)) {
+            SDL_UnlockMutex(m_mutex);
+
+            std::exception_ptr error = Execute(stage, CALLER_THREAD);
+
+            SDL_LockMutex(m_mutex);
+
+            Complete(stage, std::move(error));
+
+        } else {
+            SDL_WaitCondition(m_changed, m_mutex);
+        }
+    }
+
+    m_exit_requested = true;
+
+    SDL_BroadcastCondition(m_changed);
+    SDL_UnlockMutex(m_mutex);
+
+    for (const auto& worker : workers) {
+        SDL_WaitThread(worker.thread, nullptr);
+    }
+
+    if (m_changed) {
+        SDL_DestroyCondition(m_changed);
+        m_changed = nullptr;
+    }
+
+    if (m_mutex) {
+        SDL_DestroyMutex(m_mutex);
+        m_mutex = nullptr;
+    }
+
+    m_total_ns = GetTime() - m_start_ns;
+
+    if (m_error) {
+        std::rethrow_exception(std::exchange(m_error, nullptr));
+    }
+}
+
+bool InitGraph::TakeReadyStage(bool main_thread, bool prefer_pinned, uint32_t* stage) {
+    auto selected = m_ready.end();
+
+    // a failed stage stops the startup, the stages still running finish but no new ones begin
+    if (m_error) {
+        return false;
+    }
+
+    for (auto it = m_ready.begin(); it != m_ready.end(); ++it) {
+        const bool pinned = m_stages[*it].main_thread;
+
+        if (main_thread ? (prefer_pinned && pinned) : !pinned) {
+            if (selected == m_ready.end() || *it < *selected) {
+                selected = it;
+            }
+        }
+    }
+
+    if (main_thread && selected == m_ready.end() && !m_ready.empty()) {
+        selected = std::min_element(m_ready.begin(), m_ready.end());
+    }
+
+    if (selected == m_ready.end()) {
+        return false;
+    }
+
+    *stage = *selected;
+
+    m_ready.erase(selected);
+
+    return true;
+}
+
+std::exception_ptr InitGraph::Execute(uint32_t stage, uint32_t thread) {
+    Stage& entry = m_stages[stage];
+    const uint64_t start_ns = GetTime();
+    std::exception_ptr error;
+
+    // see WorkerThread::Run(), an exception must not unwind into the SDL thread entry point, Run() rethrows it
+    try {
+        entry.function();
+
+    } catch (const std::exception& e) {
+        SDL_Log("InitGraph: stage %s threw \"%s\".\n", entry.name.c_str(), e.what());
+
+        error = std::current_exception();
+
+    } catch (...) {
+        SDL_Log("InitGraph: stage %s failed.\n", entry.name.c_str());
+
+        error = std::current_exception();
+    }
+
+    entry.timing.start_ns = start_ns - m_start_ns;
+    entry.timing.duration_ns = GetTime() - start_ns;
+    entry.timing.thread = thread;
+
+    return error;
+}
+
+void InitGraph::Complete(uint32_t stage, std::exception_ptr error) {
+    ++m_completed_count;
+
+    if (error && !m_error) {
+        m_error = std::move(error);
+    }
+
+    for (const uint32_t dependent : m_stages[stage].dependents) {
+        if (--m_stages[dependent].remaining_count == 0) {
+            m_ready.push_back(dependent);
+        }
+    }
+
+    SDL_BroadcastCondition(m_changed);
+}
+
+int SDLCALL InitGraph::ThreadFunction(void* data) {
+    auto worker = static_cast<Worker*>(data);
+
+    worker->owner->RunWorker(worker->index);
+
+    return 0;
+}
+
+void InitGraph::RunWorker(uint32_t thread) {
+    SDL_LockMutex(m_mutex);
+
+    for (;;) {
+        uint32_t stage;
+
+        while (!m_exit_requested && !TakeReadyStage(false, false, &stage)) {
+            SDL_WaitCondition(m_changed, m_mutex);
+        }
+
+        if (m_exit_requested) {
+            break;
+        }
+
+        SDL_UnlockMutex(m_mutex);
+
+        std::exception_ptr error = Execute(stage, thread);
+
+        SDL_LockMutex(m_mutex);
+
+        Complete(stage, std::move(error));
+    }
+
+    SDL_UnlockMutex(m_mutex);
+}
+
+void InitGraph::LogReport() const {
+    uint64_t stage_ns = 0;
+
+    for (const auto& stage : m_stages) {
+        SDL_Log("InitGraph: %-20s %8.2f ms on thread %u\n", stage.name.c_str(),
+                static_cast<double>(stage.timing.duration_ns) / 1000000., stage.timing.thread);
+
+        stage_ns += stage.timing.duration_ns;
+    }
+
+    SDL_Log("InitGraph: startup took %.2f ms for %.2f ms of stage time.\n", static_cast<double>(m_total_ns) / 1000000.,
+            static_cast<double>(stage_ns) / 1000000.);
+}
+
+bool InitGraph::WriteReport(std::ostream& stream) const {
+    char line[128];
+
+    std::snprintf(line, sizeof(line), "{\"total_ms\":%.3f,\"stages\":[", static_cast<double>(m_total_ns) / 1000000.);
+
+    stream << line;
+
+    for (size_t i = 0; i < m_stages.size(); ++i) {
+        const Stage& stage = m_stages[i];
+
+        stream << (i ? ",\n" : "\n") << "{\"name\":\"";
+
+        // stage names are identifiers in practice, escape anyway to always produce valid JSON
+        for (const char c : stage.name) {
+            if (c == '"' || c == '\\') {
+                stream << '\\';
+            }
+
+            stream << c;
+        }
+
+        std::snprintf(line, sizeof(line), "\",\"start_ms\":%.3f,\"duration_ms\":%.3f,\"thread\":%u,\"main_thread\":%s",
+                      static_cast<double>(stage.timing.start_ns) / 1000000.,
+                      static_cast<double>(stage.timing.duration_ns) / 1000000., stage.timing.thread,
+                      stage.main_thread ? "true" : "false");
+
+        stream << line << ",\"dependencies\":[";
+
+        for (size_t j = 0; j < stage.dependencies.size(); ++j) {
+            stream << (j ? "," : "") << stage.dependencies[j];
+        }
+
+        stream << "]}";
+    }
+
+    stream << "\n]}\n";
+
+    return stream.good();
+}
+
+uint64_t InitGraph::GetTime() noexcept {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
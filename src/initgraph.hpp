@@ -0,0 +1,149 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef INITGRAPH_HPP
+#define INITGRAPH_HPP
+
+#include <SDL3/SDL_mutex.h>
+#include <SDL3/SDL_thread.h>
+
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * \struct InitGraphStageTiming
+ * \brief Wall clock interval of an executed stage, relative to the start of InitGraph::Run().
+ */
+struct InitGraphStageTiming {
+    uint64_t start_ns{0};
+    uint64_t duration_ns{0};
+    uint32_t thread{0};
+};
+
+/**
+ * \class InitGraph
+ * \brief Dependency aware initializer that runs independent initialization stages concurrently.
+ *
+ * Stages are registered in their serial order and may only depend on stages registered before them, so the graph is
+ * acyclic by construction and running it without worker threads reproduces the serial order. A stage starts once all
+ * of its dependencies completed. Stages that touch the windowing system, the cursor or other main thread only state
+ * are pinned to the thread that calls Run(), the others may also run on one of the worker threads.
+ *
+ * A stage fails by throwing. No further stage starts, and Run() rethrows the first exception on the calling thread
+ * once the workers stopped, so fatal error handling never runs on a worker thread.
+ *
+ * Every stage is timed, the results can be logged and written as a JSON report.
+ */
+class InitGraph {
+public:
+    static constexpr uint32_t CALLER_THREAD = 0;
+
+    using StageFunction = std::function<void()>;
+
+    InitGraph() = default;
+
+    InitGraph(const InitGraph&) = delete;
+    InitGraph& operator=(const InitGraph&) = delete;
+
+    /**
+     * \brief Registers a stage.
+     *
+     * \param name Stage name used in the report.
+     * \param function Stage body.
+     * \param dependencies Identifiers of stages that must complete before this stage starts.
+     * \param main_thread True if the stage must run on the thread that calls Run().
+     * \return Stage identifier.
+     */
+    uint32_t AddStage(std::string name, StageFunction function, std::initializer_list<uint32_t> dependencies,
+                      bool main_thread);
+
+    /**
+     * \brief Runs all stages and waits for their completion.
+     *
+     * If a stage throws, the stages that did not start yet are skipped and the exception is rethrown after the worker
+     * threads joined.
+     *
+     * \param worker_count Number of threads in addition to the calling thread. 0 runs every stage on the caller in
+     * registration order.
+     */
+    void Run(uint32_t worker_count);
+
+    /**
+     * \brief Logs the duration of every stage and the total startup time.
+     */
+    void LogReport() const;
+
+    /**
+     * \brief Writes the stage timings as a JSON document.
+     *
+     * \param stream Output stream.
+     * \return True on success.
+     */
+    bool WriteReport(std::ostream& stream) const;
+
+    [[nodiscard]] inline uint32_t GetStageCount() const noexcept { return static_cast<uint32_t>(m_stages.size()); }
+    [[nodiscard]] inline const std::string& GetStageName(uint32_t stage) const { return m_stages[stage].name; }
+    [[nodiscard]] inline const InitGraphStageTiming& GetTiming(uint32_t stage) const { return m_stages[stage].timing; }
+    [[nodiscard]] inline uint64_t GetTotalTime() const noexcept { return m_total_ns; }
+
+private:
+    struct Stage {
+        std::string name;
+        StageFunction function;
+        std::vector<uint32_t> dependencies;
+        std::vector<uint32_t> dependents;
+        uint32_t remaining_count;
+        bool main_thread;
+        InitGraphStageTiming timing;
+    };
+
+    struct Worker {
+        InitGraph* owner;
+        uint32_t index;
+        SDL_Thread* thread;
+    };
+
+    std::vector<Stage> m_stages;
+    std::vector<uint32_t> m_ready;
+    uint32_t m_completed_count{0};
+    uint64_t m_start_ns{0};
+    uint64_t m_total_ns{0};
+    bool m_exit_requested{false};
+    std::exception_ptr m_error;
+
+    SDL_Mutex* m_mutex{nullptr};
+    SDL_Condition* m_changed{nullptr};
+
+    static int SDLCALL ThreadFunction(void* data);
+    static uint64_t GetTime() noexcept;
+
+    bool TakeReadyStage(bool main_thread, bool prefer_pinned, uint32_t* stage);
+    std::exception_ptr Execute(uint32_t stage, uint32_t thread);
+    void Complete(uint32_t stage, std::exception_ptr error);
+    void RunWorker(uint32_t thread);
+};
+
+#endif /* INITGRAPH_HPP */
@@ -0,0 +1,193 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "jsoncache.hpp"
+
+#include <SDL3/SDL.h>
+
+#include <cstring>
+#include <fstream>
+
+#include "sha2.h"
+
+/* bump on any change of the file layout or of the record layouts of the cache users */
+static constexpr uint32_t JsonCache_FormatVersion = 1;
+static constexpr char JsonCache_Magic[4] = {'M', 'X', 'J', 'C'};
+
+struct JsonCacheHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t kind;
+    uint32_t field_count;
+    uint8_t key[32];
+    uint32_t record_count;
+    uint32_t string_size;
+};
+
+static_assert(sizeof(JsonCacheHeader) % sizeof(uint32_t) == 0, "Records must stay 32 bit aligned.");
+
+JsonCacheKey JsonCache_ComputeKey(uint32_t kind, std::initializer_list<std::string_view> sources) {
+    static_assert(sizeof(JsonCacheKey) == SHA256_DIGEST_SIZE);
+
+    const uint32_t prefix[2] = {JsonCache_FormatVersion, kind};
+    JsonCacheKey key;
+    sha256_ctx ctx;
+
+    sha256_init(&ctx);
+    sha256_update(&ctx, reinterpret_cast<const unsigned char*>(prefix), sizeof(prefix));
+
+    for (const auto source : sources) {
+        // the length separates the sources, otherwise moving bytes from one source to the next keeps the key
+        const uint64_t length = source.size();
+
+        sha256_update(&ctx, reinterpret_cast<const unsigned char*>(&length), sizeof(length));
+        sha256_update(&ctx, reinterpret_cast<const unsigned char*>(source.data()),
+                      static_cast<unsigned int>(source.size()));
+    }
+
+    sha256_final(&ctx, key.data());
+
+    return key;
+}
+
+JsonCacheWriter::JsonCacheWriter(uint32_t field_count) : m_field_count(field_count) {}
+
+uint32_t JsonCacheWriter::AddString(std::string_view text) {
+    auto [it, inserted] = m_string_offsets.try_emplace(std::string(text), static_cast<uint32_t>(m_strings.size()));
+
+    if (inserted) {
+        m_strings.append(text);
+        m_strings.push_back('\0');
+    }
+
+    return it->second;
+}
+
+void JsonCacheWriter::AddRecord(std::initializer_list<uint32_t> fields) {
+    SDL_assert(fields.size() == m_field_count);
+
+    m_fields.insert(m_fields.end(), fields.begin(), fields.end());
+}
+
+bool JsonCacheWriter::Write(const std::filesystem::path& path, uint32_t kind, const JsonCacheKey& key) const {
+    std::error_code ec;
+    JsonCacheHeader header;
+    auto temporary_path = path;
+
+    temporary_path += ".tmp";
+
+    std::memcpy(header.magic, JsonCache_Magic, sizeof(header.magic));
+    header.version = JsonCache_FormatVersion;
+    header.kind = kind;
+    header.field_count = m_field_count;
+    std::memcpy(header.key, key.data(), sizeof(header.key));
+    header.record_count = m_field_count ? static_cast<uint32_t>(m_fields.size() / m_field_count) : 0;
+    header.string_size = static_cast<uint32_t>(m_strings.size());
+
+    std::filesystem::create_directories(path.parent_path(), ec);
+
+    {
+        std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(m_fields.data()), m_fields.size() * sizeof(uint32_t));
+        file.write(m_strings.data(), m_strings.size());
+
+        if (!file.good()) {
+            SDL_Log("JsonCache: failed to write %s.\n", temporary_path.string().c_str());
+
+            file.close();
+            std::filesystem::remove(temporary_path, ec);
+
+            return false;
+        }
+    }
+
+    std::filesystem::rename(temporary_path, path, ec);
+
+    if (ec) {
+        SDL_Log("JsonCache: failed to replace %s.\n", path.string().c_str());
+
+        std::filesystem::remove(temporary_path, ec);
+
+        return false;
+    }
+
+    return true;
+}
+
+JsonCache::JsonCache()
+    : m_records(nullptr), m_strings(nullptr), m_record_count(0), m_field_count(0), m_string_size(0) {}
+
+bool JsonCache::Open(const std::filesystem::path& path, uint32_t kind, const JsonCacheKey& key, uint32_t field_count) {
+    Close();
+
+    std::error_code ec;
+
+    if (!std::filesystem::is_regular_file(path, ec) || !m_archive.Open(path)) {
+        return false;
+    }
+
+    JsonCacheHeader header;
+
+    if (m_archive.Read(0, &header, sizeof(header)) &&
+        std::memcmp(header.magic, JsonCache_Magic, sizeof(header.magic)) == 0 &&
+        header.version == JsonCache_FormatVersion && header.kind == kind && header.field_count == field_count &&
+        std::memcmp(header.key, key.data(), sizeof(header.key)) == 0) {
+        // 64 bit arithmetic keeps a damaged header from wrapping the sizes around on 32 bit targets
+        const uint64_t records_size = static_cast<uint64_t>(header.record_count) * field_count * sizeof(uint32_t);
+        const uint64_t file_size = sizeof(header) + records_size + header.string_size;
+        const uint8_t* const data = m_archive.GetData(0, m_archive.GetSize());
+
+        // every string must be terminated within the table, checking the last byte is sufficient for that
+        if (data && m_archive.GetSize() == file_size && (header.string_size == 0 || data[file_size - 1] == '\0')) {
+            m_records = reinterpret_cast<const uint32_t*>(&data[sizeof(header)]);
+            m_strings = reinterpret_cast<const char*>(&data[sizeof(header) + records_size]);
+            m_record_count = header.record_count;
+            m_field_count = field_count;
+            m_string_size = header.string_size;
+
+            return true;
+        }
+    }
+
+    Close();
+
+    return false;
+}
+
+void JsonCache::Close() noexcept {
+    m_archive.Close();
+
+    m_records = nullptr;
+    m_strings = nullptr;
+    m_record_count = 0;
+    m_field_count = 0;
+    m_string_size = 0;
+}
+
+std::string_view JsonCache::GetString(uint32_t offset) const noexcept {
+    if (offset >= m_string_size) {
+        return {};
+    }
+
+    return std::string_view(&m_strings[offset]);
+}
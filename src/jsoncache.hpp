@@ -0,0 +1,146 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef JSONCACHE_HPP
+#define JSONCACHE_HPP
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "resourcearchive.hpp"
+
+/**
+ * \brief Content hash that ties a cache file to the JSON documents it was generated from.
+ */
+using JsonCacheKey = std::array<uint8_t, 32>;
+
+/**
+ * \brief Computes the key of a cache from its source documents.
+ *
+ * \param kind Identifies the cache layout, a change of the layout must use a new kind or format version.
+ * \param sources Every input of the cache, typically the schema and the JSON document.
+ * \return SHA-256 of the cache format version, the kind and the sources.
+ */
+JsonCacheKey JsonCache_ComputeKey(uint32_t kind, std::initializer_list<std::string_view> sources);
+
+/**
+ * \class JsonCacheWriter
+ * \brief Builds a binary cache of a parsed and validated JSON document.
+ *
+ * A cache is a flat table of records with a fixed number of 32 bit fields each, followed by a string table. String
+ * fields store the offset of a zero terminated string in the string table. Identical strings are stored once.
+ */
+class JsonCacheWriter {
+    uint32_t m_field_count;
+    std::vector<uint32_t> m_fields;
+    std::string m_strings;
+    std::unordered_map<std::string, uint32_t> m_string_offsets;
+
+public:
+    explicit JsonCacheWriter(uint32_t field_count);
+
+    /**
+     * \brief Adds a string to the string table.
+     *
+     * \param text String without embedded zero characters.
+     * \return Offset of the string to be stored in a record field.
+     */
+    uint32_t AddString(std::string_view text);
+
+    /**
+     * \brief Appends a record.
+     *
+     * \param fields Exactly field_count values.
+     */
+    void AddRecord(std::initializer_list<uint32_t> fields);
+
+    /**
+     * \brief Writes the cache file. The file is replaced atomically so that a concurrent reader never sees a partial
+     * file.
+     *
+     * \param path Cache file path, missing parent folders are created.
+     * \param kind Cache layout identifier.
+     * \param key Key of the source documents.
+     * \return True on success.
+     */
+    bool Write(const std::filesystem::path& path, uint32_t kind, const JsonCacheKey& key) const;
+};
+
+/**
+ * \class JsonCache
+ * \brief Memory mapped view of a cache file written by JsonCacheWriter.
+ *
+ * Open() only accepts a file whose format version, kind, key and field count match the expectation of the caller and
+ * whose tables are within the file, so a stale or damaged cache is rejected and the caller falls back to parsing the
+ * JSON document.
+ */
+class JsonCache {
+    ResourceArchive m_archive;
+    const uint32_t* m_records;
+    const char* m_strings;
+    uint32_t m_record_count;
+    uint32_t m_field_count;
+    uint32_t m_string_size;
+
+public:
+    JsonCache();
+
+    /**
+     * \brief Opens a cache file.
+     *
+     * \param path Cache file path.
+     * \param kind Expected cache layout identifier.
+     * \param key Expected key of the source documents.
+     * \param field_count Expected number of fields per record.
+     * \return True if the cache is valid for the given sources.
+     */
+    bool Open(const std::filesystem::path& path, uint32_t kind, const JsonCacheKey& key, uint32_t field_count);
+
+    void Close() noexcept;
+
+    /**
+     * \brief Gets a record.
+     *
+     * \param index Record index, less than GetRecordCount().
+     * \return Address of the first field of the record.
+     */
+    [[nodiscard]] inline const uint32_t* GetRecord(uint32_t index) const noexcept {
+        return &m_records[static_cast<size_t>(index) * m_field_count];
+    }
+
+    /**
+     * \brief Gets a string of the string table.
+     *
+     * \param offset String offset as stored in a record field.
+     * \return The string, or an empty string if the offset is out of range.
+     */
+    [[nodiscard]] std::string_view GetString(uint32_t offset) const noexcept;
+
+    [[nodiscard]] inline uint32_t GetRecordCount() const noexcept { return m_record_count; }
+};
+
+#endif /* JSONCACHE_HPP */
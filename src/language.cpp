@@ -36,6 +36,10 @@
 using json = nlohmann::json;
 using validator = nlohmann::json_schema::json_validator;
 
+/* record layout: uuid, language tag, text */
+static constexpr uint32_t Language_CacheKind = 1;
+static constexpr uint32_t Language_CacheFieldCount = 3;
+
 struct LanguageObject {
     std::unordered_map<uint32_t, std::unordered_map<std::string, std::string>> entries;
 };
@@ -89,16 +93,22 @@ std::string Language::LoadSchema() {
     return schema;
 }
 
-bool Language::LoadFile(const std::string& path) {
+bool Language::LoadFile(const std::string& path, const std::filesystem::path& cache_path) {
     std::ifstream fs(path.c_str());
     bool result{false};
 
     if (fs) {
         std::string contents((std::istreambuf_iterator<char>(fs)), std::istreambuf_iterator<char>());
+        const std::string schema = LoadSchema();
+        const JsonCacheKey key = JsonCache_ComputeKey(Language_CacheKind, {schema, contents});
+
+        if (!cache_path.empty() && LoadCache(cache_path, key)) {
+            return true;
+        }
 
         try {
             validator validator;
-            json jschema = json::parse(LoadSchema());
+            json jschema = json::parse(schema);
             json jscript = json::parse(contents);
 
             validator.set_root_schema(jschema);
@@ -114,11 +124,47 @@ bool Language::LoadFile(const std::string& path) {
         } catch (const std::exception& e) {
             SDL_Log("\n%s\n", (std::string("JSON parse error: ") + e.what()).c_str());
         }
+
+        if (result && !cache_path.empty()) {
+            SaveCache(cache_path, key);
+        }
     }
 
     return result;
 }
 
+bool Language::LoadCache(const std::filesystem::path& cache_path, const JsonCacheKey& key) {
+    JsonCache cache;
+
+    if (!cache.Open(cache_path, Language_CacheKind, key, Language_CacheFieldCount)) {
+        return false;
+    }
+
+    LanguageObject object;
+
+    for (uint32_t i = 0; i < cache.GetRecordCount(); ++i) {
+        const uint32_t* const record = cache.GetRecord(i);
+
+        object.entries[record[0]].emplace(cache.GetString(record[1]), cache.GetString(record[2]));
+    }
+
+    *m_languageobject = std::move(object);
+
+    return true;
+}
+
+void Language::SaveCache(const std::filesystem::path& cache_path, const JsonCacheKey& key) const {
+    JsonCacheWriter writer(Language_CacheFieldCount);
+
+    for (const auto& [uuid, translations] : m_languageobject->entries) {
+        for (const auto& [lang_tag, text] : translations) {
+            writer.AddRecord({uuid, writer.AddString(lang_tag), writer.AddString(text)});
+        }
+    }
+
+    (void)writer.Write(cache_path, Language_CacheKind, key);
+}
+
 const std::string& Language::GetEntry(const uint32_t key) {
     if (key == 0xffff) {
         return m_empty;
@@ -23,11 +23,14 @@
 #define LANGUAGE_HPP
 
 #include <cstdint>
+#include <filesystem>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "jsoncache.hpp"
+
 struct LanguageObject;
 
 class Language {
@@ -38,13 +41,15 @@ class Language {
 
     [[nodiscard]] std::string LoadSchema();
     [[nodiscard]] const std::string& GetMissingEntry(const uint32_t key);
+    [[nodiscard]] bool LoadCache(const std::filesystem::path& cache_path, const JsonCacheKey& key);
+    void SaveCache(const std::filesystem::path& cache_path, const JsonCacheKey& key) const;
 
 public:
     Language();
     Language(std::string& language);
     ~Language();
 
-    [[nodiscard]] bool LoadFile(const std::string& path);
+    [[nodiscard]] bool LoadFile(const std::string& path, const std::filesystem::path& cache_path = {});
     void SetLanguage(std::string& language);
 
     [[nodiscard]] const std::string& GetEntry(const uint32_t key);
@@ -0,0 +1,228 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "maptilecache.hpp"
+
+#include <SDL3/SDL_assert.h>
+
+#include <algorithm>
+#include <cstring>
+
+/* keep in sync with GFX_SCALE_BASE of gfx.hpp */
+static constexpr uint32_t MapTileCache_ScaleBase = 16;
+
+MapTileCache::MapTileCache(size_t byte_budget)
+    : m_byte_budget(byte_budget),
+      m_tile_buffer(nullptr),
+      m_color_table(nullptr),
+      m_tile_count(0),
+      m_tile_size(0),
+      m_zoom_level(0),
+      m_slot_capacity(0),
+      m_most_recent(INVALID_SLOT),
+      m_least_recent(INVALID_SLOT) {}
+
+void MapTileCache::Configure(const uint8_t* tile_buffer, uint32_t tile_count, uint32_t tile_size, uint32_t zoom_level,
+                             const uint8_t* color_table) {
+    const size_t tile_bytes = static_cast<size_t>(zoom_level) * zoom_level;
+
+    m_tile_buffer = tile_buffer;
+    m_color_table = color_table;
+    m_tile_count = tile_count;
+    m_tile_size = tile_size;
+    m_zoom_level = zoom_level;
+
+    // there is no point in having more slots than distinct tiles
+    m_slot_capacity =
+        static_cast<uint32_t>(std::min<size_t>(std::max<size_t>(m_byte_budget / tile_bytes, 1), tile_count));
+
+    m_pixels.resize(m_slot_capacity * tile_bytes);
+    m_slots.clear();
+    m_slots.reserve(m_slot_capacity);
+    m_tile_slots.assign(tile_count, INVALID_SLOT);
+    m_most_recent = INVALID_SLOT;
+    m_least_recent = INVALID_SLOT;
+
+    ++m_statistics.invalidations;
+}
+
+void MapTileCache::Invalidate() noexcept {
+    m_tile_buffer = nullptr;
+    m_color_table = nullptr;
+    m_zoom_level = 0;
+}
+
+void MapTileCache::Unlink(uint32_t slot) noexcept {
+    Slot& entry = m_slots[slot];
+
+    if (entry.previous != INVALID_SLOT) {
+        m_slots[entry.previous].next = entry.next;
+
+    } else {
+        m_most_recent = entry.next;
+    }
+
+    if (entry.next != INVALID_SLOT) {
+        m_slots[entry.next].previous = entry.previous;
+
+    } else {
+        m_least_recent = entry.previous;
+    }
+}
+
+void MapTileCache::LinkMostRecent(uint32_t slot) noexcept {
+    Slot& entry = m_slots[slot];
+
+    entry.previous = INVALID_SLOT;
+    entry.next = m_most_recent;
+
+    if (m_most_recent != INVALID_SLOT) {
+        m_slots[m_most_recent].previous = slot;
+
+    } else {
+        m_least_recent = slot;
+    }
+
+    m_most_recent = slot;
+}
+
+void MapTileCache::ScaleTile(uint32_t tile_id, uint8_t* target) const noexcept {
+    const uint32_t zoom_factor = (((m_tile_size - 1) << MapTileCache_ScaleBase) / (m_zoom_level - 1)) + 8;
+    const uint8_t* const source = &m_tile_buffer[static_cast<size_t>(tile_id) * m_tile_size * m_tile_size];
+
+    for (uint32_t y = 0; y < m_zoom_level; ++y) {
+        const uint8_t* const source_row = &source[((y * zoom_factor) >> MapTileCache_ScaleBase) * m_tile_size];
+
+        for (uint32_t x = 0; x < m_zoom_level; ++x) {
+            target[x] = m_color_table[source_row[(x * zoom_factor) >> MapTileCache_ScaleBase]];
+        }
+
+        target = &target[m_zoom_level];
+    }
+}
+
+const uint8_t* MapTileCache::GetTile(const uint8_t* tile_buffer, uint32_t tile_count, uint32_t tile_id,
+                                     uint32_t tile_size, uint32_t zoom_level, const uint8_t* color_table) {
+    SDL_assert(zoom_level >= 2);
+    SDL_assert(tile_id < tile_count);
+
+    if (tile_buffer != m_tile_buffer || tile_count != m_tile_count || tile_size != m_tile_size ||
+        zoom_level != m_zoom_level || color_table != m_color_table) {
+        Configure(tile_buffer, tile_count, tile_size, zoom_level, color_table);
+    }
+
+    const size_t tile_bytes = static_cast<size_t>(m_zoom_level) * m_zoom_level;
+    uint32_t slot = m_tile_slots[tile_id];
+
+    if (slot != INVALID_SLOT) {
+        ++m_statistics.hits;
+
+        if (slot != m_most_recent) {
+            Unlink(slot);
+            LinkMostRecent(slot);
+        }
+
+        return &m_pixels[slot * tile_bytes];
+    }
+
+    ++m_statistics.misses;
+
+    if (m_slots.size() < m_slot_capacity) {
+        slot = static_cast<uint32_t>(m_slots.size());
+
+        m_slots.push_back({tile_id, INVALID_SLOT, INVALID_SLOT});
+
+    } else {
+        slot = m_least_recent;
+
+        Unlink(slot);
+
+        m_tile_slots[m_slots[slot].tile_id] = INVALID_SLOT;
+        m_slots[slot].tile_id = tile_id;
+
+        ++m_statistics.evictions;
+    }
+
+    m_tile_slots[tile_id] = slot;
+
+    LinkMostRecent(slot);
+
+    uint8_t* const pixels = &m_pixels[slot * tile_bytes];
+
+    ScaleTile(tile_id, pixels);
+
+    return pixels;
+}
+
+void MapTileCache_BlitRows(const MapTileRegion& region, int32_t first_row, int32_t last_row, uint8_t* target,
+                           int32_t pitch) noexcept {
+    const uint32_t zoom_level = region.zoom_level;
+
+    if (first_row > 0) {
+        const ptrdiff_t skipped_rows =
+            static_cast<ptrdiff_t>(zoom_level - region.clip_top) + static_cast<ptrdiff_t>(first_row - 1) * zoom_level;
+
+        target = &target[skipped_rows * pitch];
+    }
+
+    for (int32_t row = first_row; row < last_row; ++row) {
+        uint32_t tile_stride_y = zoom_level;
+        uint32_t offset_y = 0;
+        uint8_t* address_x = target;
+
+        if (row == 0) {
+            tile_stride_y -= region.clip_top;
+            offset_y = region.clip_top;
+        }
+
+        if (row == region.tile_count_y - 1) {
+            tile_stride_y -= region.clip_bottom;
+        }
+
+        for (int32_t column = 0; column < region.tile_count_x; ++column) {
+            uint32_t tile_stride_x = zoom_level;
+            uint32_t offset_x = 0;
+
+            if (column == 0) {
+                tile_stride_x -= region.clip_left;
+                offset_x = region.clip_left;
+            }
+
+            if (column == region.tile_count_x - 1) {
+                tile_stride_x -= region.clip_right;
+            }
+
+            const uint8_t* source = &region.tiles[row * region.tile_count_x + column][offset_y * zoom_level + offset_x];
+            uint8_t* address_y = address_x;
+
+            for (uint32_t j = 0; j < tile_stride_y; ++j) {
+                memcpy(address_y, source, tile_stride_x);
+
+                address_y = &address_y[pitch];
+                source = &source[zoom_level];
+            }
+
+            address_x = &address_x[tile_stride_x];
+        }
+
+        target = &target[static_cast<ptrdiff_t>(pitch) * tile_stride_y];
+    }
+}
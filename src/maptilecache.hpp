@@ -0,0 +1,144 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MAPTILECACHE_HPP
+#define MAPTILECACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * \struct MapTileCacheStatistics
+ * \brief Lookup counters of a map tile cache.
+ */
+struct MapTileCacheStatistics {
+    uint64_t hits{0};
+    uint64_t misses{0};
+    uint64_t evictions{0};
+    uint64_t invalidations{0};
+};
+
+/**
+ * \class MapTileCache
+ * \brief LRU bounded cache of world tiles that are resampled to the main map zoom level and brightness.
+ *
+ * A scaled tile is zoom_level x zoom_level palette indices produced by the same fixed point nearest neighbour sampling
+ * and brightness lookup that Gfx_DecodeMapTile() applies per pixel, so any part of a tile can be copied row by row from
+ * the cache. The cache holds tiles of one configuration at a time. Requesting a different zoom level, tile size,
+ * source tile buffer or brightness table drops every cached tile.
+ *
+ * Palette cycling does not invalidate the cache as it rotates the RGB values of palette entries while the cached
+ * tiles store palette indices.
+ */
+class MapTileCache {
+    static constexpr uint32_t INVALID_SLOT = UINT32_MAX;
+
+    struct Slot {
+        uint32_t tile_id;
+        uint32_t previous;
+        uint32_t next;
+    };
+
+    size_t m_byte_budget;
+
+    const uint8_t* m_tile_buffer;
+    const uint8_t* m_color_table;
+    uint32_t m_tile_count;
+    uint32_t m_tile_size;
+    uint32_t m_zoom_level;
+
+    std::vector<uint8_t> m_pixels;
+    std::vector<Slot> m_slots;
+    std::vector<uint32_t> m_tile_slots;
+    uint32_t m_slot_capacity;
+    uint32_t m_most_recent;
+    uint32_t m_least_recent;
+
+    MapTileCacheStatistics m_statistics;
+
+    void Configure(const uint8_t* tile_buffer, uint32_t tile_count, uint32_t tile_size, uint32_t zoom_level,
+                   const uint8_t* color_table);
+    void Unlink(uint32_t slot) noexcept;
+    void LinkMostRecent(uint32_t slot) noexcept;
+    void ScaleTile(uint32_t tile_id, uint8_t* target) const noexcept;
+
+public:
+    /**
+     * \brief Creates an empty cache.
+     *
+     * \param byte_budget Upper bound of the memory used for scaled tile pixels.
+     */
+    explicit MapTileCache(size_t byte_budget);
+
+    /**
+     * \brief Gets a tile resampled to the zoom level and remapped through the color table.
+     *
+     * \param tile_buffer Source tiles, tile_size x tile_size palette indices each, stored back to back.
+     * \param tile_count Number of tiles in the source buffer.
+     * \param tile_id Index of the requested tile.
+     * \param tile_size Edge length of a source tile in pixels.
+     * \param zoom_level Edge length of a scaled tile in pixels, at least 2.
+     * \param color_table 256 entry palette index remap table, the brightness table of the map.
+     * \return zoom_level x zoom_level palette indices in row major order. The pointer stays valid until the next call.
+     */
+    [[nodiscard]] const uint8_t* GetTile(const uint8_t* tile_buffer, uint32_t tile_count, uint32_t tile_id,
+                                         uint32_t tile_size, uint32_t zoom_level, const uint8_t* color_table);
+
+    /**
+     * \brief Drops all cached tiles, for example when the source tiles or the color tables were regenerated in place.
+     */
+    void Invalidate() noexcept;
+
+    [[nodiscard]] inline const MapTileCacheStatistics& GetStatistics() const noexcept { return m_statistics; }
+    [[nodiscard]] inline uint32_t GetCapacity() const noexcept { return m_slot_capacity; }
+};
+
+/**
+ * \struct MapTileRegion
+ * \brief Grid of scaled tiles that covers a map window area, the outer tiles clipped to the area bounds.
+ */
+struct MapTileRegion {
+    const uint8_t* const* tiles;
+    int32_t tile_count_x;
+    int32_t tile_count_y;
+    uint32_t zoom_level;
+    uint32_t clip_left;
+    uint32_t clip_top;
+    uint32_t clip_right;
+    uint32_t clip_bottom;
+};
+
+/**
+ * \brief Copies rows of tiles of a region into a frame buffer.
+ *
+ * Calls that cover disjoint tile row ranges write disjoint pixel rows, so they can run concurrently.
+ *
+ * \param region Scaled tile pointers in row major order. Only the rows first_row to last_row - 1 are accessed.
+ * \param first_row First tile row to copy.
+ * \param last_row One past the last tile row to copy.
+ * \param target Frame buffer address of the top left pixel of the region, that is tile row 0.
+ * \param pitch Frame buffer row length in bytes.
+ */
+void MapTileCache_BlitRows(const MapTileRegion& region, int32_t first_row, int32_t last_row, uint8_t* target,
+                           int32_t pitch) noexcept;
+
+#endif /* MAPTILECACHE_HPP */
@@ -0,0 +1,179 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "minimapcache.hpp"
+
+#include <SDL3/SDL_assert.h>
+
+#include <algorithm>
+#include <cstring>
+
+MinimapCache::MinimapCache()
+    : m_column_edges(1, 0),
+      m_row_edges(1, 0),
+      m_map_width(0),
+      m_map_height(0),
+      m_target_width(0),
+      m_target_height(0),
+      m_rebuild(true) {}
+
+void MinimapCache::Configure(int32_t map_width, int32_t map_height, int32_t target_width, int32_t target_height) {
+    target_width = std::max(target_width, 0);
+    target_height = std::max(target_height, 0);
+
+    if (map_width == m_map_width && map_height == m_map_height && target_width == m_target_width &&
+        target_height == m_target_height) {
+        return;
+    }
+
+    // the unit dots are kept as long as the map dimensions do not change
+    if (map_width != m_map_width || map_height != m_map_height) {
+        const size_t cell_count = static_cast<size_t>(std::max(map_width, 0)) * std::max(map_height, 0);
+
+        m_map_width = map_width;
+        m_map_height = map_height;
+
+        m_cell_colors.assign(cell_count, 0);
+        m_unit_colors.assign(cell_count, 0);
+        m_dirty_flags.assign(cell_count, 0);
+        m_dirty_cells.clear();
+        m_unit_cells.clear();
+        m_previous_unit_cells.clear();
+    }
+
+    m_target_width = target_width;
+    m_target_height = target_height;
+
+    m_pixels.assign(static_cast<size_t>(m_target_width) * m_target_height, 0);
+    m_column_edges.assign(1, 0);
+    m_row_edges.assign(1, 0);
+
+    if (!m_cell_colors.empty()) {
+        // the 16.16 fixed point steps of cscale(), source pixel x covers [x * mx >> 16, (x + 1) * mx >> 16)
+        const uint32_t mx = static_cast<uint32_t>((m_target_width << 16) / m_map_width);
+        const int64_t my = (m_target_height << 16) / m_map_height;
+
+        for (int32_t x = 1; x <= m_map_width; ++x) {
+            m_column_edges.push_back(static_cast<int32_t>((static_cast<uint32_t>(x) * mx) >> 16));
+        }
+
+        for (int32_t y = 1; y <= m_map_height; ++y) {
+            m_row_edges.push_back(static_cast<int32_t>((my * y) >> 16));
+        }
+    }
+
+    m_rebuild = true;
+}
+
+void MinimapCache::Invalidate() noexcept { m_rebuild = true; }
+
+void MinimapCache::MarkDirty(uint32_t cell) noexcept {
+    if (!m_dirty_flags[cell]) {
+        m_dirty_flags[cell] = 1;
+        m_dirty_cells.push_back(cell);
+    }
+}
+
+void MinimapCache::InvalidateCell(uint32_t cell) noexcept {
+    if (cell < m_dirty_flags.size() && !m_rebuild) {
+        MarkDirty(cell);
+    }
+}
+
+void MinimapCache::ClearUnitDots() noexcept {
+    for (const uint32_t cell : m_unit_cells) {
+        m_unit_colors[cell] = 0;
+    }
+
+    // the cells keep their drawn colors until the next composition compares them against the new layers
+    m_previous_unit_cells.insert(m_previous_unit_cells.end(), m_unit_cells.begin(), m_unit_cells.end());
+    m_unit_cells.clear();
+}
+
+void MinimapCache::AddUnitDot(int32_t grid_x, int32_t grid_y, int32_t size, uint8_t color) {
+    SDL_assert(color != 0);
+
+    const int32_t last_x = std::min(grid_x + size, m_map_width);
+    const int32_t last_y = std::min(grid_y + size, m_map_height);
+
+    for (int32_t y = std::max(grid_y, 0); y < last_y; ++y) {
+        for (int32_t x = std::max(grid_x, 0); x < last_x; ++x) {
+            const uint32_t cell = static_cast<uint32_t>(y * m_map_width + x);
+
+            m_unit_colors[cell] = color;
+            m_unit_cells.push_back(cell);
+        }
+    }
+}
+
+void MinimapCache::DrawCell(uint32_t cell, uint8_t color) noexcept {
+    const uint32_t grid_x = cell % m_map_width;
+    const uint32_t grid_y = cell / m_map_width;
+    const int32_t left = m_column_edges[grid_x];
+    const int32_t width = m_column_edges[grid_x + 1] - left;
+
+    for (int32_t y = m_row_edges[grid_y]; y < m_row_edges[grid_y + 1]; ++y) {
+        memset(&m_pixels[static_cast<size_t>(y) * m_target_width + left], color, width);
+    }
+
+    m_cell_colors[cell] = color;
+
+    ++m_statistics.redrawn_cells;
+}
+
+void MinimapCache::Compose(const uint8_t* base) {
+    const uint32_t cell_count = static_cast<uint32_t>(m_cell_colors.size());
+
+    ++m_statistics.compositions;
+
+    if (m_rebuild) {
+        for (uint32_t cell = 0; cell < cell_count; ++cell) {
+            DrawCell(cell, m_unit_colors[cell] ? m_unit_colors[cell] : base[cell]);
+        }
+
+        ++m_statistics.full_rebuilds;
+        m_statistics.candidate_cells += cell_count;
+
+        m_rebuild = false;
+
+    } else {
+        const auto update = [this, base](const uint32_t cell) {
+            const uint8_t color = m_unit_colors[cell] ? m_unit_colors[cell] : base[cell];
+
+            if (color != m_cell_colors[cell]) {
+                DrawCell(cell, color);
+            }
+        };
+
+        std::for_each(m_dirty_cells.begin(), m_dirty_cells.end(), update);
+        std::for_each(m_previous_unit_cells.begin(), m_previous_unit_cells.end(), update);
+        std::for_each(m_unit_cells.begin(), m_unit_cells.end(), update);
+
+        m_statistics.candidate_cells += m_dirty_cells.size() + m_previous_unit_cells.size() + m_unit_cells.size();
+    }
+
+    for (const uint32_t cell : m_dirty_cells) {
+        m_dirty_flags[cell] = 0;
+    }
+
+    m_dirty_cells.clear();
+    m_previous_unit_cells.clear();
+}
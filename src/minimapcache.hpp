@@ -0,0 +1,134 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MINIMAPCACHE_HPP
+#define MINIMAPCACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * \struct MinimapCacheStatistics
+ * \brief Composition counters of a minimap cache.
+ */
+struct MinimapCacheStatistics {
+    uint64_t compositions{0};
+    uint64_t full_rebuilds{0};
+    uint64_t candidate_cells{0};
+    uint64_t redrawn_cells{0};
+};
+
+/**
+ * \class MinimapCache
+ * \brief Persistent scaled minimap image composed of a terrain x fog base layer and a unit dot layer.
+ *
+ * Every map cell covers the same target pixel rectangle that cscale() assigns to the source pixel of the cell, so the
+ * image is identical to scaling the whole composed map each time. Only cells whose composed color differs from the one
+ * already drawn are written. Candidates are the base cells reported through InvalidateCell() and the cells covered by
+ * the previous and the current unit dots.
+ */
+class MinimapCache {
+    std::vector<uint8_t> m_pixels;
+    std::vector<uint8_t> m_cell_colors;
+    std::vector<uint8_t> m_unit_colors;
+    std::vector<uint8_t> m_dirty_flags;
+    std::vector<uint32_t> m_dirty_cells;
+    std::vector<uint32_t> m_unit_cells;
+    std::vector<uint32_t> m_previous_unit_cells;
+    std::vector<int32_t> m_column_edges;
+    std::vector<int32_t> m_row_edges;
+
+    int32_t m_map_width;
+    int32_t m_map_height;
+    int32_t m_target_width;
+    int32_t m_target_height;
+    bool m_rebuild;
+
+    MinimapCacheStatistics m_statistics;
+
+    void MarkDirty(uint32_t cell) noexcept;
+    void DrawCell(uint32_t cell, uint8_t color) noexcept;
+
+public:
+    MinimapCache();
+
+    /**
+     * \brief Sets the map and target dimensions. Changing either redraws every cell on the next composition.
+     *
+     * The unit dots survive a change of the target dimensions but not a change of the map dimensions.
+     *
+     * \param map_width Map width in cells.
+     * \param map_height Map height in cells.
+     * \param target_width Width of the scaled image in pixels.
+     * \param target_height Height of the scaled image in pixels.
+     */
+    void Configure(int32_t map_width, int32_t map_height, int32_t target_width, int32_t target_height);
+
+    /**
+     * \brief Redraws every cell on the next composition, for example after a new map was loaded.
+     */
+    void Invalidate() noexcept;
+
+    /**
+     * \brief Reports a base layer cell whose color changed.
+     *
+     * \param cell Cell index, grid_y * map_width + grid_x.
+     */
+    void InvalidateCell(uint32_t cell) noexcept;
+
+    /**
+     * \brief Removes all unit dots. The dot layer is rebuilt by AddUnitDot() calls in draw order.
+     */
+    void ClearUnitDots() noexcept;
+
+    /**
+     * \brief Adds a unit dot on top of the dots added before.
+     *
+     * \param grid_x Left cell of the dot.
+     * \param grid_y Top cell of the dot.
+     * \param size Edge length of the dot in cells, clipped to the map.
+     * \param color Palette index of the dot, must not be 0.
+     */
+    void AddUnitDot(int32_t grid_x, int32_t grid_y, int32_t size, uint8_t color);
+
+    /**
+     * \brief Brings the scaled image up to date.
+     *
+     * \param base Base layer colors, map_width x map_height palette indices in row major order.
+     */
+    void Compose(const uint8_t* base);
+
+    [[nodiscard]] inline const uint8_t* GetPixels() const noexcept { return m_pixels.data(); }
+    [[nodiscard]] inline int32_t GetPitch() const noexcept { return m_target_width; }
+    [[nodiscard]] inline int32_t GetMapWidth() const noexcept { return m_map_width; }
+    [[nodiscard]] inline int32_t GetMapHeight() const noexcept { return m_map_height; }
+    [[nodiscard]] inline int32_t GetTargetWidth() const noexcept { return m_target_width; }
+    [[nodiscard]] inline int32_t GetTargetHeight() const noexcept { return m_target_height; }
+
+    /* cscale() can leave the right and bottom edge of the target unwritten, these sizes exclude them */
+    [[nodiscard]] inline int32_t GetCoveredWidth() const noexcept { return m_column_edges.back(); }
+    [[nodiscard]] inline int32_t GetCoveredHeight() const noexcept { return m_row_edges.back(); }
+
+    [[nodiscard]] inline const MinimapCacheStatistics& GetStatistics() const noexcept { return m_statistics; }
+};
+
+#endif /* MINIMAPCACHE_HPP */
@@ -544,16 +544,19 @@ std::string Mission::LoadSchema() {
     return script;
 }
 
-bool Mission::LoadBuffer(const std::string& script) {
+bool Mission::LoadBuffer(const std::string& script, bool validate) {
     bool result{false};
 
     try {
-        validator validator;
-        json jschema = json::parse(LoadSchema());
         json jscript = json::parse(script);
 
-        validator.set_root_schema(jschema);
-        validator.validate(jscript);
+        if (validate) {
+            validator validator;
+            json jschema = json::parse(LoadSchema());
+
+            validator.set_root_schema(jschema);
+            validator.validate(jscript);
+        }
 
         *m_mission = jscript.get<MissionObject>();
 
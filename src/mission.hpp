@@ -44,8 +44,6 @@ class Mission {
     std::string& m_language;
     std::unique_ptr<MissionObject> m_mission;
 
-    [[nodiscard]] std::string LoadSchema();
-
 public:
     using ResourceType = std::variant<std::vector<ResourceID>, std::vector<std::filesystem::path>>;
 
@@ -62,7 +60,7 @@ public:
     ~Mission();
 
     [[nodiscard]] bool LoadFile(const std::string& path);
-    [[nodiscard]] bool LoadBuffer(const std::string& script);
+    [[nodiscard]] bool LoadBuffer(const std::string& script, bool validate = true);
     [[nodiscard]] bool LoadBinaryBuffer(const std::vector<uint8_t>& script);
     void SetLanguage(const std::string& language);
 
@@ -93,6 +91,7 @@ public:
     [[nodiscard]] std::string GetGameRules() const;
 
     [[nodiscard]] static std::string Mission_Sha256(const std::filesystem::path& path);
+    [[nodiscard]] static std::string LoadSchema();
 };
 
 #endif /* MISSION_HPP */
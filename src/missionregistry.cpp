@@ -24,9 +24,52 @@
 #include <SDL3/SDL.h>
 
 #include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <set>
+
+#include "jsoncache.hpp"
+
+/* record layout: the key of a mission script that passed schema validation, as eight 32 bit words */
+static constexpr uint32_t MissionRegistry_CacheKind = 4;
+static constexpr uint32_t MissionRegistry_CacheFieldCount = sizeof(JsonCacheKey) / sizeof(uint32_t);
 
 MissionRegistry::MissionRegistry(const std::filesystem::path& root) {
     std::array<size_t, MISSION_CATEGORY_COUNT> resource_end_indexes{};
+    const std::string schema = Mission::LoadSchema();
+    const auto cache_path = ResourceManager_GetCachePath("missions.bin");
+    const JsonCacheKey cache_key = JsonCache_ComputeKey(MissionRegistry_CacheKind, {schema});
+    std::set<JsonCacheKey> validated_scripts;
+    std::set<JsonCacheKey> loaded_scripts;
+
+    {
+        JsonCache cache;
+
+        if (cache.Open(cache_path, MissionRegistry_CacheKind, cache_key, MissionRegistry_CacheFieldCount)) {
+            for (uint32_t i = 0; i < cache.GetRecordCount(); ++i) {
+                JsonCacheKey script_key;
+
+                std::memcpy(script_key.data(), cache.GetRecord(i), sizeof(script_key));
+
+                validated_scripts.insert(script_key);
+            }
+        }
+    }
+
+    // scripts that passed the schema validation on an earlier launch are only parsed
+    const auto load_mission = [&validated_scripts, &loaded_scripts](const std::string& script) {
+        const JsonCacheKey script_key = JsonCache_ComputeKey(MissionRegistry_CacheKind, {script});
+        auto mission = std::make_shared<Mission>();
+
+        if (mission && mission->LoadBuffer(script, !validated_scripts.contains(script_key))) {
+            loaded_scripts.insert(script_key);
+
+        } else {
+            mission.reset();
+        }
+
+        return mission;
+    };
 
     for (uint32_t id = SC_MIS_S; id < SC_MIS_E; ++id) {
         uint32_t file_size = ResourceManager_GetResourceSize(static_cast<ResourceID>(id));
@@ -39,9 +82,9 @@ MissionRegistry::MissionRegistry(const std::filesystem::path& root) {
 
             std::string script(reinterpret_cast<const char*>(file_base), file_size);
 
-            auto mission = std::make_shared<Mission>();
+            auto mission = load_mission(script);
 
-            if (mission && mission->LoadBuffer(script)) {
+            if (mission) {
                 m_categories[mission->GetCategory()].push_back(std::move(mission));
             }
         }
@@ -57,10 +100,15 @@ MissionRegistry::MissionRegistry(const std::filesystem::path& root) {
         for (const auto& entry : std::filesystem::recursive_directory_iterator(root)) {
             if (entry.is_regular_file() && entry.path().extension() == ".json") {
                 if (entry.path().filename().string().ends_with(".mission.json")) {
-                    auto mission = std::make_shared<Mission>();
+                    std::ifstream fs(entry.path());
 
-                    if (mission->LoadFile(entry.path().string())) {
-                        m_categories[mission->GetCategory()].push_back(std::move(mission));
+                    if (fs) {
+                        std::string contents((std::istreambuf_iterator<char>(fs)), std::istreambuf_iterator<char>());
+                        auto mission = load_mission(contents);
+
+                        if (mission) {
+                            m_categories[mission->GetCategory()].push_back(std::move(mission));
+                        }
                     }
                 }
             }
@@ -79,6 +127,20 @@ MissionRegistry::MissionRegistry(const std::filesystem::path& root) {
                       });
         }
     }
+
+    if (loaded_scripts != validated_scripts) {
+        JsonCacheWriter writer(MissionRegistry_CacheFieldCount);
+
+        for (const auto& script_key : loaded_scripts) {
+            uint32_t words[MissionRegistry_CacheFieldCount];
+
+            std::memcpy(words, script_key.data(), sizeof(words));
+
+            writer.AddRecord({words[0], words[1], words[2], words[3], words[4], words[5], words[6], words[7]});
+        }
+
+        (void)writer.Write(cache_path, MissionRegistry_CacheKind, cache_key);
+    }
 }
 
 MissionRegistry::~MissionRegistry() {}
@@ -50,6 +50,10 @@ static constexpr uint32_t SUBTITLE_RGBA_TEXT = 0xFFFFFFFF;         // White text
 static constexpr uint32_t SUBTITLE_RGBA_OUTLINE = 0xFF000000;      // Black outline, fully opaque
 static constexpr uint32_t SUBTITLE_RGBA_TRANSPARENT = 0x00000000;  // Transparent
 
+// Binary cache record layout: language tag, start frame, end frame, caption
+static constexpr uint32_t SUBTITLE_CACHE_KIND = 3;
+static constexpr uint32_t SUBTITLE_CACHE_FIELD_COUNT = 4;
+
 MovieSubtitle::MovieSubtitle(const std::string& language) : m_language(language) {}
 
 MovieSubtitle::~MovieSubtitle() { ClearCache(); }
@@ -84,6 +88,7 @@ bool MovieSubtitle::LoadFromResource(ResourceID resource_id) {
     }
 
     auto filepath = (ResourceManager_FilePathGameBase / filename).lexically_normal();
+    const auto cache_path = ResourceManager_GetCachePath(std::string("subtitles/") + filename + ".bin");
 
     delete[] filename;
 
@@ -95,11 +100,95 @@ bool MovieSubtitle::LoadFromResource(ResourceID resource_id) {
     }
 
     std::string json_content((std::istreambuf_iterator<char>(fs)), std::istreambuf_iterator<char>());
+    const std::string schema_content = LoadSchema();
+    const JsonCacheKey key = JsonCache_ComputeKey(SUBTITLE_CACHE_KIND, {schema_content, json_content});
+    bool result;
+
+    if (LoadCache(cache_path, key, &result)) {
+        return result;
+    }
+
+    JsonCacheWriter cache_writer(SUBTITLE_CACHE_FIELD_COUNT);
+
+    result = ParseJson(json_content, schema_content, &cache_writer);
+
+    if (result) {
+        (void)cache_writer.Write(cache_path, SUBTITLE_CACHE_KIND, key);
+    }
+
+    return result;
+}
+
+bool MovieSubtitle::LoadCache(const std::filesystem::path& cache_path, const JsonCacheKey& key, bool* result) {
+    JsonCache cache;
+
+    if (!cache.Open(cache_path, SUBTITLE_CACHE_KIND, key, SUBTITLE_CACHE_FIELD_COUNT)) {
+        return false;
+    }
+
+    std::string_view selected_language;
+
+    for (uint32_t i = 0; i < cache.GetRecordCount(); ++i) {
+        const std::string_view language = cache.GetString(cache.GetRecord(i)[0]);
+
+        if (language == m_language) {
+            selected_language = language;
+            break;
+
+        } else if (language == "en-US") {
+            selected_language = language;
+        }
+    }
+
+    if (selected_language.empty()) {
+        SDL_Log("MovieSubtitle: No subtitle languages available\n");
+
+        *result = false;
+
+        return true;
+    }
 
-    return ParseJson(json_content, LoadSchema());
+    m_captions.clear();
+
+    for (uint32_t i = 0; i < cache.GetRecordCount(); ++i) {
+        const uint32_t* const record = cache.GetRecord(i);
+
+        if (cache.GetString(record[0]) == selected_language) {
+            (void)AddCaption({static_cast<int32_t>(record[1]), static_cast<int32_t>(record[2]),
+                              std::string(cache.GetString(record[3]))});
+        }
+    }
+
+    *result = FinishCaptions();
+
+    return true;
 }
 
-bool MovieSubtitle::ParseJson(const std::string& json_content, const std::string& schema_content) {
+bool MovieSubtitle::AddCaption(CaptionEntry&& caption) {
+    if (caption.start_frame >= caption.end_frame) {
+        SDL_Log("MovieSubtitle: Skipping entry with start >= end: '%s' (start=%d, end=%d)\n",
+                caption.caption.substr(0, 40).c_str(), caption.start_frame, caption.end_frame);
+
+        return false;
+    }
+
+    m_captions.push_back(std::move(caption));
+
+    return true;
+}
+
+bool MovieSubtitle::FinishCaptions() {
+    std::sort(m_captions.begin(), m_captions.end(),
+              [](const CaptionEntry& a, const CaptionEntry& b) { return a.start_frame < b.start_frame; });
+
+    m_loaded = !m_captions.empty();
+    m_current_index = -1;
+
+    return m_loaded;
+}
+
+bool MovieSubtitle::ParseJson(const std::string& json_content, const std::string& schema_content,
+                              JsonCacheWriter* cache_writer) {
     try {
         json j = json::parse(json_content);
 
@@ -143,28 +232,24 @@ bool MovieSubtitle::ParseJson(const std::string& json_content, const std::string
         m_captions.clear();
 
         for (const auto& entry : subtitle_obj[selected_language]) {
-            CaptionEntry caption;
+            (void)AddCaption(
+                {entry["start"].get<int32_t>(), entry["end"].get<int32_t>(), entry["caption"].get<std::string>()});
+        }
 
-            caption.start_frame = entry["start"].get<int32_t>();
-            caption.end_frame = entry["end"].get<int32_t>();
-            caption.caption = entry["caption"].get<std::string>();
+        // the cache keeps every language as the selection depends on the language setting
+        if (cache_writer) {
+            for (auto& [language, entries] : subtitle_obj.items()) {
+                const uint32_t language_offset = cache_writer->AddString(language);
 
-            if (caption.start_frame >= caption.end_frame) {
-                SDL_Log("MovieSubtitle: Skipping entry with start >= end: '%s' (start=%d, end=%d)\n",
-                        caption.caption.substr(0, 40).c_str(), caption.start_frame, caption.end_frame);
-                continue;
+                for (const auto& entry : entries) {
+                    cache_writer->AddRecord({language_offset, static_cast<uint32_t>(entry["start"].get<int32_t>()),
+                                             static_cast<uint32_t>(entry["end"].get<int32_t>()),
+                                             cache_writer->AddString(entry["caption"].get<std::string>())});
+                }
             }
-
-            m_captions.push_back(std::move(caption));
         }
 
-        std::sort(m_captions.begin(), m_captions.end(),
-                  [](const CaptionEntry& a, const CaptionEntry& b) { return a.start_frame < b.start_frame; });
-
-        m_loaded = !m_captions.empty();
-        m_current_index = -1;
-
-        return m_loaded;
+        return FinishCaptions();
 
     } catch (const json::parse_error& e) {
         SDL_Log("MovieSubtitle: JSON parse error: %s\n", e.what());
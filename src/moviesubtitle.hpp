@@ -23,10 +23,12 @@
 #define MOVIESUBTITLE_HPP
 
 #include <cstdint>
+#include <filesystem>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "jsoncache.hpp"
 #include "resource_manager.hpp"
 
 struct CaptionEntry {
@@ -134,7 +136,11 @@ public:
 
 private:
     static std::string LoadSchema();
-    bool ParseJson(const std::string& json_content, const std::string& schema_content = {});
+    bool ParseJson(const std::string& json_content, const std::string& schema_content = {},
+                   JsonCacheWriter* cache_writer = nullptr);
+    bool LoadCache(const std::filesystem::path& cache_path, const JsonCacheKey& key, bool* result);
+    bool AddCaption(CaptionEntry&& caption);
+    bool FinishCaptions();
     void RenderTextToCache(const std::string& text, int32_t max_width);
     static size_t FindBestSplitPoint(const std::string& text);
     void ClearCache();
@@ -0,0 +1,206 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "objectpool.hpp"
+
+#include <SDL3/SDL_assert.h>
+
+#include <algorithm>
+#include <new>
+
+ObjectPool* ObjectPool::s_pools{nullptr};
+
+static SDL_SpinLock ObjectPool_RegistryLock;
+
+ObjectPool::ObjectPool(const char* name) noexcept
+    : m_name(name), m_next(nullptr), m_lock(0), m_slabs(nullptr), m_free_lists{} {}
+
+ObjectPool& ObjectPool::Create(const char* name) noexcept {
+    // must not use any form of global initialization as pooled objects could be released after static destructors run
+    ObjectPool* pool = new (std::nothrow) ObjectPool(name);
+
+    SDL_assert(pool);
+
+    SDL_LockSpinlock(&ObjectPool_RegistryLock);
+
+    ObjectPool** tail = &s_pools;
+
+    while (*tail) {
+        tail = &(*tail)->m_next;
+    }
+
+    *tail = pool;
+
+    SDL_UnlockSpinlock(&ObjectPool_RegistryLock);
+
+    return *pool;
+}
+
+bool ObjectPool::Grow(const size_t size_class) noexcept {
+    const size_t block_size = (size_class + 1) * BLOCK_GRANULARITY;
+    const size_t block_count = std::max(SLAB_SIZE / block_size, MINIMUM_BLOCKS_PER_SLAB);
+    const size_t header_size = (sizeof(Slab) + BLOCK_GRANULARITY - 1) & ~(BLOCK_GRANULARITY - 1);
+    auto memory = static_cast<uint8_t*>(::operator new(header_size + block_count * block_size, std::nothrow));
+
+    if (!memory) {
+        return false;
+    }
+
+    auto slab = reinterpret_cast<Slab*>(memory);
+
+    slab->next = m_slabs;
+    m_slabs = slab;
+
+    uint8_t* blocks = &memory[header_size];
+
+    for (size_t i = block_count; i > 0; --i) {
+        auto block = reinterpret_cast<FreeBlock*>(&blocks[(i - 1) * block_size]);
+
+        block->next = m_free_lists[size_class];
+        m_free_lists[size_class] = block;
+    }
+
+    ++m_statistics.slabs;
+    ++m_turn_statistics.slabs;
+
+    return true;
+}
+
+void* ObjectPool::Allocate(const size_t size) noexcept {
+    const size_t size_class = (size + BLOCK_GRANULARITY - 1) / BLOCK_GRANULARITY - 1;
+    void* block;
+
+    SDL_LockSpinlock(&m_lock);
+
+    if (size_class >= SIZE_CLASS_COUNT) {
+        block = ::operator new(size, std::nothrow);
+
+        if (block) {
+            ++m_statistics.heap_allocations;
+            ++m_turn_statistics.heap_allocations;
+        }
+
+    } else {
+        if (m_free_lists[size_class]) {
+            ++m_statistics.recycled_allocations;
+            ++m_turn_statistics.recycled_allocations;
+
+        } else if (!Grow(size_class)) {
+            SDL_UnlockSpinlock(&m_lock);
+
+            return nullptr;
+        }
+
+        FreeBlock* free_block = m_free_lists[size_class];
+
+        m_free_lists[size_class] = free_block->next;
+        block = free_block;
+    }
+
+    if (block) {
+        ++m_statistics.allocations;
+        ++m_turn_statistics.allocations;
+
+        ++m_statistics.live_objects;
+        m_statistics.peak_live_objects = std::max(m_statistics.peak_live_objects, m_statistics.live_objects);
+
+        m_turn_statistics.peak_live_objects = std::max(m_turn_statistics.peak_live_objects, m_statistics.live_objects);
+    }
+
+    SDL_UnlockSpinlock(&m_lock);
+
+    return block;
+}
+
+void ObjectPool::Release(void* const pointer, const size_t size) noexcept {
+    if (!pointer) {
+        return;
+    }
+
+    const size_t size_class = (size + BLOCK_GRANULARITY - 1) / BLOCK_GRANULARITY - 1;
+
+    SDL_LockSpinlock(&m_lock);
+
+    SDL_assert(m_statistics.live_objects > 0);
+
+    if (size_class >= SIZE_CLASS_COUNT) {
+        ::operator delete(pointer);
+
+    } else {
+        auto block = static_cast<FreeBlock*>(pointer);
+
+        block->next = m_free_lists[size_class];
+        m_free_lists[size_class] = block;
+    }
+
+    ++m_statistics.releases;
+    ++m_turn_statistics.releases;
+
+    --m_statistics.live_objects;
+
+    SDL_UnlockSpinlock(&m_lock);
+}
+
+ObjectPoolStatistics ObjectPool::GetStatistics() noexcept {
+    SDL_LockSpinlock(&m_lock);
+
+    ObjectPoolStatistics statistics = m_statistics;
+
+    SDL_UnlockSpinlock(&m_lock);
+
+    return statistics;
+}
+
+ObjectPoolStatistics ObjectPool::GetTurnStatistics() noexcept {
+    SDL_LockSpinlock(&m_lock);
+
+    ObjectPoolStatistics statistics = m_turn_statistics;
+
+    statistics.live_objects = m_statistics.live_objects;
+
+    SDL_UnlockSpinlock(&m_lock);
+
+    return statistics;
+}
+
+void ObjectPool::ForEach(const std::function<void(ObjectPool& pool)>& function) noexcept {
+    SDL_LockSpinlock(&ObjectPool_RegistryLock);
+
+    ObjectPool* pool = s_pools;
+
+    SDL_UnlockSpinlock(&ObjectPool_RegistryLock);
+
+    // pools are never unlinked, so the list can be walked without holding the registry lock
+    for (; pool; pool = pool->m_next) {
+        function(*pool);
+    }
+}
+
+void ObjectPool::ResetTurnStatistics() noexcept {
+    ForEach([](ObjectPool& pool) {
+        SDL_LockSpinlock(&pool.m_lock);
+
+        pool.m_turn_statistics = ObjectPoolStatistics();
+        pool.m_turn_statistics.peak_live_objects = pool.m_statistics.live_objects;
+
+        SDL_UnlockSpinlock(&pool.m_lock);
+    });
+}
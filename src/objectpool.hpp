@@ -0,0 +1,179 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef OBJECTPOOL_HPP
+#define OBJECTPOOL_HPP
+
+#include <SDL3/SDL_atomic.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+
+/**
+ * \struct ObjectPoolStatistics
+ * \brief Allocation counters of an object pool.
+ *
+ * Recycled allocations are served from the free list without touching the system heap. Heap allocations are the
+ * blocks that did not fit any size class and were forwarded to the global allocator.
+ */
+struct ObjectPoolStatistics {
+    uint64_t allocations{0};
+    uint64_t recycled_allocations{0};
+    uint64_t heap_allocations{0};
+    uint64_t releases{0};
+    uint32_t slabs{0};
+    uint32_t live_objects{0};
+    uint32_t peak_live_objects{0};
+};
+
+/**
+ * \class ObjectPool
+ * \brief Slab allocator with segregated free lists for frequently churned SmartObject types.
+ *
+ * A pool serves one class hierarchy. Blocks are grouped into size classes of BLOCK_GRANULARITY bytes so that every
+ * derived type of a polymorphic base (Task, UnitPath, Reminder) recycles blocks of its own size. Memory is carved from
+ * slabs that are never returned to the system heap while the process runs, released blocks are pushed to the free
+ * list of their size class and handed out again on the next allocation of the same size.
+ *
+ * Pooled classes route their class specific operator new and sized operator delete to the pool. This covers plain
+ * `new (std::nothrow)` expressions, the RegisterClass allocators invoked by SmartFileReader::ReadObject() and the
+ * `delete this` in SmartObject::Decrement() as the virtual destructor reports the size of the dynamic type.
+ *
+ * Pools must outlive every object they serve, including objects referenced by static SmartPointers that are
+ * destroyed at program exit. Pool instances are therefore created on first use and never destroyed.
+ */
+class ObjectPool {
+    static constexpr size_t BLOCK_GRANULARITY = 16;
+    static constexpr size_t SIZE_CLASS_COUNT = 256;
+    static constexpr size_t SLAB_SIZE = 64 * 1024;
+    static constexpr size_t MINIMUM_BLOCKS_PER_SLAB = 8;
+
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct Slab {
+        Slab* next;
+    };
+
+    static ObjectPool* s_pools;
+
+    const char* m_name;
+    ObjectPool* m_next;
+    SDL_SpinLock m_lock;
+    Slab* m_slabs;
+    FreeBlock* m_free_lists[SIZE_CLASS_COUNT];
+    ObjectPoolStatistics m_statistics;
+    ObjectPoolStatistics m_turn_statistics;
+
+    explicit ObjectPool(const char* name) noexcept;
+
+    [[nodiscard]] bool Grow(const size_t size_class) noexcept;
+
+public:
+    ObjectPool(const ObjectPool& other) = delete;
+    ObjectPool& operator=(const ObjectPool& other) = delete;
+
+    /**
+     * \brief Creates a named pool and links it into the list of pools reported by the statistics functions.
+     *
+     * \param name Human readable name of the served class hierarchy. The string must have static storage duration.
+     * \return The new pool. The pool is intentionally never destroyed.
+     */
+    [[nodiscard]] static ObjectPool& Create(const char* name) noexcept;
+
+    /**
+     * \brief Allocates a block of at least the requested size.
+     *
+     * \param size Size of the object in bytes.
+     * \return Pointer to the block or nullptr if the system is out of memory.
+     */
+    [[nodiscard]] void* Allocate(const size_t size) noexcept;
+
+    /**
+     * \brief Returns a block to the pool.
+     *
+     * \param pointer Block previously returned by Allocate() of the same pool. nullptr is ignored.
+     * \param size The size that was passed to Allocate().
+     */
+    void Release(void* const pointer, const size_t size) noexcept;
+
+    [[nodiscard]] inline const char* GetName() const noexcept { return m_name; }
+    [[nodiscard]] ObjectPoolStatistics GetStatistics() noexcept;
+    [[nodiscard]] ObjectPoolStatistics GetTurnStatistics() noexcept;
+
+    /**
+     * \brief Invokes a function for each created pool.
+     *
+     * \param function Called with every pool in creation order.
+     */
+    static void ForEach(const std::function<void(ObjectPool& pool)>& function) noexcept;
+
+    /**
+     * \brief Clears the per turn counters of all pools. The live object count carries over as the new baseline.
+     */
+    static void ResetTurnStatistics() noexcept;
+};
+
+/**
+ * \brief Declares the pooled class specific operator new and sized operator delete inside a class definition.
+ *
+ * Derived classes of the declaring class share its pool, each dynamic type recycles blocks of its own size class.
+ */
+#define OBJECTPOOL_DECLARE_ALLOCATOR()                                          \
+    static void* operator new(size_t size);                                     \
+    static void* operator new(size_t size, const std::nothrow_t& tag) noexcept; \
+    static void operator delete(void* pointer, size_t size) noexcept
+
+/**
+ * \brief Defines the operators declared by OBJECTPOOL_DECLARE_ALLOCATOR() for a class.
+ *
+ * Expands to a `<class_name>_GetObjectPool()` accessor of a pool named after the class, created on first use, and to
+ * the operator definitions that route to it. The throwing operator new reports exhaustion with std::bad_alloc.
+ */
+#define OBJECTPOOL_DEFINE_ALLOCATOR(class_name)                                             \
+    static ObjectPool& class_name##_GetObjectPool() {                                       \
+        static ObjectPool& pool = ObjectPool::Create(#class_name);                          \
+                                                                                            \
+        return pool;                                                                        \
+    }                                                                                       \
+                                                                                            \
+    void* class_name::operator new(size_t size) {                                           \
+        void* pointer = class_name##_GetObjectPool().Allocate(size);                        \
+                                                                                            \
+        if (!pointer) {                                                                     \
+            throw std::bad_alloc();                                                         \
+        }                                                                                   \
+                                                                                            \
+        return pointer;                                                                     \
+    }                                                                                       \
+                                                                                            \
+    void* class_name::operator new(size_t size, const std::nothrow_t& /* tag */) noexcept { \
+        return class_name##_GetObjectPool().Allocate(size);                                 \
+    }                                                                                       \
+                                                                                            \
+    void class_name::operator delete(void* pointer, size_t size) noexcept {                 \
+        class_name##_GetObjectPool().Release(pointer, size);                                \
+    }
+
+#endif /* OBJECTPOOL_HPP */
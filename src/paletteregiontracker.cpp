@@ -0,0 +1,141 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "paletteregiontracker.hpp"
+
+#include <algorithm>
+#include <array>
+
+PaletteRegionTracker::PaletteRegionTracker() : m_width(0), m_height(0), m_tile_count_x(0), m_tile_count_y(0) {}
+
+void PaletteRegionTracker::Resize(int32_t width, int32_t height) {
+    m_width = std::max(width, 0);
+    m_height = std::max(height, 0);
+    m_tile_count_x = (m_width + TILE_SIZE - 1) / TILE_SIZE;
+    m_tile_count_y = (m_height + TILE_SIZE - 1) / TILE_SIZE;
+
+    m_tiles.assign(m_tile_count_x * m_tile_count_y, Tile{{}, true, true});
+    m_changed_colors.set();
+}
+
+void PaletteRegionTracker::InvalidatePixels(int32_t x, int32_t y, int32_t width, int32_t height) noexcept {
+    const int32_t first_x = std::max(x, 0);
+    const int32_t first_y = std::max(y, 0);
+    const int32_t last_x = std::min(x + width, m_width);
+    const int32_t last_y = std::min(y + height, m_height);
+
+    if (first_x >= last_x || first_y >= last_y) {
+        return;
+    }
+
+    for (int32_t tile_y = first_y / TILE_SIZE; tile_y <= (last_y - 1) / TILE_SIZE; ++tile_y) {
+        for (int32_t tile_x = first_x / TILE_SIZE; tile_x <= (last_x - 1) / TILE_SIZE; ++tile_x) {
+            Tile& tile = m_tiles[tile_y * m_tile_count_x + tile_x];
+
+            tile.is_stale = true;
+            tile.is_redrawn = true;
+        }
+    }
+}
+
+void PaletteRegionTracker::ScanTile(Tile& tile, const uint8_t* pixels, int32_t pitch, int32_t width,
+                                    int32_t height) const noexcept {
+    // plain byte stores do not form a dependency chain like setting bits in a word would
+    std::array<uint8_t, COLOR_COUNT> is_present{};
+
+    for (int32_t y = 0; y < height; ++y) {
+        for (int32_t x = 0; x < width; ++x) {
+            is_present[pixels[x]] = 1;
+        }
+
+        pixels = &pixels[pitch];
+    }
+
+    tile.colors.reset();
+
+    for (int32_t i = 0; i < COLOR_COUNT; ++i) {
+        if (is_present[i]) {
+            tile.colors.set(i);
+        }
+    }
+
+    tile.is_stale = false;
+}
+
+void PaletteRegionTracker::CollectChangedRegions(const uint8_t* pixels, int32_t pitch,
+                                                 std::vector<PaletteRegion>& regions) {
+    regions.clear();
+
+    if (m_changed_colors.none()) {
+        return;
+    }
+
+    size_t affected_tile_count = 0;
+
+    for (int32_t tile_y = 0; tile_y < m_tile_count_y; ++tile_y) {
+        const int32_t y = tile_y * TILE_SIZE;
+        const int32_t height = std::min(TILE_SIZE, m_height - y);
+        int32_t span_start = -1;
+
+        for (int32_t tile_x = 0; tile_x <= m_tile_count_x; ++tile_x) {
+            bool is_affected = false;
+
+            if (tile_x < m_tile_count_x) {
+                Tile& tile = m_tiles[tile_y * m_tile_count_x + tile_x];
+                const int32_t x = tile_x * TILE_SIZE;
+
+                if (tile.is_redrawn) {
+                    tile.is_redrawn = false;
+
+                    is_affected = true;
+
+                } else {
+                    if (tile.is_stale) {
+                        ScanTile(tile, &pixels[y * pitch + x], pitch, std::min(TILE_SIZE, m_width - x), height);
+                    }
+
+                    is_affected = (tile.colors & m_changed_colors).any();
+                }
+            }
+
+            if (is_affected) {
+                ++affected_tile_count;
+
+                if (span_start < 0) {
+                    span_start = tile_x;
+                }
+
+            } else if (span_start >= 0) {
+                const int32_t x = span_start * TILE_SIZE;
+
+                regions.push_back({x, y, std::min(tile_x * TILE_SIZE, m_width) - x, height});
+
+                span_start = -1;
+            }
+        }
+    }
+
+    if (affected_tile_count == m_tiles.size() && affected_tile_count > 0) {
+        regions.assign(1, {0, 0, m_width, m_height});
+    }
+
+    m_changed_colors.reset();
+}
@@ -0,0 +1,104 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef PALETTEREGIONTRACKER_HPP
+#define PALETTEREGIONTRACKER_HPP
+
+#include <bitset>
+#include <cstdint>
+#include <vector>
+
+/**
+ * \struct PaletteRegion
+ * \brief Screen rectangle in pixels.
+ */
+struct PaletteRegion {
+    int32_t x;
+    int32_t y;
+    int32_t width;
+    int32_t height;
+};
+
+/**
+ * \class PaletteRegionTracker
+ * \brief Finds the parts of an indexed frame that are affected by palette changes.
+ *
+ * The frame is divided into square tiles and every tile remembers which palette indices it contains. Palette cycling
+ * typically rotates a few water or light colors, so only the tiles that show those colors have to be converted to RGB
+ * again.
+ *
+ * Scanning a tile costs about as much as converting it, so a tile that was redrawn since the previous query is reported
+ * as affected without a scan. Its index set is rebuilt at the next query if it was not redrawn again in between.
+ */
+class PaletteRegionTracker {
+public:
+    static constexpr int32_t TILE_SIZE = 64;
+    static constexpr int32_t COLOR_COUNT = 256;
+
+    PaletteRegionTracker();
+
+    /**
+     * \brief Sets up the tiles for a frame size. All tiles become invalid and all colors changed.
+     *
+     * \param width Frame width in pixels.
+     * \param height Frame height in pixels.
+     */
+    void Resize(int32_t width, int32_t height);
+
+    /**
+     * \brief Marks the tiles that overlap a rectangle as redrawn. Their index sets have to be rebuilt.
+     */
+    void InvalidatePixels(int32_t x, int32_t y, int32_t width, int32_t height) noexcept;
+
+    inline void MarkColorChanged(uint8_t index) noexcept { m_changed_colors.set(index); }
+    inline void MarkAllColorsChanged() noexcept { m_changed_colors.set(); }
+    [[nodiscard]] inline bool HasChangedColors() const noexcept { return m_changed_colors.any(); }
+
+    /**
+     * \brief Collects the regions that contain changed colors and resets the changed color set.
+     *
+     * Affected tiles of a tile row are merged into horizontal spans. If every tile is affected a single full frame
+     * region is returned.
+     *
+     * \param pixels Current indexed frame, used to rescan invalidated tiles.
+     * \param pitch Frame row length in bytes.
+     * \param regions Receives the regions, previous contents are discarded.
+     */
+    void CollectChangedRegions(const uint8_t* pixels, int32_t pitch, std::vector<PaletteRegion>& regions);
+
+private:
+    struct Tile {
+        std::bitset<COLOR_COUNT> colors;
+        bool is_stale;
+        bool is_redrawn;
+    };
+
+    int32_t m_width;
+    int32_t m_height;
+    int32_t m_tile_count_x;
+    int32_t m_tile_count_y;
+    std::vector<Tile> m_tiles;
+    std::bitset<COLOR_COUNT> m_changed_colors;
+
+    void ScanTile(Tile& tile, const uint8_t* pixels, int32_t pitch, int32_t width, int32_t height) const noexcept;
+};
+
+#endif /* PALETTEREGIONTRACKER_HPP */
@@ -28,6 +28,7 @@
 #include "ai.hpp"
 #include "ailog.hpp"
 #include "aiplayer.hpp"
+#include "frameprofiler.hpp"
 #include "message_manager.hpp"
 #include "mouseevent.hpp"
 #include "resource_manager.hpp"
@@ -132,6 +133,8 @@ void PathsManager::RemoveRequest(UnitInfo* unit) {
 }
 
 void PathsManager::PollResults() {
+    FRAME_PROFILER_SCOPE("PollPathResults");
+
     // Poll completed results from worker thread
     WorkerThread<PathWorkerJob, PathWorkerResult>::CompletedJob completed_job(nullptr, std::nullopt);
 
@@ -187,6 +190,8 @@ void PathsManager::PollResults() {
 }
 
 void PathsManager::DispatchJobs() {
+    FRAME_PROFILER_SCOPE("DispatchPathJobs");
+
     // Dispatch new jobs from pending queue (as many as time allows)
     while (m_pending_requests.GetCount() > 0) {
         // Process mouse events to keep UI responsive
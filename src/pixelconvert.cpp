@@ -0,0 +1,106 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "pixelconvert.hpp"
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_intrin.h>
+
+static void PixelConvert_Index8ToRgb32Generic(const uint8_t* source, int32_t source_pitch, uint8_t* target,
+                                              int32_t target_pitch, int32_t width, int32_t height,
+                                              const uint32_t* color_table) noexcept {
+    for (int32_t y = 0; y < height; ++y) {
+        uint32_t* const row = reinterpret_cast<uint32_t*>(target);
+        int32_t x = 0;
+
+        // independent lookups let the loads of eight pixels overlap
+        for (; x + 8 <= width; x += 8) {
+            const uint8_t* const indices = &source[x];
+            const uint32_t pixel0 = color_table[indices[0]];
+            const uint32_t pixel1 = color_table[indices[1]];
+            const uint32_t pixel2 = color_table[indices[2]];
+            const uint32_t pixel3 = color_table[indices[3]];
+            const uint32_t pixel4 = color_table[indices[4]];
+            const uint32_t pixel5 = color_table[indices[5]];
+            const uint32_t pixel6 = color_table[indices[6]];
+            const uint32_t pixel7 = color_table[indices[7]];
+
+            row[x + 0] = pixel0;
+            row[x + 1] = pixel1;
+            row[x + 2] = pixel2;
+            row[x + 3] = pixel3;
+            row[x + 4] = pixel4;
+            row[x + 5] = pixel5;
+            row[x + 6] = pixel6;
+            row[x + 7] = pixel7;
+        }
+
+        for (; x < width; ++x) {
+            row[x] = color_table[source[x]];
+        }
+
+        source = &source[source_pitch];
+        target = &target[target_pitch];
+    }
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_TARGETING("avx2")
+    PixelConvert_Index8ToRgb32Avx2(const uint8_t* source, int32_t source_pitch, uint8_t* target, int32_t target_pitch,
+                                   int32_t width, int32_t height, const uint32_t* color_table) noexcept {
+    const int* const table = reinterpret_cast<const int*>(color_table);
+
+    for (int32_t y = 0; y < height; ++y) {
+        uint32_t* const row = reinterpret_cast<uint32_t*>(target);
+        int32_t x = 0;
+
+        for (; x + 8 <= width; x += 8) {
+            const __m256i indices = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(&source[x])));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&row[x]), _mm256_i32gather_epi32(table, indices, 4));
+        }
+
+        for (; x < width; ++x) {
+            row[x] = color_table[source[x]];
+        }
+
+        source = &source[source_pitch];
+        target = &target[target_pitch];
+    }
+}
+#endif /* SDL_AVX2_INTRINSICS */
+
+void PixelConvert_Index8ToRgb32(const uint8_t* source, int32_t source_pitch, void* target, int32_t target_pitch,
+                                int32_t width, int32_t height, const uint32_t* color_table) noexcept {
+#ifdef SDL_AVX2_INTRINSICS
+    static const bool has_avx2 = SDL_HasAVX2();
+
+    if (has_avx2) {
+        PixelConvert_Index8ToRgb32Avx2(source, source_pitch, static_cast<uint8_t*>(target), target_pitch, width, height,
+                                       color_table);
+
+        return;
+    }
+#endif /* SDL_AVX2_INTRINSICS */
+
+    PixelConvert_Index8ToRgb32Generic(source, source_pitch, static_cast<uint8_t*>(target), target_pitch, width, height,
+                                      color_table);
+}
@@ -0,0 +1,45 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef PIXELCONVERT_HPP
+#define PIXELCONVERT_HPP
+
+#include <cstdint>
+
+/**
+ * \brief Converts a rectangle of palette indices to 32 bit pixels in a single pass.
+ *
+ * Every source byte is replaced by its color table entry, so the color table must already be mapped to the pixel format
+ * of the target, for example a locked streaming texture. The function picks an AVX2 gather kernel at run time if the
+ * processor supports it and an unrolled table lookup loop otherwise. Both produce identical output.
+ *
+ * \param source Address of the top left palette index.
+ * \param source_pitch Source row length in bytes.
+ * \param target Address of the top left target pixel, 4 byte aligned.
+ * \param target_pitch Target row length in bytes.
+ * \param width Rectangle width in pixels.
+ * \param height Rectangle height in pixels.
+ * \param color_table 256 pixel values indexed by palette index.
+ */
+void PixelConvert_Index8ToRgb32(const uint8_t* source, int32_t source_pitch, void* target, int32_t target_pitch,
+                                int32_t width, int32_t height, const uint32_t* color_table) noexcept;
+
+#endif /* PIXELCONVERT_HPP */
@@ -91,11 +91,10 @@ void PlanetSelectMenu::DrawMaps(int32_t draw_to_screen) {
         }
     }
 
-    uint8_t* world_resource = ResourceManager_ReadResource(static_cast<ResourceID>(SNOW_PIC + world / 6));
-    struct ImageBigHeader* world_image = reinterpret_cast<struct ImageBigHeader*>(world_resource);
+    const struct ImageBigHeader* world_image = reinterpret_cast<const struct ImageBigHeader*>(
+        ResourceManager_GetResourceView(static_cast<ResourceID>(SNOW_PIC + world / 6)));
     int32_t ulx = world_image->ulx;
     int32_t uly = world_image->uly;
-    delete[] world_resource;
 
     WindowManager_LoadBigImage(static_cast<ResourceID>(SNOW_PIC + world / 6), window, window->width, false, false,
                                WindowManager_ScaleUlx(window, ulx), WindowManager_ScaleUly(window, uly), false);
@@ -171,23 +170,23 @@ void PlanetSelectMenu::DrawTexts() {
 
 void PlanetSelectMenu::AnimateWorldChange(int32_t world1, int32_t world2, bool direction) {
     ResourceID resource;
-    uint8_t* world1_image;
-    uint8_t* world2_image;
-    uint8_t* stars_image;
+    const uint8_t* world1_image;
+    const uint8_t* world2_image;
+    const uint8_t* stars_image;
     uint8_t* window_buffer;
 
     resource = static_cast<ResourceID>(SNOW_PIC + (world1 / 6));
-    world1_image = ResourceManager_ReadResource(resource);
+    world1_image = ResourceManager_GetResourceView(resource);
 
     resource = static_cast<ResourceID>(SNOW_PIC + (world2 / 6));
-    world2_image = ResourceManager_ReadResource(resource);
+    world2_image = ResourceManager_GetResourceView(resource);
 
-    stars_image = ResourceManager_ReadResource(STAR_PIC);
+    stars_image = ResourceManager_GetResourceView(STAR_PIC);
 
     if (world1_image && world2_image && stars_image) {
-        struct ImageBigHeader* image1_header = reinterpret_cast<struct ImageBigHeader*>(world1_image);
-        struct ImageBigHeader* image2_header = reinterpret_cast<struct ImageBigHeader*>(world2_image);
-        struct ImageBigHeader* image3_header = reinterpret_cast<struct ImageBigHeader*>(stars_image);
+        const struct ImageBigHeader* image1_header = reinterpret_cast<const struct ImageBigHeader*>(world1_image);
+        const struct ImageBigHeader* image2_header = reinterpret_cast<const struct ImageBigHeader*>(world2_image);
+        const struct ImageBigHeader* image3_header = reinterpret_cast<const struct ImageBigHeader*>(stars_image);
         int32_t width;
         int32_t height;
         Rect bounds;
@@ -239,10 +238,6 @@ void PlanetSelectMenu::AnimateWorldChange(int32_t world1, int32_t world2, bool d
 
         delete[] window_buffer;
     }
-
-    delete[] world1_image;
-    delete[] world2_image;
-    delete[] stars_image;
 }
 
 void PlanetSelectMenu::Init() {
@@ -261,6 +256,13 @@ void PlanetSelectMenu::Init() {
         ButtonInit(i);
     }
 
+    // the planet pictures are read in the background while the menu draws
+    for (int32_t resource = SNOW_PIC; resource <= DSRT_PIC; ++resource) {
+        ResourceManager_PrefetchResource(static_cast<ResourceID>(resource));
+    }
+
+    ResourceManager_PrefetchResource(STAR_PIC);
+
     WindowManager_LoadBigImage(PLANETSE, window, window->width, false, false, -1, -1, true);
 
     for (int32_t i = 0; i < PLANET_SELECT_MENU_MAP_SLOT_COUNT; ++i) {
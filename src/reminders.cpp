@@ -23,6 +23,7 @@
 
 #include "aiattack.hpp"
 #include "ailog.hpp"
+#include "objectpool.hpp"
 #include "task_manager.hpp"
 #include "taskdebugger.hpp"
 #include "unitinfo.hpp"
@@ -32,6 +33,8 @@ Reminder::Reminder() {}
 
 Reminder::~Reminder() {}
 
+OBJECTPOOL_DEFINE_ALLOCATOR(Reminder)
+
 RemindTurnStart::RemindTurnStart(Task& task) : task(task) { this->task->ChangeIsScheduledForTurnStart(true); }
 
 RemindTurnStart::~RemindTurnStart() {}
@@ -22,6 +22,7 @@
 #ifndef REMINDERS_HPP
 #define REMINDERS_HPP
 
+#include "objectpool.hpp"
 #include "smartpointer.hpp"
 #include "task.hpp"
 
@@ -39,6 +40,9 @@ public:
     Reminder();
     virtual ~Reminder();
 
+    /** Pooled allocation, see ObjectPool. */
+    OBJECTPOOL_DECLARE_ALLOCATOR();
+
     virtual void Execute() = 0;
     virtual int32_t GetType() = 0;
 };
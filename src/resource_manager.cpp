@@ -23,6 +23,7 @@
 
 #include <SDL3/SDL.h>
 
+#include <algorithm>
 #include <format>
 #include <fstream>
 #include <memory>
@@ -38,12 +39,14 @@
 #include "crash_reporter.hpp"
 #include "cursor.hpp"
 #include "drawloadbar.hpp"
+#include "drawmap.hpp"
 #include "enums.hpp"
 #include "game_manager.hpp"
 #include "gamesetup.hpp"
 #include "gfx.hpp"
 #include "hash.hpp"
 #include "help.hpp"
+#include "initgraph.hpp"
 #include "language.hpp"
 #include "menu.hpp"
 #include "message_manager.hpp"
@@ -51,6 +54,9 @@
 #include "paths.hpp"
 #include "paths_manager.hpp"
 #include "randomizer.hpp"
+#include "resourcearchive.hpp"
+#include "resourceloader.hpp"
+#include "saveload.hpp"
 #include "screendump.h"
 #include "scripter.hpp"
 #include "settings.hpp"
@@ -100,6 +106,7 @@ static const std::unordered_map<TeamClanType, std::string> ResourceManager_Clans
 static std::unique_ptr<std::ofstream> ResourceManager_LogFile;
 static SDL_Mutex* ResourceManager_LogMutex;
 static SDL_ThreadID ResourceManager_MainThreadID;
+static bool ResourceManager_InitGraphRunning;
 static std::shared_ptr<MissionManager> ResourceManager_MissionManager;
 static std::shared_ptr<Attributes> ResourceManager_UnitAttributes;
 static std::shared_ptr<Clans> ResourceManager_Clans;
@@ -111,9 +118,11 @@ static std::unique_ptr<PathsManager> ResourceManager_PathsManager;
 static std::unique_ptr<SoundManager> ResourceManager_SoundManager;
 static std::unique_ptr<std::unordered_map<std::string, ResourceID>> ResourceManager_ResourceIDLUT;
 static std::unique_ptr<std::vector<SDL_Mutex*>> ResourceManager_SDLMutexes;
+static std::unique_ptr<ResourceLoader> ResourceManager_ResourceLoader;
 static std::string ResourceManager_SystemLocale{"en-US"};
 
 FILE* res_file_handle_array[2];
+static ResourceArchive ResourceManager_ResArchives[SDL_arraysize(res_file_handle_array)];
 struct res_index* ResourceManager_ResItemTable;
 struct GameResourceMeta* ResourceManager_ResMetaTable;
 uint8_t ResourceManager_ResFileCount;
@@ -138,7 +147,6 @@ ColorIndex* ResourceManager_DarkeningColorIndexTable;
 ColorIndex* ResourceManager_BrightnessColorIndexTable;
 
 uint8_t* ResourceManager_Minimap;
-uint8_t* ResourceManager_MinimapUnits;
 uint8_t* ResourceManager_MinimapFov;
 uint8_t* ResourceManager_MinimapBgImage;
 
@@ -176,11 +184,16 @@ static void ResourceManager_InitInternals();
 static void ResourceManager_InitResourceHandler();
 static void ResourceManager_PreloadPatches();
 static void ResourceManager_LoadMaxResources();
+static void ResourceManager_InitResourceLoader();
+static uint8_t* ResourceManager_PrefetchLoad(uint32_t id);
+static void ResourceManager_PrefetchUnitSprites();
 static int32_t ResourceManager_InitResManager();
 static void ResourceManager_TestMouse();
 static bool ResourceManager_GetGameDataPath(std::filesystem::path& path);
 static int32_t ResourceManager_BuildResourceTable(const std::filesystem::path filepath);
 static int32_t ResourceManager_BuildColorTables();
+static void ResourceManager_InitColorTables();
+static void ResourceManager_InitResourceIDs();
 static void ResourceManager_InitMinimapResources();
 static void ResourceManager_InitMainmapResources();
 static SDL_AssertState SDLCALL ResourceManager_AssertionHandler(const SDL_AssertData* data, void* userdata);
@@ -429,42 +442,91 @@ void ResourceManager_InitGameDataPath() {
     ResourceManager_FilePathGameData = path;
 }
 
+/* Thrown by ResourceManager_ExitGame() on an initialization worker thread. It does not derive from std::exception, so
+ * the error handlers of the definition parsers let it pass to InitGraph, which hands it to the main thread.
+ */
+struct ResourceManager_ExitRequest {
+    int32_t error_code;
+};
+
 void ResourceManager_InitResources() {
+    InitGraph graph;
+
+    ResourceManager_MainThreadID = SDL_GetCurrentThreadID();
+
     // nothing is available
-    Resourcemanager_InitLocale();
-    ResourceManager_InitResourceHandler();
-    ResourceManager_PreloadPatches();
+    const uint32_t locale = graph.AddStage("locale", Resourcemanager_InitLocale, {}, true);
+    const uint32_t resource_handler =
+        graph.AddStage("resource_handler", ResourceManager_InitResourceHandler, {locale}, true);
+    const uint32_t patches = graph.AddStage("patches", ResourceManager_PreloadPatches, {resource_handler}, true);
     // resources from patches are available
-    ResourceManager_InitLanguageManager();
+    const uint32_t language = graph.AddStage("language", ResourceManager_InitLanguageManager, {patches}, true);
     // localized strings are available
-    ResourceManager_InitBasePath();
-    ResourceManager_InitPrefPath();
+    const uint32_t base_path = graph.AddStage("base_path", ResourceManager_InitBasePath, {language}, true);
+    const uint32_t pref_path = graph.AddStage("pref_path", ResourceManager_InitPrefPath, {base_path}, true);
     // SDL file logging, resource file system base and pref paths are available
-    ResourceManager_InitSettings();
+    const uint32_t settings = graph.AddStage("settings", ResourceManager_InitSettings, {pref_path}, true);
     // game settings are available
-    ResourceManager_InitSDL();
+    const uint32_t sdl = graph.AddStage("sdl", ResourceManager_InitSDL, {settings}, true);
     // SDL video sub-system and logging are available, the first run setup can show native dialogs
-    ResourceManager_InitGameDataPath();
+    const uint32_t game_data_path = graph.AddStage("game_data_path", ResourceManager_InitGameDataPath, {sdl}, true);
     // resource file system game data path is available
-    ResourceManager_TestMemory();
-    ResourceManager_TestDiskSpace();
+    const uint32_t test_memory = graph.AddStage("test_memory", ResourceManager_TestMemory, {game_data_path}, true);
+    const uint32_t test_disk_space =
+        graph.AddStage("test_disk_space", ResourceManager_TestDiskSpace, {test_memory}, true);
     // tested RAM and NVM space
-    ResourceManager_LoadMaxResources();
+    const uint32_t max_resources =
+        graph.AddStage("max_resources", ResourceManager_LoadMaxResources, {test_disk_space}, true);
     // MAX resources are available
-    ResourceManager_InitUnitAttributes();
+    const uint32_t resource_loader =
+        graph.AddStage("resource_loader", ResourceManager_InitResourceLoader, {max_resources}, true);
+    // MAX resources can be prefetched in the background
+    const uint32_t resource_ids = graph.AddStage("resource_ids", ResourceManager_InitResourceIDs, {}, false);
+    const uint32_t color_tables = graph.AddStage("color_tables", ResourceManager_InitColorTables, {}, false);
+    // the definition parsers read resources with ResourceManager_ReadResource() which is safe on any thread
+    const uint32_t attributes =
+        graph.AddStage("attributes", ResourceManager_InitUnitAttributes, {max_resources, resource_ids}, false);
     // MAX unit attribute definitions are available
-    ResourceManager_InitClans();
+    const uint32_t clans = graph.AddStage("clans", ResourceManager_InitClans, {max_resources, resource_ids}, false);
     // MAX clan definitions are available
-    ResourceManager_InitUnits();
+    const uint32_t units =
+        graph.AddStage("units", ResourceManager_InitUnits, {max_resources, resource_ids, resource_loader}, true);
     // MAX unit definitions are available
-    ResourceManager_InitPathsManager();
+    const uint32_t paths_manager = graph.AddStage("paths_manager", ResourceManager_InitPathsManager, {units}, true);
     // PathsManager is available
-    Randomizer_Init();
-    Scripter::Init();
-    ResourceManager_InitInternals();
-    ResourceManager_InitHelpManager();
-    ResourceManager_InitMissionManager();
-    ResourceManager_TestMouse();
+    const uint32_t randomizer = graph.AddStage("randomizer", Randomizer_Init, {paths_manager}, true);
+    const uint32_t scripter = graph.AddStage("scripter", Scripter::Init, {randomizer}, true);
+    // the system locale is switched to the configured language after the definitions above captured it
+    const uint32_t internals =
+        graph.AddStage("internals", ResourceManager_InitInternals, {scripter, color_tables, attributes, clans}, true);
+    graph.AddStage("sound_manager", ResourceManager_InitSoundManager, {internals}, false);
+    graph.AddStage("help_manager", ResourceManager_InitHelpManager, {internals}, false);
+    graph.AddStage("mission_manager", ResourceManager_InitMissionManager, {internals}, false);
+    graph.AddStage("test_mouse", ResourceManager_TestMouse, {internals}, true);
+
+    ResourceManager_InitGraphRunning = true;
+
+    try {
+        graph.Run(std::clamp(SDL_GetNumLogicalCPUCores() - 1, 0, 3));
+
+    } catch (const ResourceManager_ExitRequest& request) {
+        ResourceManager_InitGraphRunning = false;
+
+        // the workers joined, exit logos, dialogs and the SDL shutdown are safe now
+        ResourceManager_ExitGame(request.error_code);
+    }
+
+    ResourceManager_InitGraphRunning = false;
+
+    graph.LogReport();
+
+    if (ResourceManager_GetSettings()->GetNumericValue("startup_report")) {
+        std::ofstream file(ResourceManager_FilePathGamePref / "startup_report.json", std::ios::out | std::ios::trunc);
+
+        if (!file.is_open() || !graph.WriteReport(file)) {
+            SDL_Log("Failed to write startup report.\n");
+        }
+    }
 }
 
 void ResourceManager_InitSDL() {
@@ -538,7 +600,6 @@ void ResourceManager_InitInternals() {
 
     ResourceManager_DisableEnhancedGraphics = !ResourceManager_GetSettings()->GetNumericValue("enhanced_graphics");
 
-    ResourceManager_InitSoundManager();
     register_pause(-1, nullptr);
     screendump_register(GNW_KB_KEY_LALT_C, screendump_pcx);
 }
@@ -550,6 +611,10 @@ void ResourceManager_TestMouse() {
 }
 
 void ResourceManager_ExitGame(int32_t error_code) {
+    if (ResourceManager_InitGraphRunning && SDL_GetCurrentThreadID() != ResourceManager_MainThreadID) {
+        throw ResourceManager_ExitRequest{error_code};
+    }
+
     const char* const ResourceManager_ErrorCodes[] = {"",      _(1347), _(c164), _(c116), _(9edb), _(6bc6),
                                                       _(5ced), _(3b69), _(c499), _(4afd), _(bc1c), _(908e),
                                                       _(b2b3), _(00a7), _(eb11), _(3004), _(07f8)};
@@ -564,11 +629,15 @@ void ResourceManager_ExitGame(int32_t error_code) {
 }
 
 void ResourceManager_Exit() {
+    // do not lose an autosave that is still being written
+    SaveLoad_WaitForBackgroundSave();
+    SaveLoad_FlushSaveFileIndex();
     ResourceManager_DeinitSoundManager();
     win_exit();
     ResourceManager_DestroyMutexes();
     ResourceManager_PathsManager.reset();
     Paths_ClearSiteReservations();
+    ResourceManager_ResourceLoader.reset();
     SDL_Quit();
 
     exit(0);
@@ -625,7 +694,7 @@ void ResourceManager_LoadMaxResources() {
 int32_t ResourceManager_InitResManager() {
     int32_t result;
 
-    if (ResourceManager_BuildColorTables()) {
+    if (color_animation_buffer) {
         Cursor_Init();
 
         result = EXIT_CODE_NO_ERROR;
@@ -649,20 +718,18 @@ uint8_t* ResourceManager_ReadResource(ResourceID id) {
             resource_buffer = nullptr;
 
         } else {
-            FILE* fp = res_file_handle_array[ResourceManager_ResMetaTable[id].res_file_id];
+            const ResourceArchive& archive = ResourceManager_ResArchives[ResourceManager_ResMetaTable[id].res_file_id];
             int32_t data_size =
                 ResourceManager_ResItemTable[ResourceManager_ResMetaTable[id].res_file_item_index].data_size;
             int32_t data_offset =
                 ResourceManager_ResItemTable[ResourceManager_ResMetaTable[id].res_file_item_index].data_offset;
 
-            fseek(fp, data_offset, SEEK_SET);
-
             uint8_t* buffer = new (std::nothrow) uint8_t[data_size + sizeof('\0')];
             if (!buffer) {
                 ResourceManager_ExitGame(EXIT_CODE_INSUFFICIENT_MEMORY);
             }
 
-            if (!fread(buffer, data_size, 1, fp)) {
+            if (!archive.Read(data_offset, buffer, data_size)) {
                 ResourceManager_ExitGame(EXIT_CODE_CANNOT_READ_RES_FILE);
             }
 
@@ -686,21 +753,25 @@ uint8_t* ResourceManager_LoadResource(ResourceID id) {
             resource_buffer = nullptr;
         } else {
             if ((resource_buffer = ResourceManager_ResMetaTable[id].resource_buffer) == nullptr) {
-                FILE* fp = res_file_handle_array[ResourceManager_ResMetaTable[id].res_file_id];
+                const ResourceArchive& archive =
+                    ResourceManager_ResArchives[ResourceManager_ResMetaTable[id].res_file_id];
                 int32_t data_size =
                     ResourceManager_ResItemTable[ResourceManager_ResMetaTable[id].res_file_item_index].data_size;
                 int32_t data_offset =
                     ResourceManager_ResItemTable[ResourceManager_ResMetaTable[id].res_file_item_index].data_offset;
 
-                fseek(fp, data_offset, SEEK_SET);
-
-                resource_buffer = new (std::nothrow) uint8_t[data_size];
-                if (!resource_buffer) {
-                    ResourceManager_ExitGame(EXIT_CODE_INSUFFICIENT_MEMORY);
-                }
+                // a prefetched copy is adopted into the meta table here, so only the main thread writes the table
+                if (!ResourceManager_ResourceLoader || !ResourceManager_ResourceLoader->Claim(id, &resource_buffer) ||
+                    !resource_buffer) {
+                    // cached resources are owned and may be modified in place by their users, so they stay copies
+                    resource_buffer = new (std::nothrow) uint8_t[data_size];
+                    if (!resource_buffer) {
+                        ResourceManager_ExitGame(EXIT_CODE_INSUFFICIENT_MEMORY);
+                    }
 
-                if (!fread(resource_buffer, data_size, 1, fp)) {
-                    ResourceManager_ExitGame(EXIT_CODE_CANNOT_READ_RES_FILE);
+                    if (!archive.Read(data_offset, resource_buffer, data_size)) {
+                        ResourceManager_ExitGame(EXIT_CODE_CANNOT_READ_RES_FILE);
+                    }
                 }
 
                 ResourceManager_ResMetaTable[id].resource_buffer = resource_buffer;
@@ -712,6 +783,83 @@ uint8_t* ResourceManager_LoadResource(ResourceID id) {
     return resource_buffer;
 }
 
+const uint8_t* ResourceManager_GetResourceView(ResourceID id) {
+    const uint8_t* resource_view;
+
+    if (id < MEM_END || id >= RESOURCE_E || ResourceManager_ResMetaTable == nullptr ||
+        ResourceManager_ResMetaTable[id].res_file_item_index == INVALID_ID) {
+        resource_view = nullptr;
+
+    } else {
+        const ResourceArchive& archive = ResourceManager_ResArchives[ResourceManager_ResMetaTable[id].res_file_id];
+        const res_index& item = ResourceManager_ResItemTable[ResourceManager_ResMetaTable[id].res_file_item_index];
+
+        resource_view = archive.GetData(item.data_offset, item.data_size);
+
+        if (!resource_view) {
+            ResourceManager_ExitGame(EXIT_CODE_CANNOT_READ_RES_FILE);
+        }
+    }
+
+    return resource_view;
+}
+
+void ResourceManager_InitResourceLoader() {
+    ResourceManager_ResourceLoader = std::make_unique<ResourceLoader>(RESOURCE_E, ResourceManager_PrefetchLoad);
+
+    if (!ResourceManager_ResourceLoader->Start()) {
+        SDL_Log("Resource prefetching is not available.\n");
+    }
+}
+
+uint8_t* ResourceManager_PrefetchLoad(uint32_t id) {
+    // runs on the loader thread, the resource tables are not modified after they were built
+    const ResourceArchive& archive = ResourceManager_ResArchives[ResourceManager_ResMetaTable[id].res_file_id];
+    const res_index& item = ResourceManager_ResItemTable[ResourceManager_ResMetaTable[id].res_file_item_index];
+    uint8_t* buffer;
+
+    if (id < MEM_END) {
+        buffer = new (std::nothrow) uint8_t[item.data_size];
+
+        // failures are left to the synchronous load on the main thread which reports them
+        if (buffer && !archive.Read(item.data_offset, buffer, item.data_size)) {
+            delete[] buffer;
+            buffer = nullptr;
+        }
+
+    } else {
+        // view resources are not copied, touching their pages pulls them into the page cache instead
+        const uint8_t* const view = archive.GetData(item.data_offset, item.data_size);
+
+        if (view) {
+            volatile uint8_t sink = 0;
+
+            for (int32_t offset = 0; offset < item.data_size; offset += 4096) {
+                sink = sink + view[offset];
+            }
+        }
+
+        buffer = nullptr;
+    }
+
+    return buffer;
+}
+
+void ResourceManager_PrefetchResource(ResourceID id) {
+    if (ResourceManager_ResourceLoader && id != INVALID_ID && id < RESOURCE_E && ResourceManager_ResMetaTable &&
+        ResourceManager_ResMetaTable[id].res_file_item_index != INVALID_ID &&
+        (id >= MEM_END || ResourceManager_ResMetaTable[id].resource_buffer == nullptr)) {
+        ResourceManager_ResourceLoader->Prefetch(id);
+    }
+}
+
+void ResourceManager_PrefetchUnitSprites() {
+    for (auto [unit_id, unit] : ResourceManager_GetUnits()) {
+        ResourceManager_PrefetchResource(unit.GetSprite());
+        ResourceManager_PrefetchResource(unit.GetShadow());
+    }
+}
+
 uint32_t ResourceManager_GetResourceSize(ResourceID id) {
     uint32_t data_size;
 
@@ -733,13 +881,11 @@ int32_t ResourceManager_ReadImageHeader(ResourceID id, struct ImageBigHeader* bu
     if (id == INVALID_ID || ResourceManager_ResMetaTable[id].res_file_item_index == INVALID_ID) {
         result = false;
     } else {
-        FILE* fp = res_file_handle_array[ResourceManager_ResMetaTable[id].res_file_id];
+        const ResourceArchive& archive = ResourceManager_ResArchives[ResourceManager_ResMetaTable[id].res_file_id];
         int32_t data_offset =
             ResourceManager_ResItemTable[ResourceManager_ResMetaTable[id].res_file_item_index].data_offset;
 
-        fseek(fp, data_offset, SEEK_SET);
-
-        if (!fread(buffer, sizeof(struct ImageBigHeader), 1, fp)) {
+        if (!archive.Read(data_offset, buffer, sizeof(struct ImageBigHeader))) {
             ResourceManager_ExitGame(EXIT_CODE_CANNOT_READ_RES_FILE);
         }
 
@@ -755,16 +901,20 @@ int32_t ResourceManager_GetResourceFileID(ResourceID id) {
 
 const char* ResourceManager_GetResourceID(ResourceID id) { return ResourceManager_ResourceIdList[id]; }
 
-ResourceID ResourceManager_GetResourceID(std::string id) {
-    if (!ResourceManager_ResourceIDLUT) {
-        ResourceManager_ResourceIDLUT = std::make_unique<std::unordered_map<std::string, ResourceID>>();
+void ResourceManager_InitResourceIDs() {
+    ResourceManager_ResourceIDLUT = std::make_unique<std::unordered_map<std::string, ResourceID>>();
 
-        for (size_t i = 0; i < RESOURCE_E; ++i) {
-            const std::string key = ResourceManager_ResourceIdList[i];
-            const ResourceID value = static_cast<ResourceID>(i);
+    for (size_t i = 0; i < RESOURCE_E; ++i) {
+        const std::string key = ResourceManager_ResourceIdList[i];
+        const ResourceID value = static_cast<ResourceID>(i);
 
-            (*ResourceManager_ResourceIDLUT)[key] = value;
-        }
+        (*ResourceManager_ResourceIDLUT)[key] = value;
+    }
+}
+
+ResourceID ResourceManager_GetResourceID(std::string id) {
+    if (!ResourceManager_ResourceIDLUT) {
+        ResourceManager_InitResourceIDs();
     }
 
     auto it = ResourceManager_ResourceIDLUT->find(id);
@@ -867,6 +1017,9 @@ ResourceID ResourceManager_GetResourceID(int32_t index) {
 
 void ResourceManager_Realloc(ResourceID id, uint8_t* buffer, int32_t data_size) {
     if (ResourceManager_ResMetaTable[id].resource_buffer) {
+        // decoded sprite frames are keyed by the address of their source frame
+        Gfx_InvalidateSpriteCache();
+
         delete[] ResourceManager_ResMetaTable[id].resource_buffer;
         resource_buffer_size -=
             ResourceManager_ResItemTable[ResourceManager_ResMetaTable[id].res_file_item_index].data_size;
@@ -907,6 +1060,11 @@ void ResourceManager_FreeResources() {
     Cursor_Show();
 }
 
+void ResourceManager_InitColorTables() {
+    // a failure is reported by ResourceManager_InitResManager() on the main thread
+    (void)ResourceManager_BuildColorTables();
+}
+
 int32_t ResourceManager_BuildColorTables() {
     int32_t result;
     ColorIndex* aligned_buffer;
@@ -989,6 +1147,13 @@ int32_t ResourceManager_BuildResourceTable(const std::filesystem::path filepath)
 
     res_file_handle_array[ResourceManager_ResFileCount] = fp;
 
+    if (fp && !ResourceManager_ResArchives[ResourceManager_ResFileCount].Open(filepath)) {
+        fclose(fp);
+        fp = nullptr;
+
+        res_file_handle_array[ResourceManager_ResFileCount] = nullptr;
+    }
+
     if (fp) {
         if (fread(&header, sizeof(header), 1, fp)) {
             if (!strncmp("RES0", header.id, sizeof(res_header::id))) {
@@ -1051,15 +1216,10 @@ void ResourceManager_InitMinimapResources() {
     delete[] ResourceManager_Minimap;
     ResourceManager_Minimap = nullptr;
 
-    delete[] ResourceManager_MinimapUnits;
-    ResourceManager_MinimapUnits = nullptr;
-
     ResourceManager_MinimapFov = new (std::nothrow) uint8_t[ResourceManager_MapSize.x * ResourceManager_MapSize.y];
     ResourceManager_Minimap = new (std::nothrow) uint8_t[ResourceManager_MapSize.x * ResourceManager_MapSize.y];
-    ResourceManager_MinimapUnits = new (std::nothrow) uint8_t[ResourceManager_MapSize.x * ResourceManager_MapSize.y];
 
-    if (ResourceManager_MinimapFov == nullptr || ResourceManager_Minimap == nullptr ||
-        ResourceManager_MinimapUnits == nullptr) {
+    if (ResourceManager_MinimapFov == nullptr || ResourceManager_Minimap == nullptr) {
         ResourceManager_ExitGame(EXIT_CODE_INSUFFICIENT_MEMORY);
     }
 
@@ -1173,6 +1333,9 @@ void ResourceManager_InitInGameAssets(int32_t world) {
 
     const ResourceID world_resource_id = static_cast<ResourceID>(SNOW_1 + world);
 
+    // unit sprites are decoded while the map loads, let the loader thread read them meanwhile
+    ResourceManager_PrefetchUnitSprites();
+
     ResourceManager_ActiveWorld = std::make_unique<World>(world_resource_id);
 
     ResourceManager_MapSize = ResourceManager_ActiveWorld->GetMapSize();
@@ -1185,6 +1348,8 @@ void ResourceManager_InitInGameAssets(int32_t world) {
     memcpy(ResourceManager_MinimapFov, ResourceManager_ActiveWorld->GetMinimapFov(), map_cell_count);
     memcpy(ResourceManager_Minimap, ResourceManager_MinimapFov, map_cell_count);
 
+    DrawMap_InvalidateMinimap();
+
     DrawLoadBar load_bar(_(df4f));
 
     if (!ResourceManager_ActiveWorld->LoadFullMap(&load_bar)) {
@@ -1383,7 +1548,6 @@ void ResourceManager_InitLogFile() {
     auto filepath = (ResourceManager_FilePathGamePref / "stdout.txt").lexically_normal();
     std::error_code ec;
 
-    ResourceManager_MainThreadID = SDL_GetCurrentThreadID();
     ResourceManager_LogMutex = ResourceManager_CreateMutex();
     const auto size = std::filesystem::file_size(filepath, ec);
     const bool truncate = ec || size >= ResourceManager_LogFileSizeLimit;
@@ -1522,9 +1686,19 @@ void ResourceManager_InitLanguageManager() {
         exit(EXIT_FAILURE);
     }
 
+    // the pref path is set up after the language manager, the cache location is resolved in advance
+    std::filesystem::path cache_path;
+
+    if (ResourceManager_GetPrefPath(cache_path)) {
+        cache_path = (cache_path / "cache" / "language.bin").lexically_normal();
+
+    } else {
+        cache_path.clear();
+    }
+
     ResourceManager_LanguageManager = std::make_shared<Language>();
     if (ResourceManager_LanguageManager &&
-        ResourceManager_LanguageManager->LoadFile((path / "language.json").lexically_normal().string())) {
+        ResourceManager_LanguageManager->LoadFile((path / "language.json").lexically_normal().string(), cache_path)) {
         ResourceManager_LanguageManager->SetLanguage(ResourceManager_GetSystemLocale());
 
     } else {
@@ -1548,7 +1722,8 @@ void ResourceManager_InitHelpManager() {
     const auto path = ResourceManager_FilePathGameBase / "help.json";
 
     ResourceManager_HelpManager = std::make_shared<Help>();
-    (void)ResourceManager_HelpManager->LoadFile(path.lexically_normal().string());
+    (void)ResourceManager_HelpManager->LoadFile(path.lexically_normal().string(),
+                                                ResourceManager_GetCachePath("help.bin"));
     ResourceManager_HelpManager->SetLanguage(ResourceManager_GetSystemLocale());
 }
 
@@ -1644,6 +1819,8 @@ void ResourceManager_ResetUnitsSprites() {
         unit.SetSpriteData(nullptr);
         unit.SetShadowData(nullptr);
     }
+
+    Gfx_InvalidateSpriteCache();
 }
 
 TeamClanType ResourceManager_GetClanID(const std::string clan_id) {
@@ -1709,4 +1886,8 @@ std::vector<std::filesystem::path> ResourceManager_GetFileList(const std::filesy
     return file_list;
 }
 
+std::filesystem::path ResourceManager_GetCachePath(const std::string& name) {
+    return (ResourceManager_FilePathGamePref / "cache" / name).lexically_normal();
+}
+
 World* ResourceManager_GetActiveWorld() { return ResourceManager_ActiveWorld.get(); }
@@ -94,7 +94,6 @@ extern ColorIndex* ResourceManager_DarkeningColorIndexTable;
 extern ColorIndex* ResourceManager_BrightnessColorIndexTable;
 
 extern uint8_t* ResourceManager_Minimap;
-extern uint8_t* ResourceManager_MinimapUnits;
 extern uint8_t* ResourceManager_MinimapFov;
 extern uint8_t* ResourceManager_MinimapBgImage;
 
@@ -111,6 +110,8 @@ void ResourceManager_InitResources();
 void ResourceManager_ExitGame(int32_t error_code);
 void ResourceManager_Exit();
 uint8_t* ResourceManager_ReadResource(ResourceID id);
+void ResourceManager_PrefetchResource(ResourceID id);
+const uint8_t* ResourceManager_GetResourceView(ResourceID id);
 uint8_t* ResourceManager_LoadResource(ResourceID id);
 uint32_t ResourceManager_GetResourceSize(ResourceID id);
 int32_t ResourceManager_ReadImageHeader(ResourceID id, struct ImageBigHeader* buffer);
@@ -162,6 +163,7 @@ public:
 void ResourceManager_DestroyMutexes();
 std::vector<std::filesystem::path> ResourceManager_GetFileList(const std::filesystem::path& folder,
                                                                const std::string& extension);
+std::filesystem::path ResourceManager_GetCachePath(const std::string& name);
 
 #define _(key) ResourceManager_GetLanguageEntry(0x##key).c_str()
 
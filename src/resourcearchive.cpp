@@ -0,0 +1,173 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "resourcearchive.hpp"
+
+#include <SDL3/SDL.h>
+
+#include <cstdio>
+#include <cstring>
+#include <new>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+ResourceArchive::ResourceArchive() : m_data(nullptr), m_size(0), m_mapping(nullptr) {}
+
+ResourceArchive::~ResourceArchive() { Close(); }
+
+#if defined(_WIN32)
+static void* ResourceArchive_Map(const std::filesystem::path& path, size_t* size) {
+    void* result = nullptr;
+    HANDLE file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (file != INVALID_HANDLE_VALUE) {
+        LARGE_INTEGER file_size;
+
+        if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0) {
+            HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+            if (mapping) {
+                result = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+                // the view keeps the mapping object alive
+                CloseHandle(mapping);
+
+                if (result) {
+                    *size = static_cast<size_t>(file_size.QuadPart);
+                }
+            }
+        }
+
+        CloseHandle(file);
+    }
+
+    return result;
+}
+
+static void ResourceArchive_Unmap(void* address, [[maybe_unused]] size_t size) { UnmapViewOfFile(address); }
+#else
+static void* ResourceArchive_Map(const std::filesystem::path& path, size_t* size) {
+    void* result = nullptr;
+    const int file = open(path.c_str(), O_RDONLY);
+
+    if (file != -1) {
+        struct stat file_status;
+
+        if (fstat(file, &file_status) == 0 && file_status.st_size > 0) {
+            void* address = mmap(nullptr, file_status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+            if (address != MAP_FAILED) {
+                result = address;
+                *size = static_cast<size_t>(file_status.st_size);
+            }
+        }
+
+        // the mapping keeps the file alive
+        close(file);
+    }
+
+    return result;
+}
+
+static void ResourceArchive_Unmap(void* address, size_t size) { munmap(address, size); }
+#endif
+
+bool ResourceArchive::Open(const std::filesystem::path& path) {
+    Close();
+
+    m_mapping = ResourceArchive_Map(path, &m_size);
+
+    if (m_mapping) {
+        m_data = static_cast<const uint8_t*>(m_mapping);
+
+        return true;
+    }
+
+    FILE* fp = fopen(path.string().c_str(), "rb");
+
+    if (!fp) {
+        return false;
+    }
+
+    SDL_Log("ResourceArchive: cannot map %s, reading it into memory.\n", path.string().c_str());
+
+    bool result = false;
+
+    if (fseek(fp, 0, SEEK_END) == 0) {
+        const long file_size = ftell(fp);
+
+        if (file_size > 0 && fseek(fp, 0, SEEK_SET) == 0) {
+            m_buffer.reset(new (std::nothrow) uint8_t[file_size]);
+
+            if (m_buffer && fread(m_buffer.get(), file_size, 1, fp) == 1) {
+                m_data = m_buffer.get();
+                m_size = static_cast<size_t>(file_size);
+                result = true;
+
+            } else {
+                m_buffer.reset();
+            }
+        }
+    }
+
+    fclose(fp);
+
+    return result;
+}
+
+void ResourceArchive::Close() noexcept {
+    if (m_mapping) {
+        ResourceArchive_Unmap(m_mapping, m_size);
+        m_mapping = nullptr;
+    }
+
+    m_buffer.reset();
+    m_data = nullptr;
+    m_size = 0;
+}
+
+const uint8_t* ResourceArchive::GetData(size_t offset, size_t size) const noexcept {
+    if (offset > m_size || size > m_size - offset) {
+        return nullptr;
+    }
+
+    return &m_data[offset];
+}
+
+bool ResourceArchive::Read(size_t offset, void* buffer, size_t size) const noexcept {
+    const uint8_t* const data = GetData(offset, size);
+
+    if (!data) {
+        return false;
+    }
+
+    memcpy(buffer, data, size);
+
+    return true;
+}
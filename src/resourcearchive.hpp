@@ -0,0 +1,89 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef RESOURCEARCHIVE_HPP
+#define RESOURCEARCHIVE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+/**
+ * \class ResourceArchive
+ * \brief Read only image of a resource archive file such as MAX.RES or PATCHES.RES.
+ *
+ * The file is memory mapped, so resources can be accessed in place without a read system call or a copy. If the
+ * platform refuses the mapping, the file is read into memory once instead. Either way the contents do not change while
+ * the archive is open and any number of threads may access them concurrently.
+ */
+class ResourceArchive {
+    const uint8_t* m_data;
+    size_t m_size;
+    void* m_mapping;
+    std::unique_ptr<uint8_t[]> m_buffer;
+
+public:
+    ResourceArchive();
+    ~ResourceArchive();
+
+    ResourceArchive(const ResourceArchive&) = delete;
+    ResourceArchive& operator=(const ResourceArchive&) = delete;
+
+    /**
+     * \brief Opens an archive file. A previously opened file is closed first.
+     *
+     * \param path Path of the archive.
+     * \return True on success.
+     */
+    bool Open(const std::filesystem::path& path);
+
+    /**
+     * \brief Closes the archive. Views obtained from GetData() become invalid.
+     */
+    void Close() noexcept;
+
+    /**
+     * \brief Gets a view of a byte range of the archive.
+     *
+     * \param offset Position of the first byte from the start of the file.
+     * \param size Number of bytes that will be accessed.
+     * \return Address of the first byte, or nullptr if the range is not within the file. The view is valid until the
+     * archive is closed and must not be written to.
+     */
+    [[nodiscard]] const uint8_t* GetData(size_t offset, size_t size) const noexcept;
+
+    /**
+     * \brief Copies a byte range of the archive.
+     *
+     * \param offset Position of the first byte from the start of the file.
+     * \param buffer Destination of size bytes.
+     * \param size Number of bytes to copy.
+     * \return True if the range is within the file.
+     */
+    bool Read(size_t offset, void* buffer, size_t size) const noexcept;
+
+    [[nodiscard]] inline bool IsOpen() const noexcept { return m_data != nullptr; }
+    [[nodiscard]] inline bool IsMapped() const noexcept { return m_mapping != nullptr; }
+    [[nodiscard]] inline size_t GetSize() const noexcept { return m_size; }
+};
+
+#endif /* RESOURCEARCHIVE_HPP */
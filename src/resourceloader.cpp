@@ -0,0 +1,250 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "resourceloader.hpp"
+
+#include <SDL3/SDL.h>
+
+#include <exception>
+
+ResourceLoader::ResourceLoader(uint32_t slot_count, LoadFunction function)
+    : m_function(std::move(function)),
+      m_slots(slot_count, Slot{SLOT_IDLE, nullptr}),
+      m_pending_count(0),
+      m_thread(nullptr),
+      m_mutex(nullptr),
+      m_wake(nullptr),
+      m_done(nullptr),
+      m_exit_requested(false) {}
+
+ResourceLoader::~ResourceLoader() { Stop(); }
+
+bool ResourceLoader::Start() {
+    if (m_thread) {
+        return true;
+    }
+
+    m_mutex = SDL_CreateMutex();
+    m_wake = SDL_CreateCondition();
+    m_done = SDL_CreateCondition();
+    m_exit_requested = false;
+
+    if (m_mutex && m_wake && m_done) {
+        m_thread = SDL_CreateThread(ThreadFunction, "ResourceLoader", this);
+    }
+
+    if (!m_thread) {
+        SDL_Log("ResourceLoader: failed to start loader thread.\n");
+
+        Stop();
+
+        return false;
+    }
+
+    return true;
+}
+
+void ResourceLoader::Stop() {
+    if (m_thread) {
+        SDL_LockMutex(m_mutex);
+        m_exit_requested = true;
+        SDL_SignalCondition(m_wake);
+        SDL_UnlockMutex(m_mutex);
+
+        SDL_WaitThread(m_thread, nullptr);
+        m_thread = nullptr;
+    }
+
+    m_queue.clear();
+    m_pending_count = 0;
+
+    for (auto& slot : m_slots) {
+        delete[] slot.buffer;
+
+        slot.buffer = nullptr;
+        slot.state = SLOT_IDLE;
+    }
+
+    if (m_done) {
+        SDL_DestroyCondition(m_done);
+        m_done = nullptr;
+    }
+
+    if (m_wake) {
+        SDL_DestroyCondition(m_wake);
+        m_wake = nullptr;
+    }
+
+    if (m_mutex) {
+        SDL_DestroyMutex(m_mutex);
+        m_mutex = nullptr;
+    }
+}
+
+int SDLCALL ResourceLoader::ThreadFunction(void* data) {
+    static_cast<ResourceLoader*>(data)->Run();
+
+    return 0;
+}
+
+void ResourceLoader::Run() {
+    SDL_LockMutex(m_mutex);
+
+    for (;;) {
+        while (!m_exit_requested && m_queue.empty()) {
+            SDL_WaitCondition(m_wake, m_mutex);
+        }
+
+        if (m_exit_requested) {
+            break;
+        }
+
+        const uint32_t id = m_queue.front();
+
+        m_queue.pop_front();
+
+        // the request was withdrawn by Claim() or queued twice
+        if (m_slots[id].state != SLOT_QUEUED) {
+            continue;
+        }
+
+        m_slots[id].state = SLOT_LOADING;
+        --m_pending_count;
+
+        SDL_UnlockMutex(m_mutex);
+
+        uint8_t* buffer = nullptr;
+
+        // see WorkerThread::Run(), an exception must not unwind into the SDL thread entry point
+        try {
+            buffer = m_function(id);
+
+        } catch (const std::exception& e) {
+            SDL_Log("ResourceLoader: loading resource %u threw \"%s\".\n", id, e.what());
+
+        } catch (...) {
+            SDL_Log("ResourceLoader: loading resource %u threw an unknown exception.\n", id);
+        }
+
+        SDL_LockMutex(m_mutex);
+
+        m_slots[id].buffer = buffer;
+        m_slots[id].state = buffer ? SLOT_READY : SLOT_IDLE;
+
+        ++m_statistics.loads;
+
+        SDL_BroadcastCondition(m_done);
+    }
+
+    SDL_UnlockMutex(m_mutex);
+}
+
+bool ResourceLoader::Prefetch(uint32_t id) {
+    bool result = false;
+
+    if (m_thread && id < m_slots.size()) {
+        SDL_LockMutex(m_mutex);
+
+        if (m_slots[id].state == SLOT_IDLE) {
+            m_slots[id].state = SLOT_QUEUED;
+            m_queue.push_back(id);
+            ++m_pending_count;
+
+            ++m_statistics.requests;
+
+            SDL_SignalCondition(m_wake);
+
+            result = true;
+        }
+
+        SDL_UnlockMutex(m_mutex);
+    }
+
+    return result;
+}
+
+bool ResourceLoader::Claim(uint32_t id, uint8_t** buffer) {
+    bool result = false;
+
+    if (m_thread && id < m_slots.size()) {
+        SDL_LockMutex(m_mutex);
+
+        Slot& slot = m_slots[id];
+
+        if (slot.state == SLOT_QUEUED) {
+            // loading it here is not slower than waiting for the requests queued before it
+            slot.state = SLOT_IDLE;
+            --m_pending_count;
+
+            ++m_statistics.cancellations;
+
+        } else if (slot.state == SLOT_LOADING) {
+            ++m_statistics.waited_claims;
+
+            while (slot.state == SLOT_LOADING) {
+                SDL_WaitCondition(m_done, m_mutex);
+            }
+
+        } else if (slot.state == SLOT_READY) {
+            ++m_statistics.ready_claims;
+        }
+
+        if (slot.state == SLOT_READY) {
+            *buffer = slot.buffer;
+
+            slot.buffer = nullptr;
+            slot.state = SLOT_IDLE;
+
+            result = true;
+        }
+
+        SDL_UnlockMutex(m_mutex);
+    }
+
+    return result;
+}
+
+size_t ResourceLoader::GetPendingCount() const {
+    size_t count = 0;
+
+    if (m_thread) {
+        SDL_LockMutex(m_mutex);
+        count = m_pending_count;
+        SDL_UnlockMutex(m_mutex);
+    }
+
+    return count;
+}
+
+ResourceLoaderStatistics ResourceLoader::GetStatistics() const {
+    ResourceLoaderStatistics statistics;
+
+    if (m_mutex) {
+        SDL_LockMutex(m_mutex);
+        statistics = m_statistics;
+        SDL_UnlockMutex(m_mutex);
+
+    } else {
+        statistics = m_statistics;
+    }
+
+    return statistics;
+}
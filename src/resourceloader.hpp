@@ -0,0 +1,139 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef RESOURCELOADER_HPP
+#define RESOURCELOADER_HPP
+
+#include <SDL3/SDL_mutex.h>
+#include <SDL3/SDL_thread.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <vector>
+
+/**
+ * \struct ResourceLoaderStatistics
+ * \brief Request counters of a resource loader.
+ */
+struct ResourceLoaderStatistics {
+    uint64_t requests{0};
+    uint64_t loads{0};
+    uint64_t ready_claims{0};
+    uint64_t waited_claims{0};
+    uint64_t cancellations{0};
+};
+
+/**
+ * \class ResourceLoader
+ * \brief Background thread that loads resources ahead of their first use.
+ *
+ * Prefetch() queues a resource and the loader thread produces its buffer through the load function. The consumer
+ * calls Claim() where it would otherwise load the resource itself. A loaded resource is handed over at once, a
+ * resource that is being loaded is waited for and a resource that is still queued is withdrawn, so the consumer only
+ * blocks on the one resource it needs and never on the rest of the queue. Claimed buffers are owned by the consumer,
+ * buffers that are never claimed are released by Stop().
+ *
+ * Prefetch() and Claim() must be called from one thread, in practice the main thread.
+ */
+class ResourceLoader {
+public:
+    /**
+     * \brief Loads a resource on the loader thread.
+     *
+     * \param id Resource identifier.
+     * \return Buffer allocated by new[] or nullptr if the resource is not kept, for example on failure.
+     */
+    using LoadFunction = std::function<uint8_t*(uint32_t id)>;
+
+    /**
+     * \brief Creates a stopped loader.
+     *
+     * \param slot_count Number of resource identifiers, identifiers are 0 to slot_count - 1.
+     * \param function Load function, called on the loader thread.
+     */
+    ResourceLoader(uint32_t slot_count, LoadFunction function);
+    ~ResourceLoader();
+
+    ResourceLoader(const ResourceLoader&) = delete;
+    ResourceLoader& operator=(const ResourceLoader&) = delete;
+
+    /**
+     * \brief Spawns the loader thread.
+     *
+     * \return True if the thread was started. Otherwise Prefetch() requests are ignored.
+     */
+    bool Start();
+
+    /**
+     * \brief Stops and joins the loader thread. Queued requests are dropped and unclaimed buffers are released.
+     */
+    void Stop();
+
+    /**
+     * \brief Queues a resource for loading.
+     *
+     * \param id Resource identifier.
+     * \return True if the resource was queued, false if it is queued or loaded already or the loader is stopped.
+     */
+    bool Prefetch(uint32_t id);
+
+    /**
+     * \brief Takes over a prefetched resource, waiting for the loader thread if it is working on it.
+     *
+     * \param id Resource identifier.
+     * \param buffer Receives the loaded buffer.
+     * \return True if a buffer was handed over. False if the resource was not prefetched, was still queued or could
+     * not be loaded, in which case the caller loads it itself.
+     */
+    bool Claim(uint32_t id, uint8_t** buffer);
+
+    [[nodiscard]] size_t GetPendingCount() const;
+    [[nodiscard]] ResourceLoaderStatistics GetStatistics() const;
+
+private:
+    enum : uint8_t { SLOT_IDLE, SLOT_QUEUED, SLOT_LOADING, SLOT_READY };
+
+    struct Slot {
+        uint8_t state;
+        uint8_t* buffer;
+    };
+
+    LoadFunction m_function;
+    std::vector<Slot> m_slots;
+    std::deque<uint32_t> m_queue;
+    size_t m_pending_count;
+
+    SDL_Thread* m_thread;
+    SDL_Mutex* m_mutex;
+    SDL_Condition* m_wake;
+    SDL_Condition* m_done;
+    bool m_exit_requested;
+
+    ResourceLoaderStatistics m_statistics;
+
+    static int SDLCALL ThreadFunction(void* data);
+
+    void Run();
+};
+
+#endif /* RESOURCELOADER_HPP */
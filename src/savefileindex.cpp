@@ -0,0 +1,192 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "savefileindex.hpp"
+
+#include <SDL3/SDL.h>
+
+#include "smartfile.hpp"
+
+/* bump on any change of the index file layout */
+static constexpr uint32_t SaveFileIndex_FormatVersion = 1;
+
+/* a damaged count must not make the loader reserve memory that the file cannot fill */
+static constexpr uint32_t SaveFileIndex_EntryLimit = 65536;
+
+SaveFileIndex::SaveFileIndex(std::filesystem::path path, uint32_t layout_version)
+    : m_path(std::move(path)), m_layout_version(layout_version), m_is_loaded(false), m_is_modified(false) {}
+
+bool SaveFileIndex::GetStamp(const std::filesystem::path& file_path, uint64_t& file_size, int64_t& modification_time) {
+    std::error_code ec;
+
+    file_size = std::filesystem::file_size(file_path, ec);
+
+    if (ec) {
+        return false;
+    }
+
+    modification_time = std::filesystem::last_write_time(file_path, ec).time_since_epoch().count();
+
+    return !ec;
+}
+
+void SaveFileIndex::Load() {
+    SmartFileReader file;
+    uint32_t format_version{0};
+    uint32_t layout_version{0};
+    uint32_t entry_count{0};
+
+    m_is_loaded = true;
+
+    if (!file.Open(m_path.string())) {
+        return;
+    }
+
+    if (!file.Read(format_version) || format_version != SaveFileIndex_FormatVersion || !file.Read(layout_version) ||
+        layout_version != m_layout_version || !file.Read(entry_count) || entry_count > SaveFileIndex_EntryLimit) {
+        // a stale index is rebuilt from the save files and replaced on the next flush
+        return;
+    }
+
+    for (uint32_t i = 0; i < entry_count; ++i) {
+        std::string file_path;
+        Entry entry;
+
+        if (!file.Read(file_path) || !file.Read(entry.file_size) || !file.Read(entry.modification_time) ||
+            !file.Read(entry.summary)) {
+            SDL_Log("SaveFileIndex: %s is damaged.\n", m_path.string().c_str());
+
+            m_entries.clear();
+
+            return;
+        }
+
+        m_entries.insert_or_assign(std::move(file_path), std::move(entry));
+    }
+}
+
+bool SaveFileIndex::Find(const std::filesystem::path& file_path, std::vector<uint8_t>& summary) {
+    if (!m_is_loaded) {
+        Load();
+    }
+
+    const auto it = m_entries.find(file_path.lexically_normal().string());
+
+    if (it == m_entries.end()) {
+        return false;
+    }
+
+    uint64_t file_size;
+    int64_t modification_time;
+
+    if (!GetStamp(file_path, file_size, modification_time) || file_size != it->second.file_size ||
+        modification_time != it->second.modification_time) {
+        m_entries.erase(it);
+        m_is_modified = true;
+
+        return false;
+    }
+
+    summary = it->second.summary;
+
+    return true;
+}
+
+void SaveFileIndex::Update(const std::filesystem::path& file_path, std::vector<uint8_t>&& summary) {
+    Entry entry;
+
+    if (!m_is_loaded) {
+        Load();
+    }
+
+    if (!GetStamp(file_path, entry.file_size, entry.modification_time)) {
+        Remove(file_path);
+
+        return;
+    }
+
+    entry.summary = std::move(summary);
+
+    m_entries.insert_or_assign(file_path.lexically_normal().string(), std::move(entry));
+    m_is_modified = true;
+}
+
+void SaveFileIndex::Remove(const std::filesystem::path& file_path) {
+    if (!m_is_loaded) {
+        Load();
+    }
+
+    if (m_entries.erase(file_path.lexically_normal().string())) {
+        m_is_modified = true;
+    }
+}
+
+bool SaveFileIndex::Flush() {
+    if (!m_is_modified) {
+        return true;
+    }
+
+    auto temporary_path = m_path;
+    SmartFileWriter file;
+    std::error_code ec;
+
+    temporary_path += ".tmp";
+
+    std::filesystem::create_directories(m_path.parent_path(), ec);
+
+    if (!file.Open(temporary_path.string())) {
+        SDL_Log("SaveFileIndex: failed to create %s.\n", temporary_path.string().c_str());
+
+        return false;
+    }
+
+    const uint32_t entry_count = static_cast<uint32_t>(m_entries.size());
+    bool result = file.Write(SaveFileIndex_FormatVersion) && file.Write(m_layout_version) && file.Write(entry_count);
+
+    for (const auto& [file_path, entry] : m_entries) {
+        result = result && file.Write(file_path) && file.Write(entry.file_size) &&
+                 file.Write(entry.modification_time) && file.Write(entry.summary);
+    }
+
+    result = file.Close() && result;
+
+    if (!result) {
+        SDL_Log("SaveFileIndex: failed to write %s.\n", temporary_path.string().c_str());
+
+        file.Delete();
+
+        return false;
+    }
+
+    std::filesystem::rename(temporary_path, m_path, ec);
+
+    if (ec) {
+        SDL_Log("SaveFileIndex: failed to replace %s.\n", m_path.string().c_str());
+
+        std::filesystem::remove(temporary_path, ec);
+
+        return false;
+    }
+
+    m_is_modified = false;
+
+    return true;
+}
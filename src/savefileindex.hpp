@@ -0,0 +1,103 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SAVEFILEINDEX_HPP
+#define SAVEFILEINDEX_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \class SaveFileIndex
+ * \brief Sidecar file that keeps a summary of every known save file, so that save slot menus do not need to open and
+ * decode each save file.
+ *
+ * The index maps the path of a save file to a summary record that the caller serialized, stamped with the size and
+ * the modification time of the save file at the time the record was taken. A record is only handed out while the stamp
+ * still matches the file on disk, so a save file that was replaced, restored from a backup or copied over by the user
+ * is read again by the caller. The index file is loaded on first use and written back by Flush().
+ *
+ * The summary layout belongs to the caller, a layout change must use a new layout version which discards all records.
+ */
+class SaveFileIndex {
+    struct Entry {
+        uint64_t file_size;
+        int64_t modification_time;
+        std::vector<uint8_t> summary;
+    };
+
+    std::filesystem::path m_path;
+    uint32_t m_layout_version;
+    bool m_is_loaded;
+    bool m_is_modified;
+    std::unordered_map<std::string, Entry> m_entries;
+
+    void Load();
+    [[nodiscard]] static bool GetStamp(const std::filesystem::path& file_path, uint64_t& file_size,
+                                       int64_t& modification_time);
+
+public:
+    /**
+     * \brief Creates an index backed by a file. The file is not accessed until the index is used.
+     *
+     * \param path Index file path, missing parent folders are created on Flush().
+     * \param layout_version Version of the summary layout of the caller.
+     */
+    SaveFileIndex(std::filesystem::path path, uint32_t layout_version);
+
+    /**
+     * \brief Gets the summary of a save file if the file is unchanged since the summary was taken.
+     *
+     * \param file_path Save file path.
+     * \param summary Receives the summary record.
+     * \return True if a valid summary was found. Records of missing or changed files are dropped.
+     */
+    bool Find(const std::filesystem::path& file_path, std::vector<uint8_t>& summary);
+
+    /**
+     * \brief Stores the summary of a save file, stamped with the current size and modification time of the file.
+     *
+     * \param file_path Save file path.
+     * \param summary Summary record.
+     */
+    void Update(const std::filesystem::path& file_path, std::vector<uint8_t>&& summary);
+
+    /**
+     * \brief Drops the summary of a save file.
+     *
+     * \param file_path Save file path.
+     */
+    void Remove(const std::filesystem::path& file_path);
+
+    /**
+     * \brief Writes the index file if any record changed. The file is replaced atomically.
+     *
+     * \return True on success or if there was nothing to write.
+     */
+    bool Flush();
+
+    [[nodiscard]] inline size_t GetEntryCount() const noexcept { return m_entries.size(); }
+};
+
+#endif /* SAVEFILEINDEX_HPP */
@@ -22,7 +22,10 @@
 #include "saveload.hpp"
 
 #include <format>
+#include <memory>
+#include <span>
 #include <stdexcept>
+#include <vector>
 
 #include "ai.hpp"
 #include "game_manager.hpp"
@@ -34,6 +37,7 @@
 #include "missionregistry.hpp"
 #include "remote.hpp"
 #include "resource_manager.hpp"
+#include "savefileindex.hpp"
 #include "settings.hpp"
 #include "smartfile.hpp"
 #include "units_manager.hpp"
@@ -57,6 +61,17 @@ static uint32_t SaveLoad_TranslateHashKeyToWorldIndex(const std::string hash);
 static std::string SaveLoad_TranslateWorldIndexToHashKey(const uint32_t index);
 static MissionCategory SaveLoad_TranslateSaveFileCategory(const uint32_t save_file_type);
 static void SaveLoad_LoadOptions(SmartFileReader& file, bool mode);
+static bool SaveLoad_WriteGame(SmartFileWriter& file, const char* const save_name, const uint32_t rng_seed);
+static bool SaveLoad_ReadSaveFileInfo(const std::filesystem::path& filepath, struct SaveFileInfo& save_file_info,
+                                      const bool load_options);
+static std::vector<uint8_t> SaveLoad_EncodeSaveFileInfo(const struct SaveFileInfo& save_file_info);
+static bool SaveLoad_DecodeSaveFileInfo(std::vector<uint8_t>&& summary, struct SaveFileInfo& save_file_info);
+static SaveFileIndex& SaveLoad_GetSaveFileIndex();
+
+static std::unique_ptr<SaveWriter> SaveLoad_BackgroundWriter;
+
+/* bump on any change of SaveLoad_EncodeSaveFileInfo() */
+static constexpr uint32_t SaveLoad_SaveFileInfoLayout = 1;
 
 void SaveLoad_TeamClearUnitList(SmartList<UnitInfo>& units, uint16_t team) {
     for (auto it = units.Begin(), it_end = units.End(); it != it_end; ++it) {
@@ -238,7 +253,8 @@ bool SaveLoad_GetSaveFileInfoV71(SmartFileReader& file, struct SaveFileInfo& sav
     try {
         file.Read(version);
 
-        if (version != static_cast<uint32_t>(SmartFileFormat::V71)) {
+        if (version != static_cast<uint32_t>(SmartFileFormat::V71) &&
+            version != static_cast<uint32_t>(SmartFileFormat::V72)) {
             throw std::runtime_error(std::format("Invalid version: {}", version));
         }
 
@@ -316,8 +332,65 @@ bool SaveLoad_GetSaveFileInfo(const MissionCategory mission_category, const int3
     return SaveLoad_GetSaveFileInfo(filepath, save_file_info, load_options);
 }
 
-bool SaveLoad_GetSaveFileInfo(const std::filesystem::path& filepath, struct SaveFileInfo& save_file_info,
-                              const bool load_options) {
+SaveFileIndex& SaveLoad_GetSaveFileIndex() {
+    static SaveFileIndex index(ResourceManager_GetCachePath("saves.idx"), SaveLoad_SaveFileInfoLayout);
+
+    return index;
+}
+
+std::vector<uint8_t> SaveLoad_EncodeSaveFileInfo(const struct SaveFileInfo& save_file_info) {
+    std::vector<uint8_t> summary;
+    SmartFileWriter file;
+
+    if (file.Open(summary)) {
+        file.Write(save_file_info.version);
+        file.Write(save_file_info.save_file_category);
+        file.Write(save_file_info.script);
+        file.Write(save_file_info.mission);
+        file.Write(save_file_info.world);
+        file.Write(save_file_info.save_name);
+
+        for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX; ++team) {
+            file.Write(save_file_info.team_names[team]);
+            file.Write(save_file_info.team_type[team]);
+            file.Write(save_file_info.team_clan[team]);
+        }
+
+        file.Write(save_file_info.random_seed);
+
+        if (!file.Close()) {
+            summary.clear();
+        }
+    }
+
+    return summary;
+}
+
+bool SaveLoad_DecodeSaveFileInfo(std::vector<uint8_t>&& summary, struct SaveFileInfo& save_file_info) {
+    SmartFileReader file;
+    bool result;
+
+    result = file.Open(std::move(summary));
+    result = result && file.Read(save_file_info.version);
+    result = result && file.Read(save_file_info.save_file_category);
+    result = result && file.Read(save_file_info.script);
+    result = result && file.Read(save_file_info.mission);
+    result = result && file.Read(save_file_info.world);
+    result = result && file.Read(save_file_info.save_name);
+
+    for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX; ++team) {
+        result = result && file.Read(save_file_info.team_names[team]);
+        result = result && file.Read(save_file_info.team_type[team]);
+        result = result && file.Read(save_file_info.team_clan[team]);
+    }
+
+    result = result && file.Read(save_file_info.random_seed);
+
+    return result;
+}
+
+bool SaveLoad_ReadSaveFileInfo(const std::filesystem::path& filepath, struct SaveFileInfo& save_file_info,
+                               const bool load_options) {
     SmartFileReader file;
     bool result;
 
@@ -327,7 +400,8 @@ bool SaveLoad_GetSaveFileInfo(const std::filesystem::path& filepath, struct Save
                 result = SaveLoad_GetSaveFileInfoV70(file, save_file_info, load_options);
             } break;
 
-            case SmartFileFormat::V71: {
+            case SmartFileFormat::V71:
+            case SmartFileFormat::V72: {
                 result = SaveLoad_GetSaveFileInfoV71(file, save_file_info, load_options);
             } break;
 
@@ -348,6 +422,38 @@ bool SaveLoad_GetSaveFileInfo(const std::filesystem::path& filepath, struct Save
     return result;
 }
 
+bool SaveLoad_GetSaveFileInfo(const std::filesystem::path& filepath, struct SaveFileInfo& save_file_info,
+                              const bool load_options) {
+    auto& index = SaveLoad_GetSaveFileIndex();
+    std::vector<uint8_t> summary;
+    bool result;
+
+    // an autosave may still be in flight for this very file
+    SaveLoad_WaitForBackgroundSave();
+
+    // loading the options has side effects, that always needs the save file itself
+    if (!load_options && index.Find(filepath, summary) &&
+        SaveLoad_DecodeSaveFileInfo(std::move(summary), save_file_info)) {
+        save_file_info.file_name = filepath.filename().string();
+        save_file_info.file_path = filepath;
+
+        return true;
+    }
+
+    result = SaveLoad_ReadSaveFileInfo(filepath, save_file_info, load_options);
+
+    if (result) {
+        index.Update(filepath, SaveLoad_EncodeSaveFileInfo(save_file_info));
+
+    } else {
+        index.Remove(filepath);
+    }
+
+    return result;
+}
+
+bool SaveLoad_FlushSaveFileIndex() { return SaveLoad_GetSaveFileIndex().Flush(); }
+
 [[nodiscard]] bool SaveLoad_IsSaveFileFormatSupported(const uint32_t format_version) {
     bool result;
 
@@ -360,6 +466,10 @@ bool SaveLoad_GetSaveFileInfo(const std::filesystem::path& filepath, struct Save
             result = true;
         } break;
 
+        case static_cast<uint32_t>(SmartFileFormat::V72): {
+            result = true;
+        } break;
+
         default: {
             result = false;
         } break;
@@ -368,372 +478,425 @@ bool SaveLoad_GetSaveFileInfo(const std::filesystem::path& filepath, struct Save
     return result;
 }
 
-bool SaveLoad_Save(const std::filesystem::path& filepath, const char* const save_name, const uint32_t rng_seed) {
+bool SaveLoad_WriteGame(SmartFileWriter& file, const char* const save_name, const uint32_t rng_seed) {
     const char* menu_team_names[] = {_(f394), _(a8a6), _(a3ee), _(319d), ""};
-    bool result{false};
     const auto mission = ResourceManager_GetMissionManager().get()->GetMission();
     const auto mission_category = mission->GetCategory();
-    SmartFileWriter file;
     const uint32_t map_cell_count{static_cast<uint32_t>(ResourceManager_MapSize.x * ResourceManager_MapSize.y)};
+    bool error{false};
 
-    if (file.Open(filepath.string())) {
-        bool error{false};
-
-        // save file format version
-        {
-            uint32_t version = static_cast<uint32_t>(SmartFileFormat::LATEST);
+    // save file format version
+    {
+        uint32_t version = static_cast<uint32_t>(SmartFileFormat::LATEST);
 
-            SDL_assert(version >= static_cast<uint32_t>(SmartFileFormat::V70));
+        SDL_assert(version >= static_cast<uint32_t>(SmartFileFormat::V70));
 
-            error |= !file.Write(version);
-        }
+        error |= !file.Write(version);
+    }
 
-        // save file category
-        {
-            uint32_t save_file_category = mission_category;
+    // save file category
+    {
+        uint32_t save_file_category = mission_category;
 
-            error |= !file.Write(save_file_category);
-        }
+        error |= !file.Write(save_file_category);
+    }
 
-        // mission
-        {
-            auto script = mission->GetBinaryScript();
+    // mission
+    {
+        auto script = mission->GetBinaryScript();
 
-            error |= !file.Write(*script);
-        }
+        error |= !file.Write(*script);
+    }
 
-        // save file title
-        {
-            std::string local_save_name = save_name;
+    // save file title
+    {
+        std::string local_save_name = save_name;
 
-            error |= !file.Write(local_save_name);
-        }
+        error |= !file.Write(local_save_name);
+    }
 
-        // world hash
-        {
-            uint32_t world_index = ResourceManager_GetSettings()->GetNumericValue("world");
-            std::string world = SaveLoad_TranslateWorldIndexToHashKey(world_index);
+    // world hash
+    {
+        uint32_t world_index = ResourceManager_GetSettings()->GetNumericValue("world");
+        std::string world = SaveLoad_TranslateWorldIndexToHashKey(world_index);
 
-            file.Write(world);
-        }
+        file.Write(world);
+    }
 
-        // team names
-        {
-            for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX; ++team) {
-                std::string team_name;
+    // team names
+    {
+        for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX; ++team) {
+            std::string team_name;
 
-                if (UnitsManager_TeamInfo[team].team_type != TEAM_TYPE_NONE) {
-                    team_name = ResourceManager_GetSettings()->GetStringValue(menu_team_name_setting[team]);
+            if (UnitsManager_TeamInfo[team].team_type != TEAM_TYPE_NONE) {
+                team_name = ResourceManager_GetSettings()->GetStringValue(menu_team_name_setting[team]);
 
-                    if (team_name.empty()) {
-                        team_name = menu_team_names[team];
-                    }
+                if (team_name.empty()) {
+                    team_name = menu_team_names[team];
                 }
-
-                error |= !file.Write(team_name);
             }
-        }
 
-        // team types
-        {
-            for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX; ++team) {
-                uint32_t team_type;
-
-                if ((mission_category == MISSION_CATEGORY_TRAINING || mission_category == MISSION_CATEGORY_SCENARIO ||
-                     mission_category == MISSION_CATEGORY_CAMPAIGN) &&
-                    team != PLAYER_TEAM_RED && UnitsManager_TeamInfo[team].team_type == TEAM_TYPE_PLAYER) {
-                    SDL_assert(0);  /// \todo Fix broken missions
-                    UnitsManager_TeamInfo[team].team_type = TEAM_TYPE_COMPUTER;
-                }
+            error |= !file.Write(team_name);
+        }
+    }
 
-                if (mission_category == MISSION_CATEGORY_DEMO &&
-                    UnitsManager_TeamInfo[team].team_type != TEAM_TYPE_NONE) {
-                    SDL_assert(0);  /// \todo Fix broken missions
-                    UnitsManager_TeamInfo[team].team_type = TEAM_TYPE_COMPUTER;
-                }
+    // team types
+    {
+        for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX; ++team) {
+            uint32_t team_type;
 
-                team_type = UnitsManager_TeamInfo[team].team_type;
+            if ((mission_category == MISSION_CATEGORY_TRAINING || mission_category == MISSION_CATEGORY_SCENARIO ||
+                 mission_category == MISSION_CATEGORY_CAMPAIGN) &&
+                team != PLAYER_TEAM_RED && UnitsManager_TeamInfo[team].team_type == TEAM_TYPE_PLAYER) {
+                SDL_assert(0);  /// \todo Fix broken missions
+                UnitsManager_TeamInfo[team].team_type = TEAM_TYPE_COMPUTER;
+            }
 
-                error |= !file.Write(team_type);
+            if (mission_category == MISSION_CATEGORY_DEMO &&
+                UnitsManager_TeamInfo[team].team_type != TEAM_TYPE_NONE) {
+                SDL_assert(0);  /// \todo Fix broken missions
+                UnitsManager_TeamInfo[team].team_type = TEAM_TYPE_COMPUTER;
             }
-        }
 
-        // team clans
-        {
-            for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX; ++team) {
-                uint32_t team_clan = UnitsManager_TeamInfo[team].team_clan;
+            team_type = UnitsManager_TeamInfo[team].team_type;
 
-                error |= !file.Write(team_clan);
-            }
+            error |= !file.Write(team_type);
         }
+    }
 
-        // team difficulty levels
-        {
-            for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX; ++team) {
-                int32_t difficulty_level = ResourceManager_GetSettings()->GetNumericValue("opponent");
-
-                switch (difficulty_level) {
-                    case OPPONENT_TYPE_CLUELESS:
-                    case OPPONENT_TYPE_APPRENTICE:
-                    case OPPONENT_TYPE_AVERAGE:
-                    case OPPONENT_TYPE_EXPERT:
-                    case OPPONENT_TYPE_MASTER:
-                    case OPPONENT_TYPE_GOD: {
-                    } break;
-
-                    default: {
-                        difficulty_level = OPPONENT_TYPE_EXPERT;
-                    } break;
-                }
+    // team clans
+    {
+        for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX; ++team) {
+            uint32_t team_clan = UnitsManager_TeamInfo[team].team_clan;
 
-                error |= !file.Write(difficulty_level);
-            }
+            error |= !file.Write(team_clan);
         }
+    }
 
-        // random generator seed
-        {
-            uint32_t random_seed = rng_seed;
+    // team difficulty levels
+    {
+        for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX; ++team) {
+            int32_t difficulty_level = ResourceManager_GetSettings()->GetNumericValue("opponent");
+
+            switch (difficulty_level) {
+                case OPPONENT_TYPE_CLUELESS:
+                case OPPONENT_TYPE_APPRENTICE:
+                case OPPONENT_TYPE_AVERAGE:
+                case OPPONENT_TYPE_EXPERT:
+                case OPPONENT_TYPE_MASTER:
+                case OPPONENT_TYPE_GOD: {
+                } break;
+
+                default: {
+                    difficulty_level = OPPONENT_TYPE_EXPERT;
+                } break;
+            }
 
-            error |= !file.Write(random_seed);
+            error |= !file.Write(difficulty_level);
         }
+    }
 
-        // turn timer time setting
-        {
-            int32_t turn_timer_time = ResourceManager_GetSettings()->GetNumericValue("timer");
+    // random generator seed
+    {
+        uint32_t random_seed = rng_seed;
 
-            error |= !file.Write(turn_timer_time);
-        }
+        error |= !file.Write(random_seed);
+    }
 
-        // end-turn time setting
-        {
-            int32_t endturn_time = ResourceManager_GetSettings()->GetNumericValue("endturn");
+    // turn timer time setting
+    {
+        int32_t turn_timer_time = ResourceManager_GetSettings()->GetNumericValue("timer");
 
-            error |= !file.Write(endturn_time);
-        }
+        error |= !file.Write(turn_timer_time);
+    }
 
-        // game play mode setting
-        {
-            int32_t game_play_mode = ResourceManager_GetSettings()->GetNumericValue("play_mode");
+    // end-turn time setting
+    {
+        int32_t endturn_time = ResourceManager_GetSettings()->GetNumericValue("endturn");
 
-            switch (game_play_mode) {
-                case PLAY_MODE_TURN_BASED:
-                case PLAY_MODE_SIMULTANEOUS_MOVES: {
-                } break;
+        error |= !file.Write(endturn_time);
+    }
 
-                default: {
-                    game_play_mode = PLAY_MODE_TURN_BASED;
-                } break;
-            }
+    // game play mode setting
+    {
+        int32_t game_play_mode = ResourceManager_GetSettings()->GetNumericValue("play_mode");
 
-            error |= !file.Write(game_play_mode);
-        }
+        switch (game_play_mode) {
+            case PLAY_MODE_TURN_BASED:
+            case PLAY_MODE_SIMULTANEOUS_MOVES: {
+            } break;
 
-        // settings
-        {
-            const auto settings = ResourceManager_GetSettings();
-
-            int32_t world = settings->GetNumericValue("world");
-            int32_t timer = settings->GetNumericValue("timer");
-            int32_t endturn = settings->GetNumericValue("endturn");
-            int32_t start_gold = settings->GetNumericValue("start_gold");
-            int32_t play_mode = settings->GetNumericValue("play_mode");
-            int32_t victory_type = ini_setting_victory_type;
-            int32_t victory_limit = ini_setting_victory_limit;
-            int32_t opponent = settings->GetNumericValue("opponent");
-            int32_t raw_resource = settings->GetNumericValue("raw_resource");
-            int32_t fuel_resource = settings->GetNumericValue("fuel_resource");
-            int32_t gold_resource = settings->GetNumericValue("gold_resource");
-            int32_t alien_derelicts = settings->GetNumericValue("alien_derelicts");
-            int32_t effects = settings->GetNumericValue("effects");
-            int32_t click_scroll = settings->GetNumericValue("click_scroll");
-            int32_t quick_scroll = settings->GetNumericValue("quick_scroll");
-            int32_t fast_movement = settings->GetNumericValue("fast_movement");
-            int32_t follow_unit = settings->GetNumericValue("follow_unit");
-            int32_t auto_select = settings->GetNumericValue("auto_select");
-            int32_t enemy_halt = settings->GetNumericValue("enemy_halt");
-
-            file.Write(world);
-            file.Write(timer);
-            file.Write(endturn);
-            file.Write(start_gold);
-            file.Write(play_mode);
-            file.Write(victory_type);
-            file.Write(victory_limit);
-            file.Write(opponent);
-            file.Write(raw_resource);
-            file.Write(fuel_resource);
-            file.Write(gold_resource);
-            file.Write(alien_derelicts);
-            file.Write(effects);
-            file.Write(click_scroll);
-            file.Write(quick_scroll);
-            file.Write(fast_movement);
-            file.Write(follow_unit);
-            file.Write(auto_select);
-            file.Write(enemy_halt);
+            default: {
+                game_play_mode = PLAY_MODE_TURN_BASED;
+            } break;
         }
 
-        // surface map (pass table)
-        {
-            auto world = ResourceManager_GetActiveWorld();
+        error |= !file.Write(game_play_mode);
+    }
 
-            SDL_assert(world && world->GetSurfaceMap() != nullptr);
+    // settings
+    {
+        const auto settings = ResourceManager_GetSettings();
 
-            error |= !file.Write(world->GetSurfaceMap(), map_cell_count * sizeof(uint8_t));
-        }
+        int32_t world = settings->GetNumericValue("world");
+        int32_t timer = settings->GetNumericValue("timer");
+        int32_t endturn = settings->GetNumericValue("endturn");
+        int32_t start_gold = settings->GetNumericValue("start_gold");
+        int32_t play_mode = settings->GetNumericValue("play_mode");
+        int32_t victory_type = ini_setting_victory_type;
+        int32_t victory_limit = ini_setting_victory_limit;
+        int32_t opponent = settings->GetNumericValue("opponent");
+        int32_t raw_resource = settings->GetNumericValue("raw_resource");
+        int32_t fuel_resource = settings->GetNumericValue("fuel_resource");
+        int32_t gold_resource = settings->GetNumericValue("gold_resource");
+        int32_t alien_derelicts = settings->GetNumericValue("alien_derelicts");
+        int32_t effects = settings->GetNumericValue("effects");
+        int32_t click_scroll = settings->GetNumericValue("click_scroll");
+        int32_t quick_scroll = settings->GetNumericValue("quick_scroll");
+        int32_t fast_movement = settings->GetNumericValue("fast_movement");
+        int32_t follow_unit = settings->GetNumericValue("follow_unit");
+        int32_t auto_select = settings->GetNumericValue("auto_select");
+        int32_t enemy_halt = settings->GetNumericValue("enemy_halt");
+
+        file.Write(world);
+        file.Write(timer);
+        file.Write(endturn);
+        file.Write(start_gold);
+        file.Write(play_mode);
+        file.Write(victory_type);
+        file.Write(victory_limit);
+        file.Write(opponent);
+        file.Write(raw_resource);
+        file.Write(fuel_resource);
+        file.Write(gold_resource);
+        file.Write(alien_derelicts);
+        file.Write(effects);
+        file.Write(click_scroll);
+        file.Write(quick_scroll);
+        file.Write(fast_movement);
+        file.Write(follow_unit);
+        file.Write(auto_select);
+        file.Write(enemy_halt);
+    }
 
-        // cargo map (survey map)
-        {
-            SDL_assert(ResourceManager_CargoMap != nullptr);
+    // surface map (pass table)
+    {
+        auto world = ResourceManager_GetActiveWorld();
 
-            error |= !file.Write(ResourceManager_CargoMap, map_cell_count * sizeof(uint16_t));
-        }
+        SDL_assert(world && world->GetSurfaceMap() != nullptr);
 
-        // team info
-        {
-            for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX; ++team) {
-                const CTInfo* const team_info = &UnitsManager_TeamInfo[team];
-                uint16_t unit_id;
-
-                file.Write(team_info->team_type);
-                file.Write(team_info->finished_turn);
-                file.Write(team_info->team_clan);
-                file.Write(team_info->research_topics);
-                file.Write(team_info->team_points);
-                file.Write(team_info->number_of_objects_created);
-                file.Write(team_info->unit_counters);
-                file.Write(team_info->screen_locations);
-                file.Write(team_info->score_graph, sizeof(team_info->score_graph));
-
-                if (team_info->selected_unit != nullptr) {
-                    unit_id = team_info->selected_unit->GetId();
-                } else {
-                    unit_id = 0xFFFF;
-                }
+        error |= !file.WriteSpan(std::span(world->GetSurfaceMap(), map_cell_count));
+    }
 
-                file.Write(unit_id);
-                file.Write(team_info->zoom_level);
-                file.Write(team_info->camera_position.x);
-                file.Write(team_info->camera_position.y);
-                file.Write(team_info->display_button_range);
-                file.Write(team_info->display_button_scan);
-                file.Write(team_info->display_button_status);
-                file.Write(team_info->display_button_colors);
-                file.Write(team_info->display_button_hits);
-                file.Write(team_info->display_button_ammo);
-                file.Write(team_info->display_button_names);
-                file.Write(team_info->display_button_minimap_2x);
-                file.Write(team_info->display_button_minimap_tnt);
-                file.Write(team_info->display_button_grid);
-                file.Write(team_info->display_button_survey);
-                file.Write(team_info->stats_factories_built);
-                file.Write(team_info->stats_mines_built);
-                file.Write(team_info->stats_buildings_built);
-                file.Write(team_info->stats_units_built);
-                file.Write(team_info->casualties);
-                file.Write(team_info->stats_gold_spent_on_upgrades);
+    // cargo map (survey map)
+    {
+        SDL_assert(ResourceManager_CargoMap != nullptr);
+
+        error |= !file.WriteSpan(std::span(ResourceManager_CargoMap, map_cell_count));
+    }
+
+    // team info
+    {
+        for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX; ++team) {
+            const CTInfo* const team_info = &UnitsManager_TeamInfo[team];
+            uint16_t unit_id;
+
+            file.Write(team_info->team_type);
+            file.Write(team_info->finished_turn);
+            file.Write(team_info->team_clan);
+            file.Write(team_info->research_topics);
+            file.Write(team_info->team_points);
+            file.Write(team_info->number_of_objects_created);
+            file.Write(team_info->unit_counters);
+            file.Write(team_info->screen_locations);
+            file.Write(team_info->score_graph, sizeof(team_info->score_graph));
+
+            if (team_info->selected_unit != nullptr) {
+                unit_id = team_info->selected_unit->GetId();
+            } else {
+                unit_id = 0xFFFF;
             }
+
+            file.Write(unit_id);
+            file.Write(team_info->zoom_level);
+            file.Write(team_info->camera_position.x);
+            file.Write(team_info->camera_position.y);
+            file.Write(team_info->display_button_range);
+            file.Write(team_info->display_button_scan);
+            file.Write(team_info->display_button_status);
+            file.Write(team_info->display_button_colors);
+            file.Write(team_info->display_button_hits);
+            file.Write(team_info->display_button_ammo);
+            file.Write(team_info->display_button_names);
+            file.Write(team_info->display_button_minimap_2x);
+            file.Write(team_info->display_button_minimap_tnt);
+            file.Write(team_info->display_button_grid);
+            file.Write(team_info->display_button_survey);
+            file.Write(team_info->stats_factories_built);
+            file.Write(team_info->stats_mines_built);
+            file.Write(team_info->stats_buildings_built);
+            file.Write(team_info->stats_units_built);
+            file.Write(team_info->casualties);
+            file.Write(team_info->stats_gold_spent_on_upgrades);
         }
+    }
 
-        // active team index
-        {
-            uint32_t active_turn_team = GameManager_ActiveTurnTeam;
+    // active team index
+    {
+        uint32_t active_turn_team = GameManager_ActiveTurnTeam;
 
-            SDL_assert(active_turn_team < PLAYER_TEAM_MAX);
+        SDL_assert(active_turn_team < PLAYER_TEAM_MAX);
 
-            error |= !file.Write(active_turn_team);
-        }
+        error |= !file.Write(active_turn_team);
+    }
 
-        // player team
-        {
-            uint32_t player_team = GameManager_PlayerTeam;
+    // player team
+    {
+        uint32_t player_team = GameManager_PlayerTeam;
 
-            SDL_assert(player_team < PLAYER_TEAM_MAX);
+        SDL_assert(player_team < PLAYER_TEAM_MAX);
 
-            error |= !file.Write(player_team);
-        }
+        error |= !file.Write(player_team);
+    }
 
-        // turn counter value
-        {
-            uint32_t turn_counter = GameManager_TurnCounter;
+    // turn counter value
+    {
+        uint32_t turn_counter = GameManager_TurnCounter;
 
-            error |= !file.Write(turn_counter);
-        }
+        error |= !file.Write(turn_counter);
+    }
 
-        // turn timer value
-        {
-            uint32_t turn_timer = GameManager_TurnTimerValue;
+    // turn timer value
+    {
+        uint32_t turn_timer = GameManager_TurnTimerValue;
 
-            error |= !file.Write(turn_timer);
-        }
+        error |= !file.Write(turn_timer);
+    }
 
-        // game state machine state
-        {
-            uint32_t game_state = GameManager_GameState;
+    // game state machine state
+    {
+        uint32_t game_state = GameManager_GameState;
 
-            error |= !file.Write(game_state);
-        }
+        error |= !file.Write(game_state);
+    }
 
-        // cheater flag and team (sticky - once set, cannot be unset)
-        {
-            uint32_t is_cheater = GameManager_IsCheater ? 1 : 0;
-            uint32_t cheater_team = GameManager_CheaterTeam;
+    // cheater flag and team (sticky - once set, cannot be unset)
+    {
+        uint32_t is_cheater = GameManager_IsCheater ? 1 : 0;
+        uint32_t cheater_team = GameManager_CheaterTeam;
 
-            error |= !file.Write(is_cheater);
-            error |= !file.Write(cheater_team);
-        }
+        error |= !file.Write(is_cheater);
+        error |= !file.Write(cheater_team);
+    }
 
-        // team units
-        {
-            ResourceManager_TeamUnitsRed.FileSave(file);
-            ResourceManager_TeamUnitsGreen.FileSave(file);
-            ResourceManager_TeamUnitsBlue.FileSave(file);
-            ResourceManager_TeamUnitsGray.FileSave(file);
-        }
+    // team units
+    {
+        ResourceManager_TeamUnitsRed.FileSave(file);
+        ResourceManager_TeamUnitsGreen.FileSave(file);
+        ResourceManager_TeamUnitsBlue.FileSave(file);
+        ResourceManager_TeamUnitsGray.FileSave(file);
+    }
 
-        // units
-        {
-            SmartList_UnitInfo_FileSave(UnitsManager_GroundCoverUnits, file);
-            SmartList_UnitInfo_FileSave(UnitsManager_MobileLandSeaUnits, file);
-            SmartList_UnitInfo_FileSave(UnitsManager_StationaryUnits, file);
-            SmartList_UnitInfo_FileSave(UnitsManager_MobileAirUnits, file);
-            SmartList_UnitInfo_FileSave(UnitsManager_ParticleUnits, file);
-        }
+    // units
+    {
+        SmartList_UnitInfo_FileSave(UnitsManager_GroundCoverUnits, file);
+        SmartList_UnitInfo_FileSave(UnitsManager_MobileLandSeaUnits, file);
+        SmartList_UnitInfo_FileSave(UnitsManager_StationaryUnits, file);
+        SmartList_UnitInfo_FileSave(UnitsManager_MobileAirUnits, file);
+        SmartList_UnitInfo_FileSave(UnitsManager_ParticleUnits, file);
+    }
 
-        // unit hash-map
-        {
-            Hash_UnitHash.FileSave(file);
-        }
+    // unit hash-map
+    {
+        Hash_UnitHash.FileSave(file);
+    }
 
-        // map hash-map
-        {
-            Hash_MapHash.FileSave(file);
-        }
+    // map hash-map
+    {
+        Hash_MapHash.FileSave(file);
+    }
 
-        // heat maps
-        {
-            for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX; ++team) {
-                if (UnitsManager_TeamInfo[team].team_type != TEAM_TYPE_NONE) {
-                    SDL_assert(UnitsManager_TeamInfo[team].heat_map != nullptr);
+    // heat maps
+    {
+        for (int32_t team = PLAYER_TEAM_RED; team < PLAYER_TEAM_MAX; ++team) {
+            if (UnitsManager_TeamInfo[team].team_type != TEAM_TYPE_NONE) {
+                SDL_assert(UnitsManager_TeamInfo[team].heat_map != nullptr);
 
-                    UnitsManager_TeamInfo[team].heat_map->Save(file);
-                }
+                UnitsManager_TeamInfo[team].heat_map->Save(file);
             }
         }
+    }
 
-        // message logs
-        {
-            MessageManager_SaveMessageLogs(file);
+    // message logs
+    {
+        MessageManager_SaveMessageLogs(file);
+    }
+
+    // computer ai
+    {
+        Ai_FileSave(file);
+    }
+
+    return error == false;
+}
+
+bool SaveLoad_Save(const std::filesystem::path& filepath, const char* const save_name, const uint32_t rng_seed) {
+    bool result{false};
+    SmartFileWriter file;
+
+    SaveLoad_WaitForBackgroundSave();
+
+    if (file.Open(filepath.string())) {
+        result = SaveLoad_WriteGame(file, save_name, rng_seed);
+
+        // compressed files write their last block on close
+        result = file.Close() && result;
+    }
+
+    // keep the save slot menus from parsing the new file again
+    if (result) {
+        struct SaveFileInfo save_file_info;
+
+        if (SaveLoad_ReadSaveFileInfo(filepath, save_file_info, false)) {
+            SaveLoad_GetSaveFileIndex().Update(filepath, SaveLoad_EncodeSaveFileInfo(save_file_info));
+            SaveLoad_FlushSaveFileIndex();
         }
+    }
 
-        // computer ai
-        {
-            Ai_FileSave(file);
+    return result;
+}
+
+bool SaveLoad_SaveInBackground(const std::filesystem::path& filepath, const char* const save_name,
+                               const uint32_t rng_seed, SaveWriter::CommitFunction commit) {
+    std::vector<uint8_t> stream;
+    SmartFileWriter file;
+    bool result{false};
+
+    SaveLoad_WaitForBackgroundSave();
+
+    // the game state is captured here, encoding and disk access are left to the writer thread
+    if (file.Open(stream)) {
+        result = SaveLoad_WriteGame(file, save_name, rng_seed);
+        result = file.Close() && result;
+    }
+
+    if (result) {
+        if (!SaveLoad_BackgroundWriter) {
+            SaveLoad_BackgroundWriter = std::make_unique<SaveWriter>();
+            SaveLoad_BackgroundWriter->Start();
         }
 
-        file.Close();
+        SaveLoad_BackgroundWriter->Submit(filepath, std::move(stream), std::move(commit));
+    }
 
-        result = (error == false);
+    return result;
+}
+
+bool SaveLoad_WaitForBackgroundSave() {
+    bool result{true};
+
+    if (SaveLoad_BackgroundWriter) {
+        result = SaveLoad_BackgroundWriter->Wait();
     }
 
     return result;
@@ -818,9 +981,8 @@ bool SaveLoad_LoadFormatV70(SmartFileReader& file, const MissionCategory mission
 
     const uint32_t map_cell_count{static_cast<uint32_t>(ResourceManager_MapSize.x * ResourceManager_MapSize.y)};
 
-    file.Read(const_cast<uint8_t*>(ResourceManager_GetActiveWorld()->GetSurfaceMap()),
-              map_cell_count * sizeof(uint8_t));
-    file.Read(ResourceManager_CargoMap, map_cell_count * sizeof(uint16_t));
+    file.ReadSpan(std::span(const_cast<uint8_t*>(ResourceManager_GetActiveWorld()->GetSurfaceMap()), map_cell_count));
+    file.ReadSpan(std::span(ResourceManager_CargoMap, map_cell_count));
 
     ResourceManager_InitTeamInfo();
 
@@ -1001,9 +1163,9 @@ bool SaveLoad_LoadFormatV70(SmartFileReader& file, const MissionCategory mission
 
                 temp_buffer = new (std::nothrow) char[map_cell_count];
 
-                file.Read(temp_buffer, map_cell_count);
-                file.Read(temp_buffer, map_cell_count);
-                file.Read(temp_buffer, map_cell_count);
+                file.ReadSpan(std::span(temp_buffer, map_cell_count));
+                file.ReadSpan(std::span(temp_buffer, map_cell_count));
+                file.ReadSpan(std::span(temp_buffer, map_cell_count));
 
                 delete[] temp_buffer;
 
@@ -1076,7 +1238,8 @@ bool SaveLoad_LoadFormatV71(SmartFileReader& file, const MissionCategory mission
 
     file.Read(version);
 
-    SDL_assert(version == static_cast<uint32_t>(SmartFileFormat::V71));
+    SDL_assert(version == static_cast<uint32_t>(SmartFileFormat::V71) ||
+               version == static_cast<uint32_t>(SmartFileFormat::V72));
 
     file.Read(save_file_category);
     file.Read(binary_script);
@@ -1176,9 +1339,8 @@ bool SaveLoad_LoadFormatV71(SmartFileReader& file, const MissionCategory mission
 
     const uint32_t map_cell_count{static_cast<uint32_t>(ResourceManager_MapSize.x * ResourceManager_MapSize.y)};
 
-    file.Read(const_cast<uint8_t*>(ResourceManager_GetActiveWorld()->GetSurfaceMap()),
-              map_cell_count * sizeof(uint8_t));
-    file.Read(ResourceManager_CargoMap, map_cell_count * sizeof(uint16_t));
+    file.ReadSpan(std::span(const_cast<uint8_t*>(ResourceManager_GetActiveWorld()->GetSurfaceMap()), map_cell_count));
+    file.ReadSpan(std::span(ResourceManager_CargoMap, map_cell_count));
 
     ResourceManager_InitTeamInfo();
 
@@ -1651,13 +1813,16 @@ bool SaveLoad_Load(const std::filesystem::path& filepath, const MissionCategory
     bool result;
     SmartFileReader file;
 
+    SaveLoad_WaitForBackgroundSave();
+
     if (file.Open(filepath.string())) {
         switch (file.GetFormat()) {
             case SmartFileFormat::V70: {
                 result = SaveLoad_LoadFormatV70(file, mission_category, is_remote_game, ini_load_mode);
             } break;
 
-            case SmartFileFormat::V71: {
+            case SmartFileFormat::V71:
+            case SmartFileFormat::V72: {
                 result = SaveLoad_LoadFormatV71(file, mission_category, is_remote_game, ini_load_mode);
             } break;
 
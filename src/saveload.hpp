@@ -27,6 +27,7 @@
 
 #include "enums.hpp"
 #include "mission.hpp"
+#include "savewriter.hpp"
 
 struct SaveFileInfo {
     std::filesystem::path file_path;
@@ -49,8 +50,12 @@ bool SaveLoad_GetSaveFileInfo(const MissionCategory mission_category, const int3
                               struct SaveFileInfo& save_file_info, const bool load_options = false);
 bool SaveLoad_GetSaveFileInfo(const std::filesystem::path& filepath, struct SaveFileInfo& save_file_info,
                               const bool load_options = false);
+bool SaveLoad_FlushSaveFileIndex();
 [[nodiscard]] bool SaveLoad_IsSaveFileFormatSupported(const uint32_t format_version);
 bool SaveLoad_Save(const std::filesystem::path& filepath, const char* const save_name, const uint32_t rng_seed);
+bool SaveLoad_SaveInBackground(const std::filesystem::path& filepath, const char* const save_name,
+                               const uint32_t rng_seed, SaveWriter::CommitFunction commit = {});
+bool SaveLoad_WaitForBackgroundSave();
 bool SaveLoad_Load(const std::filesystem::path& filepath, const MissionCategory mission_category, bool ini_load_mode,
                    bool is_remote_game);
 std::string SaveLoad_GetSaveFileName(const MissionCategory mission_category, const uint32_t save_slot);
@@ -243,6 +243,9 @@ void SaveLoadMenu_Init(const MissionCategory mission_category, SaveSlot* slots,
         button_list[i] = slots[i].bid;
     }
 
+    // keep the summaries of the slots that had to be read from their save files
+    SaveLoad_FlushSaveFileIndex();
+
     win_group_radio_buttons(num_buttons, button_list.data());
 
     buttons[0] = SaveLoadMenu_CreateButton(window->id, MNUUAROU, MNUUAROD, WindowManager_ScaleUlx(window, 33),
@@ -496,7 +499,8 @@ int32_t SaveLoadMenu_MenuLoop(const MissionCategory mission_category, const bool
                                         result = save_slot;
                                     }
                                 } break;
-                                case static_cast<uint32_t>(SmartFileFormat::V71): {
+                                case static_cast<uint32_t>(SmartFileFormat::V71):
+                                case static_cast<uint32_t>(SmartFileFormat::V72): {
                                     /// \todo language
                                     auto mission = std::make_shared<Mission>();
 
@@ -590,7 +594,7 @@ int32_t SaveLoadMenu_MenuLoop(const MissionCategory mission_category, const bool
     return result;
 }
 
-void SaveLoadMenu_Save(const char* file_name, const char* save_name, bool play_voice, bool backup) {
+void SaveLoadMenu_Save(const char* file_name, const char* save_name, bool play_voice, bool backup, bool background) {
     SmartString filename{file_name};
     std::filesystem::path filepath;
     char team_types[PLAYER_TEAM_MAX - 1];
@@ -598,7 +602,8 @@ void SaveLoadMenu_Save(const char* file_name, const char* save_name, bool play_v
 
     filepath = (ResourceManager_FilePathGamePref / filename.GetCStr()).lexically_normal();
 
-    if (backup) {
+    // a background save rotates the backups once the new file is complete, see below
+    if (backup && !background) {
         SaveLoadMenu_CreateBackup(filepath.string().c_str());
     }
 
@@ -618,7 +623,22 @@ void SaveLoadMenu_Save(const char* file_name, const char* save_name, bool play_v
         rng_seed += file_name[i];
     }
 
-    if (SaveLoad_Save(filepath, save_name, rng_seed)) {
+    bool result;
+
+    if (background) {
+        SaveWriter::CommitFunction commit;
+
+        if (backup) {
+            commit = [](const std::filesystem::path& path) { SaveLoadMenu_CreateBackup(path.string().c_str()); };
+        }
+
+        result = SaveLoad_SaveInBackground(filepath, save_name, rng_seed, std::move(commit));
+
+    } else {
+        result = SaveLoad_Save(filepath, save_name, rng_seed);
+    }
+
+    if (result) {
         if (play_voice) {
             ResourceManager_GetSoundManager().PlayVoice(V_M013, V_F013);
         }
@@ -47,6 +47,7 @@ inline constexpr int32_t SaveLoadMenu_LastSaveSlot = SaveLoadMenu_SaveSlotLimit
 
 void SaveLoadMenu_CreateBackup(const char* file_name);
 int32_t SaveLoadMenu_MenuLoop(const MissionCategory mission_category, const bool is_saving_allowed);
-void SaveLoadMenu_Save(const char* file_name, const char* save_name, bool play_voice, bool backup = false);
+void SaveLoadMenu_Save(const char* file_name, const char* save_name, bool play_voice, bool backup = false,
+                       bool background = false);
 
 #endif /* SAVELOADMENU_HPP */
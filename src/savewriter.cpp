@@ -0,0 +1,223 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "savewriter.hpp"
+
+#include <SDL3/SDL.h>
+
+#include <exception>
+
+#include "smartfile.hpp"
+
+SaveWriter::SaveWriter()
+    : m_thread(nullptr),
+      m_mutex(nullptr),
+      m_wake(nullptr),
+      m_done(nullptr),
+      m_exit_requested(false),
+      m_is_pending(false),
+      m_result(true) {}
+
+SaveWriter::~SaveWriter() { Stop(); }
+
+bool SaveWriter::Start() {
+    if (m_thread) {
+        return true;
+    }
+
+    m_mutex = SDL_CreateMutex();
+    m_wake = SDL_CreateCondition();
+    m_done = SDL_CreateCondition();
+    m_exit_requested = false;
+
+    if (m_mutex && m_wake && m_done) {
+        m_thread = SDL_CreateThread(ThreadFunction, "SaveWriter", this);
+    }
+
+    if (!m_thread) {
+        SDL_Log("SaveWriter: failed to start writer thread.\n");
+
+        Stop();
+
+        return false;
+    }
+
+    return true;
+}
+
+void SaveWriter::Stop() {
+    if (m_thread) {
+        SDL_LockMutex(m_mutex);
+        m_exit_requested = true;
+        SDL_SignalCondition(m_wake);
+        SDL_UnlockMutex(m_mutex);
+
+        SDL_WaitThread(m_thread, nullptr);
+        m_thread = nullptr;
+    }
+
+    if (m_done) {
+        SDL_DestroyCondition(m_done);
+        m_done = nullptr;
+    }
+
+    if (m_wake) {
+        SDL_DestroyCondition(m_wake);
+        m_wake = nullptr;
+    }
+
+    if (m_mutex) {
+        SDL_DestroyMutex(m_mutex);
+        m_mutex = nullptr;
+    }
+}
+
+void SaveWriter::Submit(const std::filesystem::path& path, std::vector<uint8_t>&& stream, CommitFunction commit) {
+    if (!m_thread) {
+        m_result = WriteFile(path, stream, commit);
+
+        return;
+    }
+
+    SDL_LockMutex(m_mutex);
+
+    while (m_is_pending) {
+        SDL_WaitCondition(m_done, m_mutex);
+    }
+
+    m_path = path;
+    m_stream = std::move(stream);
+    m_commit = std::move(commit);
+    m_is_pending = true;
+
+    SDL_SignalCondition(m_wake);
+    SDL_UnlockMutex(m_mutex);
+}
+
+bool SaveWriter::Wait() {
+    if (!m_thread) {
+        return m_result;
+    }
+
+    SDL_LockMutex(m_mutex);
+
+    while (m_is_pending) {
+        SDL_WaitCondition(m_done, m_mutex);
+    }
+
+    const bool result = m_result;
+
+    SDL_UnlockMutex(m_mutex);
+
+    return result;
+}
+
+bool SaveWriter::WriteFile(const std::filesystem::path& path, const std::vector<uint8_t>& stream,
+                           const CommitFunction& commit) {
+    auto temporary_path = path;
+    SmartFileWriter file;
+    std::error_code ec;
+
+    temporary_path += ".tmp";
+
+    if (!file.Open(temporary_path.string())) {
+        SDL_Log("SaveWriter: failed to create %s.\n", temporary_path.string().c_str());
+
+        return false;
+    }
+
+    bool result = file.SetFormat(static_cast<uint16_t>(SmartFileFormat::V72));
+
+    result = result && file.Write(stream.data(), stream.size());
+    result = file.Close() && result;
+
+    if (!result) {
+        SDL_Log("SaveWriter: failed to write %s.\n", temporary_path.string().c_str());
+
+        file.Delete();
+
+        return false;
+    }
+
+    if (commit) {
+        commit(path);
+    }
+
+    std::filesystem::rename(temporary_path, path, ec);
+
+    if (ec) {
+        SDL_Log("SaveWriter: failed to replace %s: %s\n", path.string().c_str(), ec.message().c_str());
+
+        std::filesystem::remove(temporary_path, ec);
+
+        return false;
+    }
+
+    return true;
+}
+
+int SDLCALL SaveWriter::ThreadFunction(void* data) {
+    static_cast<SaveWriter*>(data)->Run();
+
+    return 0;
+}
+
+void SaveWriter::Run() {
+    SDL_LockMutex(m_mutex);
+
+    for (;;) {
+        while (!m_exit_requested && !m_is_pending) {
+            SDL_WaitCondition(m_wake, m_mutex);
+        }
+
+        // a pending save is written out even if an exit is requested
+        if (!m_is_pending) {
+            break;
+        }
+
+        SDL_UnlockMutex(m_mutex);
+
+        bool result = false;
+
+        // see WorkerThread::Run(), an exception must not unwind into the SDL thread entry point
+        try {
+            result = WriteFile(m_path, m_stream, m_commit);
+
+        } catch (const std::exception& e) {
+            SDL_Log("SaveWriter: writing %s threw \"%s\".\n", m_path.string().c_str(), e.what());
+
+        } catch (...) {
+            SDL_Log("SaveWriter: writing %s threw an unknown exception.\n", m_path.string().c_str());
+        }
+
+        SDL_LockMutex(m_mutex);
+
+        m_stream.clear();
+        m_stream.shrink_to_fit();
+        m_commit = nullptr;
+        m_result = result;
+        m_is_pending = false;
+
+        SDL_BroadcastCondition(m_done);
+    }
+
+    SDL_UnlockMutex(m_mutex);
+}
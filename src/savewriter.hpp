@@ -0,0 +1,116 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SAVEWRITER_HPP
+#define SAVEWRITER_HPP
+
+#include <SDL3/SDL_mutex.h>
+#include <SDL3/SDL_thread.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <vector>
+
+/**
+ * \class SaveWriter
+ * \brief Background thread that compresses serialized save files and commits them to disk.
+ *
+ * The caller serializes the game into a memory buffer through SmartFileWriter and submits the buffer, so that the
+ * game can go on while the buffer is encoded in the compressed save format and written out. The file is first written
+ * next to its destination and then renamed over it, so a crash or a full disk during the write leaves the previous
+ * file intact.
+ *
+ * One save is in flight at a time. Submit() and Wait() must be called from one thread, in practice the main thread.
+ */
+class SaveWriter {
+public:
+    /**
+     * \brief Called on the writer thread once the new file is complete, right before it replaces the destination.
+     *
+     * \param path Destination of the save file, which still holds the previous save if there is one.
+     */
+    using CommitFunction = std::function<void(const std::filesystem::path& path)>;
+
+    SaveWriter();
+    ~SaveWriter();
+
+    SaveWriter(const SaveWriter&) = delete;
+    SaveWriter& operator=(const SaveWriter&) = delete;
+
+    /**
+     * \brief Spawns the writer thread.
+     *
+     * \return True if the thread was started. Otherwise Submit() writes on the calling thread.
+     */
+    bool Start();
+
+    /**
+     * \brief Writes out a pending save and joins the writer thread.
+     */
+    void Stop();
+
+    /**
+     * \brief Hands a serialized save over to the writer thread. A save that is still in flight is waited for first.
+     *
+     * \param path Destination of the save file.
+     * \param stream Uncompressed object stream produced by SmartFileWriter, taken over by the writer.
+     * \param commit Optional function that runs before the new file replaces the destination.
+     */
+    void Submit(const std::filesystem::path& path, std::vector<uint8_t>&& stream, CommitFunction commit = {});
+
+    /**
+     * \brief Waits until the save in flight, if any, is on disk.
+     *
+     * \return True if the last submitted save was written successfully or nothing was submitted yet.
+     */
+    bool Wait();
+
+    /**
+     * \brief Writes a serialized save in the compressed format through a temporary file.
+     *
+     * \param path Destination of the save file.
+     * \param stream Uncompressed object stream produced by SmartFileWriter.
+     * \param commit Optional function that runs before the new file replaces the destination.
+     * \return True on success. On failure the destination is left untouched.
+     */
+    static bool WriteFile(const std::filesystem::path& path, const std::vector<uint8_t>& stream,
+                          const CommitFunction& commit);
+
+private:
+    SDL_Thread* m_thread;
+    SDL_Mutex* m_mutex;
+    SDL_Condition* m_wake;
+    SDL_Condition* m_done;
+    bool m_exit_requested;
+
+    bool m_is_pending;
+    bool m_result;
+    std::filesystem::path m_path;
+    std::vector<uint8_t> m_stream;
+    CommitFunction m_commit;
+
+    static int SDLCALL ThreadFunction(void* data);
+
+    void Run();
+};
+
+#endif /* SAVEWRITER_HPP */
@@ -42,6 +42,7 @@ static const std::vector<std::pair<std::string, Settings::SettingDefinition>> se
     {"exclude_range", {3, "DEBUG"}},
     {"proximity_range", {14, "DEBUG"}},
     {"log_file_debug", {0, "DEBUG"}},
+    {"startup_report", {0, "DEBUG"}},
     {"raw_normal_low", {0, "DEBUG"}},
     {"raw_normal_high", {5, "DEBUG"}},
     {"raw_concentrate_low", {13, "DEBUG"}},
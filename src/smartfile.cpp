@@ -23,8 +23,42 @@
 
 #include <SDL3/SDL.h>
 
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#include "blockcompressor.hpp"
 #include "registerarray.hpp"
 
+/*
+ * A V72 file starts with its 32 bit format version, which keeps the format detectable by SmartFileReader::Open(),
+ * followed by blocks of the same stream that a V71 file holds. Each block is a header and the payload, the payload is
+ * stored raw if it does not compress.
+ *
+ * Both formats go through a stream buffer of SmartFile_BlockSize bytes, so the many small fields of the game objects
+ * cost a copy instead of a stdio call each. Transfers that are larger than the buffer skip it, which keeps the map
+ * sized arrays at one copy between the file and their final location.
+ */
+struct SmartFileBlockHeader {
+    uint32_t raw_size;
+    uint32_t packed_size;
+};
+
+/*
+ * A save holds tens of thousands of objects. Object counts written ahead of lists pre-size the object index, the limit
+ * keeps a damaged count from reserving memory that the file cannot fill.
+ */
+static constexpr size_t SmartFile_ObjectIndexCapacity = 4096;
+static constexpr size_t SmartFile_ObjectCountHintLimit = 65536;
+
+static void SmartFile_ReserveObjects(std::vector<FileObject*>& objects, const uint32_t count) noexcept {
+    const size_t required = objects.size() + std::min<size_t>(count, SmartFile_ObjectCountHintLimit);
+
+    if (required > objects.capacity()) {
+        objects.reserve(std::max(required, objects.capacity() * 2));
+    }
+}
+
 SmartFileReader::SmartFileReader() noexcept : m_format(static_cast<uint16_t>(SmartFileFormat::UNSPECIFIED)) {};
 
 SmartFileReader::SmartFileReader(const std::string& path) noexcept
@@ -44,6 +78,10 @@ void SmartFileReader::SetFormat(const uint16_t format) noexcept {
             m_format = static_cast<uint16_t>(SmartFileFormat::V71);
         } break;
 
+        case static_cast<uint16_t>(SmartFileFormat::V72): {
+            m_format = static_cast<uint16_t>(SmartFileFormat::V72);
+        } break;
+
         default: {
             m_format = static_cast<uint16_t>(SmartFileFormat::UNSUPPORTED);
         } break;
@@ -62,18 +100,48 @@ bool SmartFileReader::Open(const std::string& path) noexcept {
             format = static_cast<uint16_t>(SmartFileFormat::UNSPECIFIED);
         }
 
-        fseek(file, 0, SEEK_SET);
-
         SetFormat(format);
+
+        m_block.reserve(SmartFile_BlockSize);
+        read_objects.reserve(SmartFile_ObjectIndexCapacity);
+
+        // the object stream of compressed files starts after the version
+        if (m_format == static_cast<uint16_t>(SmartFileFormat::V72)) {
+            fseek(file, sizeof(uint32_t), SEEK_SET);
+
+        } else {
+            fseek(file, 0, SEEK_SET);
+        }
     }
 
     return file != nullptr;
 }
 
+/* reads a stream that SmartFileWriter serialized into memory */
+bool SmartFileReader::Open(std::vector<uint8_t>&& memory) noexcept {
+    Close();
+
+    SetFormat(static_cast<uint16_t>(SmartFileFormat::V71));
+
+    m_block = std::move(memory);
+    m_is_memory = true;
+
+    return true;
+}
+
 bool SmartFileReader::Close() noexcept {
-    bool result{false};
+    bool result{m_is_memory};
 
-    read_objects.Release();
+    m_is_memory = false;
+
+    for (FileObject* const object : read_objects) {
+        object->Decrement();
+    }
+
+    read_objects.clear();
+
+    m_block.clear();
+    m_block_position = 0;
 
     if (file != nullptr) {
         result = fclose(file) != EOF;
@@ -83,10 +151,92 @@ bool SmartFileReader::Close() noexcept {
     return result;
 }
 
-bool SmartFileReader::Read(void* const buffer, const size_t size) noexcept { return fread(buffer, size, 1, file) == 1; }
+bool SmartFileReader::ReadBlockHeader(SmartFileBlockHeader& header) noexcept {
+    return fread(&header, sizeof(header), 1, file) == 1 && header.raw_size != 0 &&
+           header.raw_size <= SmartFile_BlockSize && header.packed_size <= header.raw_size;
+}
+
+bool SmartFileReader::ReadBlockPayload(const SmartFileBlockHeader& header, uint8_t* const target) noexcept {
+    if (header.packed_size == header.raw_size) {
+        return fread(target, header.raw_size, 1, file) == 1;
+    }
+
+    m_packed_block.resize(header.packed_size);
+
+    return fread(m_packed_block.data(), header.packed_size, 1, file) == 1 &&
+           BlockCompressor_Decompress(m_packed_block.data(), header.packed_size, target, header.raw_size);
+}
+
+bool SmartFileReader::ReadFromFile(void* const buffer, const size_t size) noexcept {
+    auto target = static_cast<uint8_t*>(buffer);
+    size_t remaining = size;
+
+    while (remaining) {
+        if (m_block_position == m_block.size()) {
+            bool result;
+
+            if (file == nullptr) {
+                return false;
+            }
+
+            m_block.clear();
+            m_block_position = 0;
+
+            if (m_format != static_cast<uint16_t>(SmartFileFormat::V72)) {
+                if (remaining >= SmartFile_BlockSize) {
+                    return fread(target, remaining, 1, file) == 1;
+                }
+
+                m_block.resize(SmartFile_BlockSize);
+                m_block.resize(fread(m_block.data(), 1, SmartFile_BlockSize, file));
+
+                result = !m_block.empty();
+
+            } else {
+                SmartFileBlockHeader header;
+
+                result = ReadBlockHeader(header);
+
+                if (result && header.raw_size <= remaining) {
+                    if (!ReadBlockPayload(header, target)) {
+                        return false;
+                    }
+
+                    target += header.raw_size;
+                    remaining -= header.raw_size;
+
+                    continue;
+                }
+
+                if (result) {
+                    m_block.resize(header.raw_size);
+
+                    result = ReadBlockPayload(header, m_block.data());
+                }
+            }
+
+            if (!result) {
+                m_block.clear();
+
+                return false;
+            }
+        }
+
+        const size_t count = std::min(remaining, m_block.size() - m_block_position);
+
+        memcpy(target, &m_block[m_block_position], count);
+
+        m_block_position += count;
+        target += count;
+        remaining -= count;
+    }
+
+    return true;
+}
 
 void SmartFileReader::LoadObject(FileObject& object) noexcept {
-    read_objects.Insert(&object);
+    object.Increment();
+    read_objects.push_back(&object);
 
     object.FileLoad(*this);
 }
@@ -138,6 +288,8 @@ void SmartFileReader::LoadObject(FileObject& object) noexcept {
         value = count;
     }
 
+    SmartFile_ReserveObjects(read_objects, value);
+
     return value;
 }
 
@@ -146,13 +298,13 @@ void SmartFileReader::LoadObject(FileObject& object) noexcept {
     FileObject* object{nullptr};
 
     if (object_index != 0uL) {
-        if (read_objects.GetCount() >= object_index) {
-            object = &read_objects[object_index - 1];
+        if (read_objects.size() >= object_index) {
+            object = read_objects[object_index - 1];
 
         } else {
             const uint32_t type_index = ReadIndex();
 
-            SDL_assert(object_index == read_objects.GetCount() + 1);
+            SDL_assert(object_index == read_objects.size() + 1);
             SDL_assert(type_index != 0uL);
             SDL_assert(type_index <= RegisterClass::GetRegister().GetCount());
 
@@ -180,20 +332,45 @@ bool SmartFileWriter::Open(const std::string& path) noexcept {
 
     file = fopen(filepath.string().c_str(), "wb");
 
+    m_block.reserve(SmartFile_BlockSize);
+    objects.reserve(SmartFile_ObjectIndexCapacity);
+
     return file != nullptr;
 }
 
+/* the object stream is serialized into memory as is, SaveWriter compresses it later on */
+bool SmartFileWriter::Open(std::vector<uint8_t>& memory) noexcept {
+    Close();
+
+    memory.clear();
+    m_memory = &memory;
+
+    objects.reserve(SmartFile_ObjectIndexCapacity);
+
+    return true;
+}
+
 bool SmartFileWriter::Close() noexcept {
-    bool result{false};
+    bool result{m_memory != nullptr};
+    bool is_flushed{true};
 
-    for (auto it = objects.Begin(), it_end = objects.End(); it != it_end; ++it) {
-        (*it).SetIndex(0);
+    if (file != nullptr) {
+        is_flushed = FlushBlock();
+    }
+
+    m_block.clear();
+    m_is_container_started = false;
+    m_memory = nullptr;
+
+    for (FileObject* const object : objects) {
+        object->SetIndex(0);
+        object->Decrement();
     }
 
-    objects.Clear();
+    objects.clear();
 
     if (file != nullptr) {
-        result = fclose(file) != EOF;
+        result = (fclose(file) != EOF) && is_flushed;
         file = nullptr;
     }
 
@@ -218,13 +395,105 @@ void SmartFileWriter::Delete() noexcept {
     }
 }
 
-bool SmartFileWriter::Write(const void* const buffer, const size_t size) noexcept {
-    return fwrite(buffer, size, 1, file) == 1;
+bool SmartFileWriter::WriteBlock(const uint8_t* const data, const size_t size) noexcept {
+    if (m_format != static_cast<uint16_t>(SmartFileFormat::V72)) {
+        return size == 0 || fwrite(data, size, 1, file) == 1;
+    }
+
+    if (!m_is_container_started) {
+        const uint32_t version = static_cast<uint32_t>(SmartFileFormat::V72);
+
+        if (fwrite(&version, sizeof(version), 1, file) != 1) {
+            return false;
+        }
+
+        m_is_container_started = true;
+    }
+
+    // an empty file still holds its version
+    if (size == 0) {
+        return true;
+    }
+
+    SmartFileBlockHeader header;
+
+    header.raw_size = static_cast<uint32_t>(size);
+
+    // a payload that does not shrink is stored raw
+    m_packed_block.resize(size - 1);
+    header.packed_size =
+        static_cast<uint32_t>(BlockCompressor_Compress(data, size, m_packed_block.data(), m_packed_block.size()));
+
+    const uint8_t* payload = m_packed_block.data();
+
+    if (header.packed_size == 0) {
+        header.packed_size = header.raw_size;
+        payload = data;
+    }
+
+    return fwrite(&header, sizeof(header), 1, file) == 1 && fwrite(payload, header.packed_size, 1, file) == 1;
+}
+
+bool SmartFileWriter::FlushBlock() noexcept {
+    const bool result = WriteBlock(m_block.data(), m_block.size());
+
+    m_block.clear();
+
+    return result;
+}
+
+bool SmartFileWriter::WriteToFile(const void* const buffer, const size_t size) noexcept {
+    if (m_memory) {
+        auto source = static_cast<const uint8_t*>(buffer);
+
+        try {
+            m_memory->insert(m_memory->end(), source, source + size);
+
+        } catch (const std::bad_alloc&) {
+            return false;
+        }
+
+        return true;
+    }
+
+    auto source = static_cast<const uint8_t*>(buffer);
+    size_t remaining = size;
+
+    while (remaining) {
+        // large transfers are written from the source, whole blocks at a time in the compressed format
+        if (m_block.empty() && remaining >= SmartFile_BlockSize) {
+            const size_t count =
+                m_format == static_cast<uint16_t>(SmartFileFormat::V72) ? SmartFile_BlockSize : remaining;
+
+            if (!WriteBlock(source, count)) {
+                return false;
+            }
+
+            source += count;
+            remaining -= count;
+
+            continue;
+        }
+
+        const size_t count = std::min(remaining, SmartFile_BlockSize - m_block.size());
+
+        m_block.insert(m_block.end(), source, source + count);
+
+        source += count;
+        remaining -= count;
+
+        if (m_block.size() == SmartFile_BlockSize && !FlushBlock()) {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 void SmartFileWriter::AddObject(FileObject* const object) noexcept {
-    objects.PushBack(*object);
-    object->SetIndex(objects.GetCount());
+    object->Increment();
+    objects.push_back(object);
+    object->SetIndex(objects.size());
 }
 
 void SmartFileWriter::SaveObject(FileObject* const object) noexcept {
@@ -234,7 +503,11 @@ void SmartFileWriter::SaveObject(FileObject* const object) noexcept {
 
 void SmartFileWriter::WriteIndex(const uint32_t index) noexcept { Write(index); }
 
-void SmartFileWriter::WriteObjectCount(const uint32_t count) noexcept { Write(count); }
+void SmartFileWriter::WriteObjectCount(const uint32_t count) noexcept {
+    SmartFile_ReserveObjects(objects, count);
+
+    Write(count);
+}
 
 void SmartFileWriter::WriteObject(FileObject* const object) noexcept {
     if (nullptr == object) {
@@ -247,7 +520,7 @@ void SmartFileWriter::WriteObject(FileObject* const object) noexcept {
             Write(object_index);
 
         } else {
-            WriteIndex(objects.GetCount() + 1);
+            WriteIndex(objects.size() + 1);
             WriteIndex(object->GetTypeIndex());
             SaveObject(object);
         }
@@ -270,6 +543,10 @@ SmartFileFormat SmartFileWriter::GetFormat() noexcept { return static_cast<Smart
             m_format = static_cast<uint16_t>(SmartFileFormat::V71);
         } break;
 
+        case static_cast<uint16_t>(SmartFileFormat::V72): {
+            m_format = static_cast<uint16_t>(SmartFileFormat::V72);
+        } break;
+
         default: {
             result = false;
         } break;
@@ -23,9 +23,12 @@
 #define SMARTFILE_HPP
 
 #include <cstdio>
+#include <cstring>
 #include <filesystem>
 #include <memory>
+#include <span>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "fileobject.hpp"
@@ -36,20 +39,35 @@ enum class SmartFileFormat : uint16_t {
     UNSPECIFIED = 0,
     V70 = 70,
     V71 = 71,
-    LATEST = 71,
+    V72 = 72,
+    LATEST = 72,
     UNSUPPORTED = 0xFFFF,
 };
 
+/* size of the stream buffers, also the largest payload of a compressed block */
+inline constexpr size_t SmartFile_BlockSize = 256 * 1024;
+
+struct SmartFileBlockHeader;
+
 class SmartFileReader {
     uint16_t m_format;
+    std::vector<uint8_t> m_block;
+    std::vector<uint8_t> m_packed_block;
+    size_t m_block_position{0};
+    bool m_is_memory{false};
 
     void LoadObject(FileObject& object) noexcept;
     [[nodiscard]] uint32_t ReadIndex() noexcept;
     void SetFormat(const uint16_t format) noexcept;
+    [[nodiscard]] bool ReadBlockHeader(SmartFileBlockHeader& header) noexcept;
+    [[nodiscard]] bool ReadBlockPayload(const SmartFileBlockHeader& header, uint8_t* target) noexcept;
+    [[nodiscard]] bool ReadFromFile(void* buffer, size_t size) noexcept;
 
 protected:
     FILE* file{nullptr};
-    SmartArray<FileObject> read_objects;
+
+    /* objects by file index - 1, each holds one reference for the session */
+    std::vector<FileObject*> read_objects;
 
 public:
     SmartFileReader() noexcept;
@@ -57,10 +75,13 @@ public:
     ~SmartFileReader() noexcept;
 
     bool Open(const std::string& path) noexcept;
+    bool Open(std::vector<uint8_t>&& memory) noexcept;
     bool Close() noexcept;
     bool Read(void* buffer, size_t size) noexcept;
     template <typename T>
     bool Read(T& buffer) noexcept;
+    template <typename T, size_t Extent>
+    bool ReadSpan(std::span<T, Extent> items) noexcept;
     bool Read(std::string& text) noexcept;
     bool Read(std::vector<uint8_t>& buffer) noexcept;
     [[nodiscard]] uint32_t ReadObjectCount() noexcept;
@@ -71,13 +92,22 @@ public:
 class SmartFileWriter {
     std::filesystem::path filepath;
     uint16_t m_format;
+    std::vector<uint8_t> m_block;
+    std::vector<uint8_t> m_packed_block;
+    bool m_is_container_started{false};
+    std::vector<uint8_t>* m_memory{nullptr};
 
     void SaveObject(FileObject* object) noexcept;
     void WriteIndex(const uint32_t index) noexcept;
+    [[nodiscard]] bool WriteBlock(const uint8_t* data, size_t size) noexcept;
+    [[nodiscard]] bool FlushBlock() noexcept;
+    [[nodiscard]] bool WriteToFile(const void* buffer, size_t size) noexcept;
 
 protected:
     FILE* file{nullptr};
-    SmartList<FileObject> objects;
+
+    /* objects by file index - 1, each holds one reference for the session */
+    std::vector<FileObject*> objects;
 
     void AddObject(FileObject* object) noexcept;
 
@@ -87,11 +117,14 @@ public:
     ~SmartFileWriter() noexcept;
 
     bool Open(const std::string& path) noexcept;
+    bool Open(std::vector<uint8_t>& memory) noexcept;
     bool Close() noexcept;
     void Delete() noexcept;
     bool Write(const void* buffer, size_t size) noexcept;
     template <typename T>
     bool Write(const T& buffer) noexcept;
+    template <typename T, size_t Extent>
+    bool WriteSpan(std::span<T, Extent> items) noexcept;
     bool Write(const std::string& string) noexcept;
     bool Write(const std::vector<uint8_t>& buffer) noexcept;
     void WriteObjectCount(const uint32_t count) noexcept;
@@ -100,16 +133,55 @@ public:
     [[nodiscard]] bool SetFormat(const uint16_t format) noexcept;
 };
 
+/* fields are served from the stream buffer, the file is only accessed once the buffer runs dry */
+inline bool SmartFileReader::Read(void* const buffer, const size_t size) noexcept {
+    if (size <= m_block.size() - m_block_position) {
+        memcpy(buffer, &m_block.data()[m_block_position], size);
+        m_block_position += size;
+
+        return true;
+    }
+
+    return ReadFromFile(buffer, size);
+}
+
 template <typename T>
 inline bool SmartFileReader::Read(T& buffer) noexcept {
     return Read(&buffer, sizeof(T));
 }
 
+/* map sized arrays of plain data are transferred in one piece, see ReadFromFile() */
+template <typename T, size_t Extent>
+inline bool SmartFileReader::ReadSpan(std::span<T, Extent> items) noexcept {
+    static_assert(std::is_trivially_copyable_v<T> && !std::is_const_v<T>);
+
+    return Read(items.data(), items.size_bytes());
+}
+
+inline bool SmartFileWriter::Write(const void* const buffer, const size_t size) noexcept {
+    if (m_block.size() + size < SmartFile_BlockSize && m_memory == nullptr) {
+        const auto source = static_cast<const uint8_t*>(buffer);
+
+        m_block.insert(m_block.end(), source, source + size);
+
+        return true;
+    }
+
+    return WriteToFile(buffer, size);
+}
+
 template <typename T>
 inline bool SmartFileWriter::Write(const T& buffer) noexcept {
     return Write(&buffer, sizeof(T));
 }
 
+template <typename T, size_t Extent>
+inline bool SmartFileWriter::WriteSpan(std::span<T, Extent> items) noexcept {
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    return Write(items.data(), items.size_bytes());
+}
+
 inline bool SmartFileReader::Read(std::string& text) noexcept {
     uint32_t length;
     bool result{false};
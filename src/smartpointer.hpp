@@ -30,6 +30,8 @@
 class SmartObject {
     template <class T>
     friend class SmartPointer;
+    friend class SmartFileReader;
+    friend class SmartFileWriter;
     uint32_t reference_count{0};
 
 protected:
@@ -26,6 +26,7 @@
 #include <new>
 
 #include "enums.hpp"
+#include "frameprofiler.hpp"
 #include "game_manager.hpp"
 #include "gfx.hpp"
 #include "gnw.h"
@@ -644,6 +645,8 @@ void SoundManager::SetVolume(const int32_t type, const float volume) noexcept {
 }
 
 void SoundManager::ProcessJobs() noexcept {
+    FRAME_PROFILER_SCOPE("SoundJobs");
+
     if (m_is_audio_enabled) {
         UpdateMusic();
 
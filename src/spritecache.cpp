@@ -0,0 +1,207 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "spritecache.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+/* keep in sync with GFX_SCALE_BASE of gfx.hpp */
+static constexpr uint32_t SpriteCache_ScaleBase = 16;
+
+static constexpr uint8_t SpriteCache_RowDelimiter = 0xFF;
+
+size_t SpriteCache::KeyHash::operator()(const Key& key) const noexcept {
+    uint64_t hash = reinterpret_cast<uintptr_t>(key.row_offsets);
+
+    hash = (hash ^ reinterpret_cast<uintptr_t>(key.color_indices)) * 0x9E3779B97F4A7C15ull;
+    hash = (hash ^ reinterpret_cast<uintptr_t>(key.color_table)) * 0x9E3779B97F4A7C15ull;
+    hash = (hash ^ ((static_cast<uint64_t>(key.scaled_width) << 24) | (static_cast<uint64_t>(key.scaled_height) << 8) |
+                    key.team_color)) *
+           0x9E3779B97F4A7C15ull;
+
+    return static_cast<size_t>(hash ^ (hash >> 32));
+}
+
+SpriteCache::SpriteCache(size_t byte_budget) : m_byte_budget(byte_budget), m_byte_count(0) {}
+
+const SpriteCacheFrame& SpriteCache::GetFrame(const SpriteCacheSource& source) {
+    // solid team color frames do not depend on the color indices
+    const Key key{.row_offsets = source.row_offsets,
+                  .color_indices = source.team_color ? nullptr : source.color_indices,
+                  .color_table = source.color_table,
+                  .scaled_width = source.scaled_width,
+                  .scaled_height = source.scaled_height,
+                  .team_color = source.team_color};
+
+    auto it = m_lookup.find(key);
+
+    if (it != m_lookup.end()) {
+        ++m_statistics.hits;
+
+        if (it->second != m_entries.begin()) {
+            m_entries.splice(m_entries.begin(), m_entries, it->second);
+        }
+
+        return it->second->frame;
+    }
+
+    ++m_statistics.misses;
+
+    m_entries.push_front({key, {}});
+
+    SpriteCacheFrame& frame = m_entries.front().frame;
+
+    SpriteCache_DecodeFrame(source, frame);
+
+    m_lookup.emplace(key, m_entries.begin());
+    m_byte_count += frame.GetSize();
+
+    while (m_byte_count > m_byte_budget && m_entries.size() > 1) {
+        const Entry& entry = m_entries.back();
+
+        m_byte_count -= entry.frame.GetSize();
+        m_lookup.erase(entry.key);
+        m_entries.pop_back();
+
+        ++m_statistics.evictions;
+    }
+
+    return frame;
+}
+
+void SpriteCache::Invalidate() noexcept {
+    m_lookup.clear();
+    m_entries.clear();
+    m_byte_count = 0;
+
+    ++m_statistics.invalidations;
+}
+
+static inline int32_t SpriteCache_GetScaledColumn(int32_t pixel_count, uint32_t scaling_factor) {
+    return static_cast<int32_t>((static_cast<uint32_t>(pixel_count) << SpriteCache_ScaleBase) / scaling_factor) + 1;
+}
+
+void SpriteCache_DecodeFrame(const SpriteCacheSource& source, SpriteCacheFrame& frame) {
+    const uint32_t scaling_factor = source.scaling_factor_width;
+
+    frame.width = source.scaled_width;
+    frame.height = source.scaled_height;
+    frame.row_spans.clear();
+    frame.row_spans.reserve(frame.height + 1);
+    frame.spans.clear();
+    frame.pixels.clear();
+
+    for (uint32_t y = 0; y < frame.height; ++y) {
+        const uint8_t* data =
+            &source.resource_buffer[source.row_offsets[(y * source.scaling_factor_height) >> SpriteCache_ScaleBase]];
+        int32_t pixel_count = 0;
+        int32_t column = 0;
+        int32_t remaining = frame.width;
+
+        frame.row_spans.push_back(static_cast<uint32_t>(frame.spans.size()));
+
+        // run boundaries map to scaled columns exactly like in Gfx_DecodeSprite(), so any clipped area of the decoded
+        // frame matches what a clipped decode would draw
+        while (*data != SpriteCache_RowDelimiter) {
+            const int32_t transparent_count = data[0];
+            const int32_t opaque_count = data[1];
+            const uint8_t* const run = &data[2];
+
+            data = &run[opaque_count];
+            pixel_count += transparent_count;
+
+            if (pixel_count) {
+                const int32_t skipped = SpriteCache_GetScaledColumn(pixel_count, scaling_factor) - column;
+
+                column += skipped;
+                remaining -= skipped;
+
+                if (remaining <= 0) {
+                    break;
+                }
+            }
+
+            const int32_t start = column;
+            const uint8_t* const row_address = run - pixel_count;
+
+            pixel_count += opaque_count;
+
+            int32_t length = SpriteCache_GetScaledColumn(pixel_count, scaling_factor) - column;
+
+            column += length;
+            remaining -= length;
+
+            if (remaining < 0) {
+                length += remaining;
+                remaining = 0;
+            }
+
+            if (length > 0) {
+                const size_t pixel_offset = frame.pixels.size();
+
+                frame.spans.push_back(
+                    {static_cast<uint16_t>(start), static_cast<uint16_t>(length), static_cast<uint32_t>(pixel_offset)});
+                frame.pixels.resize(pixel_offset + length);
+
+                uint8_t* const pixels = &frame.pixels[pixel_offset];
+
+                if (source.team_color) {
+                    memset(pixels, source.color_table[source.team_color], length);
+
+                } else {
+                    uint32_t position = static_cast<uint32_t>(start) * scaling_factor;
+
+                    for (int32_t i = 0; i < length; ++i) {
+                        const uint8_t color_index = row_address[position >> SpriteCache_ScaleBase];
+
+                        pixels[i] = source.color_table[source.color_indices[color_index]];
+                        position += scaling_factor;
+                    }
+                }
+            }
+        }
+    }
+
+    frame.row_spans.push_back(static_cast<uint32_t>(frame.spans.size()));
+}
+
+void SpriteCache_Blit(const SpriteCacheFrame& frame, int32_t offset_x, int32_t offset_y, int32_t width, int32_t height,
+                      uint8_t* target, int32_t pitch) noexcept {
+    const int32_t right = offset_x + width;
+
+    for (int32_t y = 0; y < height; ++y) {
+        const int32_t row = offset_y + y;
+        const uint32_t last_span = frame.row_spans[row + 1];
+
+        for (uint32_t i = frame.row_spans[row]; i < last_span; ++i) {
+            const SpriteCacheFrame::Span& span = frame.spans[i];
+            const int32_t first = std::max<int32_t>(span.x, offset_x);
+            const int32_t last = std::min<int32_t>(span.x + span.length, right);
+
+            if (first < last) {
+                memcpy(&target[first - offset_x], &frame.pixels[span.pixel_offset + (first - span.x)], last - first);
+            }
+        }
+
+        target = &target[pitch];
+    }
+}
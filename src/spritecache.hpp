@@ -0,0 +1,170 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SPRITECACHE_HPP
+#define SPRITECACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \struct SpriteCacheStatistics
+ * \brief Lookup counters of a sprite cache.
+ */
+struct SpriteCacheStatistics {
+    uint64_t hits{0};
+    uint64_t misses{0};
+    uint64_t evictions{0};
+    uint64_t invalidations{0};
+};
+
+/**
+ * \struct SpriteCacheSource
+ * \brief RLE encoded sprite frame and the parameters that determine its decoded pixels.
+ *
+ * The scaling factors are the 16.16 fixed point source pixels per scaled pixel that Gfx_DecodeSpriteSetup() derives
+ * from the frame size and the scaled size. The scaled size is the unclipped size of the frame at the current zoom.
+ */
+struct SpriteCacheSource {
+    const uint8_t* resource_buffer;
+    const uint32_t* row_offsets;
+    uint32_t scaling_factor_width;
+    uint32_t scaling_factor_height;
+    uint16_t scaled_width;
+    uint16_t scaled_height;
+    const uint8_t* color_indices;
+    const uint8_t* color_table;
+    uint8_t team_color;
+};
+
+/**
+ * \struct SpriteCacheFrame
+ * \brief Decoded sprite frame stored as runs of opaque pixels.
+ *
+ * The runs of row y are spans[row_spans[y]] to spans[row_spans[y + 1] - 1] in ascending x order.
+ */
+struct SpriteCacheFrame {
+    struct Span {
+        uint16_t x;
+        uint16_t length;
+        uint32_t pixel_offset;
+    };
+
+    uint16_t width;
+    uint16_t height;
+    std::vector<uint32_t> row_spans;
+    std::vector<Span> spans;
+    std::vector<uint8_t> pixels;
+
+    [[nodiscard]] inline size_t GetSize() const noexcept {
+        return sizeof(*this) + row_spans.size() * sizeof(uint32_t) + spans.size() * sizeof(Span) + pixels.size();
+    }
+};
+
+/**
+ * \class SpriteCache
+ * \brief LRU cache of unit sprite frames decoded at a zoom level, brightness and team color, bounded by memory use.
+ *
+ * Frames are identified by the address of their row table, so the cache must be invalidated whenever sprite resources
+ * are released or the color tables are regenerated in place. Palette cycling does not invalidate the cache as it
+ * rotates the RGB values of palette entries while the decoded frames store palette indices.
+ */
+class SpriteCache {
+    struct Key {
+        const uint32_t* row_offsets;
+        const uint8_t* color_indices;
+        const uint8_t* color_table;
+        uint16_t scaled_width;
+        uint16_t scaled_height;
+        uint8_t team_color;
+
+        bool operator==(const Key& other) const noexcept = default;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const noexcept;
+    };
+
+    struct Entry {
+        Key key;
+        SpriteCacheFrame frame;
+    };
+
+    size_t m_byte_budget;
+    size_t m_byte_count;
+
+    std::list<Entry> m_entries;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> m_lookup;
+
+    SpriteCacheStatistics m_statistics;
+
+public:
+    /**
+     * \brief Creates an empty cache.
+     *
+     * \param byte_budget Upper bound of the memory used for decoded frames. The most recent frame is always kept.
+     */
+    explicit SpriteCache(size_t byte_budget);
+
+    /**
+     * \brief Gets a decoded frame, decoding it on a miss.
+     *
+     * \param source Frame and decoding parameters.
+     * \return Decoded frame. The reference stays valid until the next call.
+     */
+    [[nodiscard]] const SpriteCacheFrame& GetFrame(const SpriteCacheSource& source);
+
+    /**
+     * \brief Drops all cached frames.
+     */
+    void Invalidate() noexcept;
+
+    [[nodiscard]] inline const SpriteCacheStatistics& GetStatistics() const noexcept { return m_statistics; }
+    [[nodiscard]] inline size_t GetByteCount() const noexcept { return m_byte_count; }
+    [[nodiscard]] inline size_t GetFrameCount() const noexcept { return m_entries.size(); }
+};
+
+/**
+ * \brief Decodes a whole RLE sprite frame with the fixed point scaling and color lookups of Gfx_DecodeSprite().
+ *
+ * \param source Frame and decoding parameters.
+ * \param frame Receives the decoded frame.
+ */
+void SpriteCache_DecodeFrame(const SpriteCacheSource& source, SpriteCacheFrame& frame);
+
+/**
+ * \brief Copies the opaque pixels of a clipped area of a decoded frame into a frame buffer.
+ *
+ * \param frame Decoded frame.
+ * \param offset_x Left edge of the area within the frame.
+ * \param offset_y Top edge of the area within the frame.
+ * \param width Width of the area.
+ * \param height Height of the area.
+ * \param target Frame buffer address of the top left pixel of the area.
+ * \param pitch Frame buffer row length in bytes.
+ */
+void SpriteCache_Blit(const SpriteCacheFrame& frame, int32_t offset_x, int32_t offset_y, int32_t width, int32_t height,
+                      uint8_t* target, int32_t pitch) noexcept;
+
+#endif /* SPRITECACHE_HPP */
@@ -22,8 +22,12 @@
 #include "svga.h"
 
 #include "cursor.hpp"
+#include "dirtyregion.hpp"
+#include "frameprofiler.hpp"
 #include "gnw.h"
 #include "input.h"
+#include "paletteregiontracker.hpp"
+#include "pixelconvert.hpp"
 #include "resource_manager.hpp"
 #include "settings.hpp"
 
@@ -31,6 +35,9 @@
 #define SVGA_DEFAULT_HEIGHT (480)
 #define SVGA_DEFAULT_REFRESH_RATE (30)
 
+/* every texture lock has a fixed cost, converting a few thousand needless pixels is cheaper */
+#define SVGA_DIRTY_REGION_MERGE_COST (64 * 64)
+
 static Uint32 Svga_SetupDisplayMode(SDL_Rect* bounds);
 static void Svga_CorrectAspectRatio(SDL_DisplayMode* display_mode);
 static void Svga_RefreshSystemPalette(bool force);
@@ -47,6 +54,12 @@ static uint64_t Svga_BackgroundTimer;
 static int32_t sdl_win_init_flag;
 static bool Svga_PaletteChanged;
 static bool Svga_RenderDirty;
+static bool Svga_ColorTableDirty;
+static uint32_t Svga_ColorTable[PALETTE_SIZE];
+static PaletteRegionTracker Svga_PaletteRegionTracker;
+static std::vector<PaletteRegion> Svga_PaletteRegions;
+static DirtyRegion Svga_DirtyRegion(SVGA_DIRTY_REGION_MERGE_COST);
+static SvgaBlitStatistics Svga_BlitStatistics;
 
 static int32_t Svga_ScreenWidth;
 static int32_t Svga_ScreenHeight;
@@ -238,6 +251,12 @@ int32_t Svga_Init(void) {
         SDL_Log("SDL_RenderPresent failed: %s\n", SDL_GetError());
     }
 
+    SDL_assert(SDL_BYTESPERPIXEL(Svga_DisplayPixelFormat) == sizeof(uint32_t));
+
+    Svga_ColorTableDirty = true;
+
+    Svga_PaletteRegionTracker.Resize(Svga_ScreenWidth, Svga_ScreenHeight);
+
     if (sdlWindowSurface && sdlTexture && sdlPaletteSurface) {
         sdl_win_init_flag = 1;
         Svga_BackgroundTimer = timer_get();
@@ -255,6 +274,8 @@ void Svga_Deinit(void) {
     if (sdl_win_init_flag) {
         remove_bk_process(Svga_BackgroundProcess);
 
+        Svga_DirtyRegion.Clear();
+
         if (sdlTexture) {
             SDL_DestroyTexture(sdlTexture);
             sdlTexture = nullptr;
@@ -291,6 +312,31 @@ static inline void svga_stage_index8_to_palette(uint8_t* srcBuf, uint32_t srcW,
     buf_to_buf(&srcBuf[subX + srcW * subY], subW, subH, srcW,
                &((uint8_t*)sdlPaletteSurface->pixels)[dstX + sdlPaletteSurface->pitch * dstY],
                sdlPaletteSurface->pitch);
+
+    Svga_PaletteRegionTracker.InvalidatePixels(dstX, dstY, subW, subH);
+}
+
+// Maps the palette to texture pixels for the single pass conversions. Rebuilt lazily after palette changes.
+static const uint32_t* svga_get_color_table(void) {
+    if (Svga_ColorTableDirty) {
+        const SDL_PixelFormatDetails* details = SDL_GetPixelFormatDetails(Svga_DisplayPixelFormat);
+        const SDL_Palette* palette = SDL_GetSurfacePalette(sdlPaletteSurface);
+
+        for (int32_t i = 0; i < PALETTE_SIZE; ++i) {
+            if (palette && i < palette->ncolors) {
+                const SDL_Color color = palette->colors[i];
+
+                Svga_ColorTable[i] = SDL_MapRGBA(details, nullptr, color.r, color.g, color.b, color.a);
+
+            } else {
+                Svga_ColorTable[i] = SDL_MapRGBA(details, nullptr, 0, 0, 0, SDL_ALPHA_OPAQUE);
+            }
+        }
+
+        Svga_ColorTableDirty = false;
+    }
+
+    return Svga_ColorTable;
 }
 
 // Stage 2: Convert palette surface to RGB surface. Bounds may be extended if palette changed.
@@ -304,13 +350,21 @@ static inline void svga_stage_palette_to_rgb(SDL_Rect* bounds) {
         bounds->h = sdlPaletteSurface->h;
     }
 
-    if (!SDL_BlitSurfaceUnchecked(sdlPaletteSurface, bounds, sdlWindowSurface, bounds)) {
-        SDL_Log("SDL_BlitSurface failed: %s\n", SDL_GetError());
-    }
+    const uint8_t* source_pixels =
+        &((uint8_t*)sdlPaletteSurface->pixels)[bounds->x + sdlPaletteSurface->pitch * bounds->y];
+    Uint32* target_pixels = &((Uint32*)sdlWindowSurface->pixels)[bounds->x + sdlWindowSurface->w * bounds->y];
+
+    PixelConvert_Index8ToRgb32(source_pixels, sdlPaletteSurface->pitch, target_pixels, sdlWindowSurface->pitch,
+                               bounds->w, bounds->h, svga_get_color_table());
 }
 
+static inline void svga_flush_dirty_region(void);
+
 // Stage 3: Copy RGB surface region to texture.
 static inline void svga_stage_rgb_to_texture(const SDL_Rect* bounds) {
+    // pending indexed blits must not overwrite the RGB frame later
+    svga_flush_dirty_region();
+
     if (SVGA_NO_TEXTURE_UPDATE) {
         Uint32* source_pixels = &((Uint32*)sdlWindowSurface->pixels)[bounds->x + sdlWindowSurface->w * bounds->y];
         void* target_pixels = nullptr;
@@ -338,6 +392,62 @@ static inline void svga_stage_rgb_to_texture(const SDL_Rect* bounds) {
     }
 }
 
+// Fused stages 2 and 3: Convert palette indices straight into the locked texture.
+static inline void svga_stage_index8_to_texture(const uint8_t* source, int32_t source_pitch, const SDL_Rect* bounds) {
+    if (bounds->w <= 0 || bounds->h <= 0) {
+        return;
+    }
+
+    void* target_pixels = nullptr;
+    int32_t target_pitch = 0;
+
+    if (SDL_LockTexture(sdlTexture, bounds, &target_pixels, &target_pitch)) {
+        PixelConvert_Index8ToRgb32(source, source_pitch, target_pixels, target_pitch, bounds->w, bounds->h,
+                                   svga_get_color_table());
+
+        SDL_UnlockTexture(sdlTexture);
+
+    } else {
+        SDL_Log("SDL_LockTexture failed: %s\n", SDL_GetError());
+    }
+}
+
+// Queues the screen regions that show palette entries changed since the last refresh, e.g. cycled water colors.
+static inline void svga_stage_palette_regions_to_dirty_region(void) {
+    const uint8_t* palette_pixels = static_cast<uint8_t*>(sdlPaletteSurface->pixels);
+
+    Svga_PaletteRegionTracker.CollectChangedRegions(palette_pixels, sdlPaletteSurface->pitch, Svga_PaletteRegions);
+
+    for (const auto& region : Svga_PaletteRegions) {
+        Svga_DirtyRegion.Add({region.x, region.y, region.x + region.width, region.y + region.height});
+    }
+}
+
+// Converts the merged screen regions blitted since the last flush from the palette surface into the texture, so that
+// overlapping blits of a frame, e.g. a window redrawn under the mouse cursor, are converted and uploaded only once.
+static inline void svga_flush_dirty_region(void) {
+    if (Svga_DirtyRegion.IsEmpty()) {
+        return;
+    }
+
+    const uint8_t* palette_pixels = static_cast<uint8_t*>(sdlPaletteSurface->pixels);
+
+    for (size_t i = 0; i < Svga_DirtyRegion.GetCount(); ++i) {
+        const Rect& rect = Svga_DirtyRegion[i];
+        const SDL_Rect bounds = {rect.ulx, rect.uly, rect.lrx - rect.ulx, rect.lry - rect.uly};
+
+        svga_stage_index8_to_texture(&palette_pixels[rect.ulx + sdlPaletteSurface->pitch * rect.uly],
+                                     sdlPaletteSurface->pitch, &bounds);
+    }
+
+    Svga_BlitStatistics.rect_count = Svga_DirtyRegion.GetCount();
+    Svga_BlitStatistics.requested_pixels = Svga_DirtyRegion.GetRequestedArea();
+    Svga_BlitStatistics.converted_pixels = Svga_DirtyRegion.GetArea();
+    Svga_BlitStatistics.screen_pixels = static_cast<uint64_t>(Svga_ScreenWidth) * Svga_ScreenHeight;
+
+    Svga_DirtyRegion.Clear();
+}
+
 // Stage 4: Mark render as dirty (actual rendering happens in BackgroundProcess).
 static inline void svga_stage_render(void) { Svga_RenderDirty = true; }
 
@@ -345,13 +455,18 @@ void Svga_Blit(uint8_t* srcBuf, uint32_t srcW, uint32_t srcH, uint32_t subX, uin
                uint32_t subH, uint32_t dstX, uint32_t dstY) {
     SDL_assert(sdlPaletteSurface && SDL_BYTESPERPIXEL(sdlPaletteSurface->format) == sizeof(uint8_t));
 
+    // the palette surface keeps the indexed frame for the deferred conversion, palette refreshes and screen captures
     svga_stage_index8_to_palette(srcBuf, srcW, srcH, subX, subY, subW, subH, dstX, dstY);
 
-    SDL_Rect bounds = {static_cast<int32_t>(dstX), static_cast<int32_t>(dstY), static_cast<int32_t>(subW),
-                       static_cast<int32_t>(subH)};
+    Svga_DirtyRegion.Add({static_cast<int32_t>(dstX), static_cast<int32_t>(dstY), static_cast<int32_t>(dstX + subW),
+                          static_cast<int32_t>(dstY + subH)});
+
+    if (Svga_PaletteChanged) {
+        Svga_PaletteChanged = false;
+
+        svga_stage_palette_regions_to_dirty_region();
+    }
 
-    svga_stage_palette_to_rgb(&bounds);
-    svga_stage_rgb_to_texture(&bounds);
     svga_stage_render();
 }
 
@@ -414,14 +529,26 @@ void Svga_BackgroundProcess(void) {
         Svga_BackgroundTimer = timer_get();
         Svga_RenderDirty = false;
 
-        // Ensure the current texture state is rendered before presenting
-        if (!SDL_RenderTexture(sdlRenderer, sdlTexture, nullptr, nullptr)) {
-            SDL_Log("SDL_RenderTexture failed: %s\n", SDL_GetError());
+        {
+            FRAME_PROFILER_SCOPE("SvgaFlush");
+
+            svga_flush_dirty_region();
         }
 
-        if (!SDL_RenderPresent(sdlRenderer)) {
-            SDL_Log("SDL_RenderPresent failed: %s\n", SDL_GetError());
+        {
+            FRAME_PROFILER_SCOPE("SvgaPresent");
+
+            // Ensure the current texture state is rendered before presenting
+            if (!SDL_RenderTexture(sdlRenderer, sdlTexture, nullptr, nullptr)) {
+                SDL_Log("SDL_RenderTexture failed: %s\n", SDL_GetError());
+            }
+
+            if (!SDL_RenderPresent(sdlRenderer)) {
+                SDL_Log("SDL_RenderPresent failed: %s\n", SDL_GetError());
+            }
         }
+
+        FrameProfiler_Get().MarkFrame(FrameProfiler::GetTime());
     }
 }
 
@@ -462,6 +589,9 @@ void Svga_SetPaletteColor(int32_t index, SDL_Color* color) {
         SDL_Log("SDL_SetPaletteColors failed: %s\n", SDL_GetError());
     }
 
+    Svga_ColorTableDirty = true;
+    Svga_PaletteRegionTracker.MarkColorChanged(index);
+
     Svga_RefreshSystemPalette(index == PALETTE_SIZE - 1);
 }
 
@@ -470,6 +600,9 @@ void Svga_SetPalette(SDL_Palette* palette) {
         SDL_Log("SDL_SetSurfacePalette failed: %s\n", SDL_GetError());
     }
 
+    Svga_ColorTableDirty = true;
+    Svga_PaletteRegionTracker.MarkAllColorsChanged();
+
     Svga_RefreshSystemPalette(true);
 }
 
@@ -481,6 +614,8 @@ int32_t Svga_GetScreenHeight(void) { return Svga_ScreenHeight; }
 
 int32_t Svga_GetScreenRefreshRate(void) { return Svga_DisplayRefreshRate; }
 
+void Svga_GetBlitStatistics(SvgaBlitStatistics* statistics) { *statistics = Svga_BlitStatistics; }
+
 bool Svga_IsFullscreen(void) { return (sdlWindow && (SDL_GetWindowFlags(sdlWindow) & (SDL_WINDOW_FULLSCREEN))); }
 
 bool Svga_GetWindowFlags(uint32_t* flags) {
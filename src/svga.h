@@ -35,6 +35,14 @@ extern "C" {
 typedef void (*ScreenBlitFunc)(uint8_t* srcBuf, uint32_t srcW, uint32_t srcH, uint32_t subX, uint32_t subY,
                                uint32_t subW, uint32_t subH, uint32_t dstX, uint32_t dstY);
 
+/* Pixels converted into the screen texture by the last flush of indexed blits. */
+typedef struct SvgaBlitStatistics_s {
+    uint64_t rect_count;
+    uint64_t requested_pixels;
+    uint64_t converted_pixels;
+    uint64_t screen_pixels;
+} SvgaBlitStatistics;
+
 extern Rect scr_size;
 extern ScreenBlitFunc scr_blit;
 
@@ -56,6 +64,7 @@ SDL_Palette* Svga_GetPalette(void);
 int32_t Svga_GetScreenWidth(void);
 int32_t Svga_GetScreenHeight(void);
 int32_t Svga_GetScreenRefreshRate(void);
+void Svga_GetBlitStatistics(SvgaBlitStatistics* statistics);
 bool Svga_IsFullscreen(void);
 bool Svga_GetWindowFlags(uint32_t* flags);
 SDL_Window* Svga_GetWindow(void);
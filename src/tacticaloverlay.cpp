@@ -24,14 +24,19 @@
 #include <SDL3/SDL.h>
 
 #include <algorithm>
+#include <fstream>
 
 #include "access.hpp"
 #include "ai.hpp"
 #include "aiplayer.hpp"
+#include "drawmap.hpp"
+#include "frameprofiler.hpp"
 #include "game_manager.hpp"
 #include "gfx.hpp"
+#include "grbuf.h"
 #include "hash.hpp"
 #include "resource_manager.hpp"
+#include "svga.h"
 #include "text.hpp"
 #include "units_manager.hpp"
 #include "window_manager.hpp"
@@ -41,6 +46,20 @@ static bool TacticalOverlay_Enabled = false;
 static int32_t TacticalOverlay_Mode = 1;
 static int32_t TacticalOverlay_SelectedTeam = -1;
 
+/* the frame profile graph draws one bar per recorded frame, the newest frame at the right edge */
+static constexpr int32_t TacticalOverlay_ProfileBarWidth = 2;
+static constexpr int32_t TacticalOverlay_ProfileWidth = FrameProfiler::FRAME_HISTORY * TacticalOverlay_ProfileBarWidth;
+static constexpr int32_t TacticalOverlay_ProfileGraphHeight = 64;
+static constexpr uint64_t TacticalOverlay_ProfileNsPerPixel = 500000;
+static constexpr uint64_t TacticalOverlay_ProfileFrameBudgetNs = 1000000000 / 60;
+
+/* the sections that took the most time are drawn in distinct colors, all others and untimed time are grouped */
+static constexpr uint8_t TacticalOverlay_ProfileColors[] = {COLOR_RED,    COLOR_GREEN,      COLOR_BLUE,
+                                                            COLOR_YELLOW, COLOR_RED_ORANGE, COLOR_CHROME_YELLOW};
+static constexpr uint8_t TacticalOverlay_ProfileOtherColor = COLOR_ROMAN_SILVER;
+static constexpr uint8_t TacticalOverlay_ProfileBudgetColor = COLOR_PASTEL_YELLOW;
+static constexpr int32_t TacticalOverlay_ProfileLegendLines = SDL_arraysize(TacticalOverlay_ProfileColors) + 2;
+
 void TacticalOverlay_Init() {
     TacticalOverlay_Enabled = false;
     TacticalOverlay_Mode = 1;
@@ -199,6 +218,59 @@ static bool TacticalOverlay_ShouldDisplayAsHex(int32_t mode) {
     return mode == 5;  // Surface type enum
 }
 
+static uint32_t TacticalOverlay_GetPercentage(uint64_t part, uint64_t whole) {
+    return whole ? static_cast<uint32_t>((part * 100 + whole / 2) / whole) : 0;
+}
+
+static void TacticalOverlay_RenderRedrawStatistics(WindowInfo* window) {
+    constexpr int32_t TEXT_MARGIN = 4;
+    constexpr int32_t TEXT_WIDTH = 320;
+
+    const DirtyRegion& region = DrawMap_GetDirtyRegion();
+    const uint64_t view_area =
+        static_cast<uint64_t>(GameManager_MapWindowDrawBounds.lrx - GameManager_MapWindowDrawBounds.ulx + 1) *
+        (GameManager_MapWindowDrawBounds.lry - GameManager_MapWindowDrawBounds.uly + 1);
+    const SpriteCacheStatistics& sprite_statistics = Gfx_GetSpriteCacheStatistics();
+    SvgaBlitStatistics statistics;
+    const TextRunCacheStatistics& text_statistics = Text_GetRunCacheStatistics();
+    char text[4][96];
+
+    Svga_GetBlitStatistics(&statistics);
+
+    // Map units scale to screen pixels the same in both directions, so the ratios are zoom independent
+    SDL_snprintf(text[0], sizeof(text[0]), "Map: %u rects, %u%% of view redrawn, %u%% requested",
+                 static_cast<uint32_t>(region.GetCount()), TacticalOverlay_GetPercentage(region.GetArea(), view_area),
+                 TacticalOverlay_GetPercentage(region.GetRequestedArea(), view_area));
+
+    SDL_snprintf(text[1], sizeof(text[1]), "Screen: %u rects, %u%% of pixels converted, %u%% requested",
+                 static_cast<uint32_t>(statistics.rect_count),
+                 TacticalOverlay_GetPercentage(statistics.converted_pixels, statistics.screen_pixels),
+                 TacticalOverlay_GetPercentage(statistics.requested_pixels, statistics.screen_pixels));
+
+    SDL_snprintf(text[2], sizeof(text[2]), "Sprites: %u KiB cached, %u%% of frames decoded from cache",
+                 static_cast<uint32_t>(Gfx_GetSpriteCacheByteCount() / 1024),
+                 TacticalOverlay_GetPercentage(sprite_statistics.hits,
+                                               sprite_statistics.hits + sprite_statistics.misses));
+
+    SDL_snprintf(text[3], sizeof(text[3]), "Text: %u KiB cached, %u%% of strings drawn from cache",
+                 static_cast<uint32_t>(Text_GetRunCacheByteCount() / 1024),
+                 TacticalOverlay_GetPercentage(text_statistics.hits, text_statistics.hits + text_statistics.misses));
+
+    const auto font_index = Text_GetFont();
+
+    Text_SetFont(GNW_TEXT_FONT_5);
+
+    const int32_t line_height = Text_GetHeight() + 1;
+    const int32_t width = std::min(TEXT_WIDTH, static_cast<int32_t>(window->width) - 2 * TEXT_MARGIN);
+
+    for (int32_t i = 0; i < static_cast<int32_t>(SDL_arraysize(text)); ++i) {
+        Text_TextBox(window->buffer, window->width, text[i], TEXT_MARGIN, TEXT_MARGIN + i * line_height, width,
+                     line_height, GNW_TEXT_OUTLINE | COLOR_YELLOW, false, false);
+    }
+
+    Text_SetFont(font_index);
+}
+
 void TacticalOverlay_Render() {
     if (!TacticalOverlay_Enabled) {
         return;
@@ -231,4 +303,184 @@ void TacticalOverlay_Render() {
             TacticalOverlay_RenderGridCellValue(window, grid_x, grid_y, text);
         }
     }
+
+    TacticalOverlay_RenderRedrawStatistics(window);
+}
+
+void TacticalOverlay_ToggleFrameProfile() {
+    FrameProfiler& profiler = FrameProfiler_Get();
+
+    profiler.SetEnabled(!profiler.IsEnabled());
+}
+
+bool TacticalOverlay_SaveFrameTrace() {
+    const auto filepath = (ResourceManager_FilePathGamePref / "frame_trace.json").lexically_normal();
+    std::ofstream file(filepath, std::ios::out | std::ios::trunc);
+
+    return file.is_open() && FrameProfiler_Get().WriteChromeTrace(file);
+}
+
+static Rect TacticalOverlay_GetFrameProfileArea(int32_t line_height) {
+    constexpr int32_t MARGIN = 4;
+
+    const int32_t window_width =
+        ((GameManager_MapWindowDrawBounds.lrx - GameManager_MapWindowDrawBounds.ulx) * GFX_SCALE_DENOMINATOR) /
+        Gfx_MapScalingFactor;
+    Rect area;
+
+    area.lrx = window_width - MARGIN;
+    area.ulx = std::max(0, area.lrx - TacticalOverlay_ProfileWidth);
+    area.uly = MARGIN;
+    area.lry = area.uly + TacticalOverlay_ProfileGraphHeight + TacticalOverlay_ProfileLegendLines * line_height + 2;
+
+    return area;
+}
+
+void TacticalOverlay_UpdateFrameProfileBounds() {
+    if (!FrameProfiler_Get().IsEnabled()) {
+        return;
+    }
+
+    const auto font_index = Text_GetFont();
+
+    Text_SetFont(GNW_TEXT_FONT_5);
+
+    const Rect area = TacticalOverlay_GetFrameProfileArea(Text_GetHeight() + 1);
+
+    Text_SetFont(font_index);
+
+    Rect bounds;
+
+    bounds.ulx = GameManager_MapWindowDrawBounds.ulx + (area.ulx * Gfx_MapScalingFactor) / GFX_SCALE_DENOMINATOR;
+    bounds.uly = GameManager_MapWindowDrawBounds.uly + (area.uly * Gfx_MapScalingFactor) / GFX_SCALE_DENOMINATOR;
+    bounds.lrx = GameManager_MapWindowDrawBounds.ulx +
+                 (area.lrx * Gfx_MapScalingFactor + GFX_SCALE_DENOMINATOR - 1) / GFX_SCALE_DENOMINATOR;
+    bounds.lry = GameManager_MapWindowDrawBounds.uly +
+                 (area.lry * Gfx_MapScalingFactor + GFX_SCALE_DENOMINATOR - 1) / GFX_SCALE_DENOMINATOR;
+
+    GameManager_AddDrawBounds(&bounds);
+}
+
+static int32_t TacticalOverlay_GetProfileBarHeight(uint64_t time_ns) {
+    return static_cast<int32_t>(std::min<uint64_t>(time_ns / TacticalOverlay_ProfileNsPerPixel,
+                                                   TacticalOverlay_ProfileGraphHeight));
+}
+
+static void TacticalOverlay_StackProfileBar(WindowInfo* window, const Rect& area, int32_t x, uint64_t* stacked_ns,
+                                            uint64_t time_ns, uint8_t color) {
+    const int32_t graph_lry = area.uly + TacticalOverlay_ProfileGraphHeight;
+    const int32_t bottom = graph_lry - TacticalOverlay_GetProfileBarHeight(*stacked_ns);
+
+    *stacked_ns += time_ns;
+
+    const int32_t top = graph_lry - TacticalOverlay_GetProfileBarHeight(*stacked_ns);
+
+    if (top < bottom && x >= area.ulx) {
+        buf_fill(&window->buffer[top * window->width + x], TacticalOverlay_ProfileBarWidth, bottom - top,
+                 window->width, color);
+    }
+}
+
+void TacticalOverlay_RenderFrameProfile() {
+    const FrameProfiler& profiler = FrameProfiler_Get();
+
+    if (!profiler.IsEnabled()) {
+        return;
+    }
+
+    WindowInfo* window = WindowManager_GetWindow(WINDOW_MAIN_MAP);
+    const uint32_t frame_count = profiler.GetFrameCount();
+    const uint32_t section_count = profiler.GetSectionCount();
+    uint64_t section_totals[FrameProfiler::MAX_SECTIONS]{};
+    uint32_t ranking[FrameProfiler::MAX_SECTIONS];
+    uint64_t frame_total = 0;
+    uint64_t frame_max = 0;
+
+    for (uint32_t age = 0; age < frame_count; ++age) {
+        const FrameProfiler::Frame& frame = profiler.GetFrame(age);
+
+        for (uint32_t section = 0; section < section_count; ++section) {
+            section_totals[section] += frame.section_ns[section];
+        }
+
+        frame_total += frame.duration_ns;
+        frame_max = std::max(frame_max, frame.duration_ns);
+    }
+
+    for (uint32_t section = 0; section < section_count; ++section) {
+        ranking[section] = section;
+    }
+
+    std::stable_sort(&ranking[0], &ranking[section_count], [&section_totals](uint32_t lhs, uint32_t rhs) {
+        return section_totals[lhs] > section_totals[rhs];
+    });
+
+    const uint32_t ranked_count =
+        std::min<uint32_t>(section_count, static_cast<uint32_t>(SDL_arraysize(TacticalOverlay_ProfileColors)));
+    const auto font_index = Text_GetFont();
+
+    Text_SetFont(GNW_TEXT_FONT_5);
+
+    const int32_t line_height = Text_GetHeight() + 1;
+    const Rect area = TacticalOverlay_GetFrameProfileArea(line_height);
+    const int32_t graph_lry = area.uly + TacticalOverlay_ProfileGraphHeight;
+
+    buf_fill(&window->buffer[area.uly * window->width + area.ulx], area.lrx - area.ulx, area.lry - area.uly,
+             window->width, COLOR_BLACK);
+
+    for (uint32_t age = 0; age < frame_count; ++age) {
+        const FrameProfiler::Frame& frame = profiler.GetFrame(age);
+        const int32_t x = area.lrx - static_cast<int32_t>(age + 1) * TacticalOverlay_ProfileBarWidth;
+        uint64_t stacked_ns = 0;
+
+        for (uint32_t rank = 0; rank < ranked_count; ++rank) {
+            TacticalOverlay_StackProfileBar(window, area, x, &stacked_ns, frame.section_ns[ranking[rank]],
+                                            TacticalOverlay_ProfileColors[rank]);
+        }
+
+        // the remaining sections and the time spent outside of any section
+        TacticalOverlay_StackProfileBar(window, area, x, &stacked_ns,
+                                        frame.duration_ns > stacked_ns ? frame.duration_ns - stacked_ns : 0,
+                                        TacticalOverlay_ProfileOtherColor);
+    }
+
+    const int32_t budget_y = graph_lry - TacticalOverlay_GetProfileBarHeight(TacticalOverlay_ProfileFrameBudgetNs);
+
+    draw_line(window->buffer, window->width, area.ulx, budget_y, area.lrx - 1, budget_y,
+              TacticalOverlay_ProfileBudgetColor);
+
+    const double frame_divisor = std::max<uint32_t>(frame_count, 1) * 1000000.;
+    const int32_t width = area.lrx - area.ulx - 4;
+    int32_t y = graph_lry + 2;
+    char text[96];
+
+    SDL_snprintf(text, sizeof(text), "Frame: %.2f ms avg, %.2f ms max, %u frames", frame_total / frame_divisor,
+                 frame_max / 1000000., frame_count);
+
+    Text_TextBox(window->buffer, window->width, text, area.ulx + 2, y, width, line_height,
+                 GNW_TEXT_OUTLINE | TacticalOverlay_ProfileBudgetColor, false, false);
+
+    uint64_t other_total = frame_total;
+
+    for (uint32_t rank = 0; rank < ranked_count; ++rank) {
+        const uint32_t section = ranking[rank];
+
+        other_total -= std::min(other_total, section_totals[section]);
+        y += line_height;
+
+        SDL_snprintf(text, sizeof(text), "%s: %.2f ms", profiler.GetSectionName(section).c_str(),
+                     section_totals[section] / frame_divisor);
+
+        Text_TextBox(window->buffer, window->width, text, area.ulx + 2, y, width, line_height,
+                     GNW_TEXT_OUTLINE | TacticalOverlay_ProfileColors[rank], false, false);
+    }
+
+    y += line_height;
+
+    SDL_snprintf(text, sizeof(text), "Other: %.2f ms", other_total / frame_divisor);
+
+    Text_TextBox(window->buffer, window->width, text, area.ulx + 2, y, width, line_height,
+                 GNW_TEXT_OUTLINE | TacticalOverlay_ProfileOtherColor, false, false);
+
+    Text_SetFont(font_index);
 }
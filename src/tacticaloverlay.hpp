@@ -63,8 +63,38 @@ void TacticalOverlay_CycleTeam();
  *
  * This function should be called during the game rendering loop after map tiles are drawn. It iterates over all
  * visible grid cells and renders the appropriate numeric value based on the current overlay mode. Text rendering
- * respects zoom level and automatically scales to fit within grid cell boundaries.
+ * respects zoom level and automatically scales to fit within grid cell boundaries. The top left corner shows the
+ * dirty region statistics of the frame, the map area redrawn versus requested and the screen pixels converted by the
+ * last SVGA flush, and the hit rate of the sprite cache.
  */
 void TacticalOverlay_Render();
 
+/**
+ * \brief Toggle the frame profiler and its graph on the main map window.
+ */
+void TacticalOverlay_ToggleFrameProfile();
+
+/**
+ * \brief Write the scopes recorded by the frame profiler to frame_trace.json in the preferences folder.
+ *
+ * \return True if the trace was written.
+ */
+bool TacticalOverlay_SaveFrameTrace();
+
+/**
+ * \brief Mark the map area covered by the frame profile graph for redraw so that the graph is updated every frame.
+ *
+ * This function should be called before the dirty map area is rendered.
+ */
+void TacticalOverlay_UpdateFrameProfileBounds();
+
+/**
+ * \brief Render the frame profile graph on the main map window.
+ *
+ * The top right corner shows the time per frame of the last recorded frames as stacked bars of the self time of the
+ * profiled sections, with a line at the 60 FPS frame budget, and a legend with the average time per frame of the
+ * sections that took the most time.
+ */
+void TacticalOverlay_RenderFrameProfile();
+
 #endif /* TACTICALOVERLAY_HPP */
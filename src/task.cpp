@@ -28,6 +28,7 @@
 #include "ailog.hpp"
 #include "aiplayer.hpp"
 #include "game_manager.hpp"
+#include "objectpool.hpp"
 #include "reminders.hpp"
 #include "settings.hpp"
 #include "task_manager.hpp"
@@ -384,6 +385,8 @@ Task::Task(const Task& other)
 
 Task::~Task() { --task_count; }
 
+OBJECTPOOL_DEFINE_ALLOCATOR(Task)
+
 void Task::RemindTurnEnd(bool priority) {
     if (!IsScheduledForTurnEnd()) {
         TaskManager.AppendReminder(new (std::nothrow) class RemindTurnEnd(*this), priority);
@@ -25,6 +25,7 @@
 #include <string>
 #include <string_view>
 
+#include "objectpool.hpp"
 #include "resource_manager.hpp"
 #include "smartobjectarray.hpp"
 #include "smartpointer.hpp"
@@ -233,6 +234,9 @@ public:
      */
     virtual ~Task();
 
+    /** Pooled allocation, every derived task type recycles blocks of its own size class. See ObjectPool. */
+    OBJECTPOOL_DECLARE_ALLOCATOR();
+
     /**
      * \brief Schedules this task to be processed at the end of the current turn.
      *
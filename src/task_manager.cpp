@@ -26,6 +26,7 @@
 #include "ailog.hpp"
 #include "aiplayer.hpp"
 #include "builder.hpp"
+#include "frameprofiler.hpp"
 #include "game_manager.hpp"
 #include "missionmanager.hpp"
 #include "reminders.hpp"
@@ -246,6 +247,8 @@ void TaskManager::AppendReminder(Reminder* reminder, bool priority) {
 }
 
 bool TaskManager::ExecuteReminders() {
+    FRAME_PROFILER_SCOPE("ExecuteReminders");
+
     bool result;
 
     if (normal_reminders.GetCount() + priority_reminders.GetCount() > 0) {
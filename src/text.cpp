@@ -25,16 +25,19 @@
 #include FT_FREETYPE_H
 
 #include <map>
+#include <vector>
 
 #include "point.hpp"
 #include "resource_manager.hpp"
 #include "sound_manager.hpp"
+#include "textruncache.hpp"
 
 #define TEXT_FONT_MANAGER_COUNT 10
 #define TEXT_FONT_META(id, height) {(id), (height)}
 #define TEXT_DEFAULT_GLYPH {nullptr, 0, 0, 0, 0, 0, 0}
 #define TEXT_GLYPH_METRICS_SCALE (64)
 #define TEXT_CACHE_ENTRIES (30)
+#define TEXT_RUN_CACHE_SIZE (1024 * 1024)
 
 typedef void (*text_font_func)(int32_t);
 
@@ -64,6 +67,8 @@ static int32_t Text_GetSizeTTF(const char* str);
 static bool Text_FitBounds(Rect* output, Rect* bounds1, Rect* bounds2);
 static bool Text_IsFitting(Rect* bounds1, Rect* bounds2);
 static inline struct FontGlyph& Text_GetGlyph(Uint32 key);
+static TextRunCache& Text_GetRunCache();
+static const TextRun* Text_GetRun(const char* str, int32_t swidth);
 static Uint32* Text_Utf8ToUcs4(const char* str);
 static uint32_t Text_GetHash(const char* str);
 static Uint32* Text_GetCachedString(const char* str, uint32_t& hash);
@@ -90,6 +95,7 @@ struct Font {
     int32_t max_height;
     SDL_iconv_t cd;
     std::map<Uint32, struct FontGlyph> glyphs;
+    std::vector<uint8_t> atlas;
 };
 
 struct TextCacheEntry {
@@ -182,8 +188,12 @@ void Text_Exit(void) {
         }
 
         Text_Fonts[i].glyphs.clear();
+        Text_Fonts[i].atlas.clear();
+        Text_Fonts[i].atlas.shrink_to_fit();
     }
 
+    Text_GetRunCache().Invalidate();
+
     for (auto& entry : Text_StringCache.entries) {
         delete[] entry.buffer;
         entry.buffer = nullptr;
@@ -224,8 +234,9 @@ void Text_LoadFontTTF(int32_t n, FT_Library library, struct Font& font) {
         return;
     }
 
+    // FreeType reads the font straight from the resource archive
     uint32_t file_size = ResourceManager_GetResourceSize(id);
-    uint8_t* file_base = ResourceManager_ReadResource(id);
+    const uint8_t* file_base = ResourceManager_GetResourceView(id);
 
     if (file_base) {
         if (FT_New_Memory_Face(library, file_base, file_size, 0, &font_face) == FT_Err_Ok) {
@@ -235,6 +246,7 @@ void Text_LoadFontTTF(int32_t n, FT_Library library, struct Font& font) {
                 FT_ULong char_code;
                 FT_UInt glyph_index;
                 const FT_Size_Metrics* metrics = &font_face->size->metrics;
+                std::vector<std::pair<FT_ULong, size_t>> atlas_offsets;
 
                 font.ascender =
                     (metrics->y_ppem * metrics->ascender) / (metrics->ascender + std::abs(metrics->descender));
@@ -256,12 +268,11 @@ void Text_LoadFontTTF(int32_t n, FT_Library library, struct Font& font) {
                             font_glyph.advance = slot->metrics.horiAdvance / TEXT_GLYPH_METRICS_SCALE;
 
                             font_glyph.pitch = slot->bitmap.pitch;
-                            font_glyph.buffer = new (std::nothrow) uint8_t[slot->bitmap.pitch * slot->bitmap.rows];
 
-                            if (font_glyph.buffer) {
-                                buf_to_buf(slot->bitmap.buffer, slot->bitmap.pitch, slot->bitmap.rows,
-                                           slot->bitmap.pitch, font_glyph.buffer, slot->bitmap.pitch);
-                            }
+                            // bitmaps are packed back to back, the pointers are set once the atlas stops growing
+                            atlas_offsets.push_back({char_code, font.atlas.size()});
+                            font.atlas.insert(font.atlas.end(), slot->bitmap.buffer,
+                                              &slot->bitmap.buffer[slot->bitmap.pitch * slot->bitmap.rows]);
 
                             font.max_width = std::max<int32_t>(font.max_width, font_glyph.width);
                             font.max_height = std::max<int32_t>(font.max_height, font_glyph.height);
@@ -273,6 +284,12 @@ void Text_LoadFontTTF(int32_t n, FT_Library library, struct Font& font) {
                     char_code = FT_Get_Next_Char(font_face, char_code, &glyph_index);
                 }
 
+                font.atlas.shrink_to_fit();
+
+                for (const auto& [code, offset] : atlas_offsets) {
+                    font.glyphs[code].buffer = &font.atlas[offset];
+                }
+
                 FT_Done_Face(font_face);
 
             } else {
@@ -288,8 +305,6 @@ void Text_LoadFontTTF(int32_t n, FT_Library library, struct Font& font) {
             font.glyphs.clear();
         }
 
-        delete[] file_base;
-
     } else {
         SDL_iconv_close(font.cd);
         font.cd = reinterpret_cast<SDL_iconv_t>(-1);
@@ -482,60 +497,60 @@ Uint32* Text_Utf8ToUcs4(const char* str) {
     return result;
 }
 
-void Text_BlitTTF(uint8_t* buf, const char* str, int32_t swidth, int32_t fullw, int32_t color) {
-    uint8_t* data;
-    uint8_t* bstart;
-    uint8_t* bnext;
+TextRunCache& Text_GetRunCache() {
+    static TextRunCache Text_RunCache(TEXT_RUN_CACHE_SIZE);
 
-    bstart = buf;
+    return Text_RunCache;
+}
 
-    if (color & GNW_TEXT_OUTLINE) {
-        color &= ~GNW_TEXT_OUTLINE;
-        Text_Blit(&buf[fullw + 1], str, swidth, fullw, (color & (~GNW_TEXT_COLOR_MASK)) | Color_RGB2Color(0));
-    }
+const TextRun* Text_GetRun(const char* str, int32_t swidth) {
+    TextRunCache& cache = Text_GetRunCache();
+    // fonts without glyphs keep the previous font active, so the key is the font that actually renders
+    const int32_t font = static_cast<int32_t>(Text_CurrentFont - Text_Fonts);
+    const TextRun* run = cache.Find(font, swidth, str);
 
-    Uint32* uni_str = Text_Utf8ToUcs4(str);
+    if (!run) {
+        Uint32* uni_str = Text_Utf8ToUcs4(str);
 
-    if (uni_str) {
-        for (Uint32* uni_str_pos = uni_str; *uni_str_pos; ++uni_str_pos) {
-            const struct FontGlyph& glyph = Text_GetGlyph(*uni_str_pos);
-            const int32_t offset = fullw * glyph.uly + glyph.ulx;
+        if (uni_str) {
+            std::vector<TextRunGlyph> glyphs;
+            TextRun rendered_run;
 
-            bnext = &buf[glyph.advance];
+            for (Uint32* uni_str_pos = uni_str; *uni_str_pos; ++uni_str_pos) {
+                const struct FontGlyph& glyph = Text_GetGlyph(*uni_str_pos);
 
-            if (glyph.width && glyph.height) {
-                if ((intptr_t)(bnext - bstart) > swidth) {
-                    break;
-                }
+                glyphs.push_back(
+                    {glyph.buffer, glyph.width, glyph.height, glyph.pitch, glyph.ulx, glyph.uly, glyph.advance});
+            }
 
-                for (int32_t h = 0; h < glyph.height; ++h) {
-                    uint8_t mask = 0x80;
-                    data = &glyph.buffer[glyph.pitch * h];
+            TextRun_Render(glyphs.data(), glyphs.size(), swidth, rendered_run);
 
-                    for (int32_t w = 0; w < glyph.width; ++w, ++buf) {
-                        if (!mask) {
-                            mask = 0x80;
-                            ++data;
-                        }
+            run = &cache.Insert(font, swidth, str, std::move(rendered_run));
+        }
+    }
 
-                        if (mask & *data) {
-                            buf[offset] = color;
-                        }
+    return run;
+}
 
-                        mask >>= 1;
-                    }
+void Text_BlitTTF(uint8_t* buf, const char* str, int32_t swidth, int32_t fullw, int32_t color) {
+    int32_t width = 0;
 
-                    buf += fullw - glyph.width;
-                }
-            }
+    if (color & GNW_TEXT_OUTLINE) {
+        color &= ~GNW_TEXT_OUTLINE;
+        Text_Blit(&buf[fullw + 1], str, swidth, fullw, (color & (~GNW_TEXT_COLOR_MASK)) | Color_RGB2Color(0));
+    }
 
-            buf = bnext;
-        }
+    // the run holds coverage only, so the outline pass above and every text color share one cached rendering
+    const TextRun* run = Text_GetRun(str, swidth);
+
+    if (run) {
+        TextRun_Blit(*run, buf, fullw, static_cast<uint8_t>(color));
+
+        width = run->advance;
     }
 
     if (color & GNW_TEXT_UNDERLINE) {
-        const int32_t width = buf - bstart;
-        buf = &bstart[fullw * (Text_GetHeight() - 1)];
+        buf = &buf[fullw * (Text_GetHeight() - 1)];
 
         for (int32_t i = 0; i < width; i++) {
             buf[i] = color;
@@ -543,6 +558,10 @@ void Text_BlitTTF(uint8_t* buf, const char* str, int32_t swidth, int32_t fullw,
     }
 }
 
+const TextRunCacheStatistics& Text_GetRunCacheStatistics() { return Text_GetRunCache().GetStatistics(); }
+
+size_t Text_GetRunCacheByteCount() { return Text_GetRunCache().GetByteCount(); }
+
 int32_t Text_GetHeightTTF(void) { return Text_CurrentFont->max_height; }
 
 int32_t Text_GetWidthTTF(const char* str) {
@@ -25,6 +25,7 @@
 #include "fonts.hpp"
 #include "gnw.h"
 #include "smartstring.hpp"
+#include "textruncache.hpp"
 
 extern uint32_t Text_TypeWriter_CharacterTimeMs;
 extern uint32_t Text_TypeWriter_BeepTimeMs;
@@ -49,6 +50,9 @@ void Text_TypeWriter_TextBoxMultiLineWrapText(WindowInfo* window, const char* te
 void Text_AutofitTextBox(uint8_t* buffer, uint16_t pitch, const char* text, Rect* text_area, Rect* draw_area,
                          int32_t color, bool horizontal_align);
 
+const TextRunCacheStatistics& Text_GetRunCacheStatistics();
+size_t Text_GetRunCacheByteCount();
+
 /**
  * \brief Appends UTF-8 text to a bounded buffer without splitting a code point.
  *
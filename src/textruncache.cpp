@@ -0,0 +1,174 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "textruncache.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+static uint64_t TextRunCache_GetHash(int32_t font, int32_t width_limit, std::string_view text) noexcept {
+    // 64 bit FNV-1a
+    uint64_t hash = 0xCBF29CE484222325ull;
+
+    const auto mix = [&hash](uint8_t byte) {
+        hash ^= byte;
+        hash *= 0x100000001B3ull;
+    };
+
+    for (int32_t i = 0; i < 4; ++i) {
+        mix(static_cast<uint8_t>(font >> (8 * i)));
+        mix(static_cast<uint8_t>(width_limit >> (8 * i)));
+    }
+
+    for (const char c : text) {
+        mix(static_cast<uint8_t>(c));
+    }
+
+    return hash;
+}
+
+static inline size_t TextRunCache_GetEntrySize(const TextRun& run, std::string_view text) noexcept {
+    return run.GetSize() + text.size();
+}
+
+TextRunCache::TextRunCache(size_t byte_budget) : m_byte_budget(byte_budget), m_byte_count(0) {}
+
+void TextRunCache::Evict(std::list<Entry>::iterator entry) noexcept {
+    m_byte_count -= TextRunCache_GetEntrySize(entry->run, entry->text);
+    m_lookup.erase(entry->hash);
+    m_entries.erase(entry);
+
+    ++m_statistics.evictions;
+}
+
+const TextRun* TextRunCache::Find(int32_t font, int32_t width_limit, std::string_view text) {
+    const auto it = m_lookup.find(TextRunCache_GetHash(font, width_limit, text));
+
+    // a hash collision counts as a miss, the following insert replaces the colliding entry
+    if (it != m_lookup.end() && it->second->font == font && it->second->width_limit == width_limit &&
+        it->second->text == text) {
+        ++m_statistics.hits;
+
+        if (it->second != m_entries.begin()) {
+            m_entries.splice(m_entries.begin(), m_entries, it->second);
+        }
+
+        return &it->second->run;
+    }
+
+    ++m_statistics.misses;
+
+    return nullptr;
+}
+
+const TextRun& TextRunCache::Insert(int32_t font, int32_t width_limit, std::string_view text, TextRun&& run) {
+    const uint64_t hash = TextRunCache_GetHash(font, width_limit, text);
+    const auto it = m_lookup.find(hash);
+
+    if (it != m_lookup.end()) {
+        Evict(it->second);
+    }
+
+    m_entries.push_front({hash, font, width_limit, std::string(text), std::move(run)});
+    m_lookup.emplace(hash, m_entries.begin());
+    m_byte_count += TextRunCache_GetEntrySize(m_entries.front().run, text);
+
+    while (m_byte_count > m_byte_budget && m_entries.size() > 1) {
+        Evict(std::prev(m_entries.end()));
+    }
+
+    return m_entries.front().run;
+}
+
+void TextRunCache::Invalidate() noexcept {
+    m_lookup.clear();
+    m_entries.clear();
+    m_byte_count = 0;
+
+    ++m_statistics.invalidations;
+}
+
+void TextRun_Render(const TextRunGlyph* glyphs, size_t glyph_count, int32_t width_limit, TextRun& run) {
+    struct Pixel {
+        int16_t y;
+        int16_t x;
+
+        bool operator<(const Pixel& other) const noexcept { return y != other.y ? y < other.y : x < other.x; }
+        bool operator==(const Pixel& other) const noexcept = default;
+    };
+
+    std::vector<Pixel> pixels;
+    int32_t pen = 0;
+
+    run.spans.clear();
+
+    for (size_t i = 0; i < glyph_count; ++i) {
+        const TextRunGlyph& glyph = glyphs[i];
+        const int32_t next_pen = pen + glyph.advance;
+
+        if (glyph.width && glyph.height) {
+            if (next_pen > width_limit) {
+                break;
+            }
+
+            for (int32_t y = 0; y < glyph.height; ++y) {
+                const uint8_t* const row = &glyph.bitmap[glyph.pitch * y];
+
+                for (int32_t x = 0; x < glyph.width; ++x) {
+                    if (row[x >> 3] & (0x80 >> (x & 7))) {
+                        pixels.push_back(
+                            {static_cast<int16_t>(glyph.uly + y), static_cast<int16_t>(pen + glyph.ulx + x)});
+                    }
+                }
+            }
+        }
+
+        pen = next_pen;
+    }
+
+    run.advance = pen;
+
+    // overlapping glyphs set the same pixel twice
+    std::sort(pixels.begin(), pixels.end());
+    pixels.erase(std::unique(pixels.begin(), pixels.end()), pixels.end());
+
+    for (const Pixel& pixel : pixels) {
+        if (!run.spans.empty()) {
+            TextRun::Span& span = run.spans.back();
+
+            if (span.y == pixel.y && span.x + span.length == pixel.x) {
+                ++span.length;
+
+                continue;
+            }
+        }
+
+        run.spans.push_back({pixel.x, pixel.y, 1});
+    }
+
+    run.spans.shrink_to_fit();
+}
+
+void TextRun_Blit(const TextRun& run, uint8_t* target, int32_t pitch, uint8_t color) noexcept {
+    for (const TextRun::Span& span : run.spans) {
+        memset(&target[span.y * pitch + span.x], color, span.length);
+    }
+}
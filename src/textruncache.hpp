@@ -0,0 +1,163 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef TEXTRUNCACHE_HPP
+#define TEXTRUNCACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \struct TextRunCacheStatistics
+ * \brief Lookup counters of a text run cache.
+ */
+struct TextRunCacheStatistics {
+    uint64_t hits{0};
+    uint64_t misses{0};
+    uint64_t evictions{0};
+    uint64_t invalidations{0};
+};
+
+/**
+ * \struct TextRunGlyph
+ * \brief Monochrome glyph bitmap and metrics in pixels, rows stored most significant bit first.
+ */
+struct TextRunGlyph {
+    const uint8_t* bitmap;
+    uint16_t width;
+    uint16_t height;
+    int16_t pitch;
+    int16_t ulx;
+    int16_t uly;
+    int16_t advance;
+};
+
+/**
+ * \struct TextRun
+ * \brief Rendered string stored as horizontal spans of set pixels relative to the pen origin, in row major order.
+ *
+ * A run holds coverage only, the text color is applied when it is blitted, so every color and the outline pass of a
+ * string share one run.
+ */
+struct TextRun {
+    struct Span {
+        int16_t x;
+        int16_t y;
+        uint16_t length;
+    };
+
+    int32_t advance{0};
+    std::vector<Span> spans;
+
+    [[nodiscard]] inline size_t GetSize() const noexcept { return sizeof(*this) + spans.size() * sizeof(Span); }
+};
+
+/**
+ * \class TextRunCache
+ * \brief LRU cache of rendered strings keyed by font, width limit and text, bounded by memory use.
+ */
+class TextRunCache {
+    struct Entry {
+        uint64_t hash;
+        int32_t font;
+        int32_t width_limit;
+        std::string text;
+        TextRun run;
+    };
+
+    size_t m_byte_budget;
+    size_t m_byte_count;
+
+    std::list<Entry> m_entries;
+    std::unordered_map<uint64_t, std::list<Entry>::iterator> m_lookup;
+
+    TextRunCacheStatistics m_statistics;
+
+    void Evict(std::list<Entry>::iterator entry) noexcept;
+
+public:
+    /**
+     * \brief Creates an empty cache.
+     *
+     * \param byte_budget Upper bound of the memory used for runs and their keys. The most recent run is always kept.
+     */
+    explicit TextRunCache(size_t byte_budget);
+
+    /**
+     * \brief Looks up a rendered string and counts a hit or a miss.
+     *
+     * \param font Font index.
+     * \param width_limit Width available to the string in pixels.
+     * \param text UTF-8 string.
+     * \return Cached run or nullptr. The pointer stays valid until the next Insert() or Invalidate().
+     */
+    [[nodiscard]] const TextRun* Find(int32_t font, int32_t width_limit, std::string_view text);
+
+    /**
+     * \brief Stores a rendered string, usually right after Find() missed.
+     *
+     * \param font Font index.
+     * \param width_limit Width available to the string in pixels.
+     * \param text UTF-8 string.
+     * \param run Rendered string.
+     * \return Stored run. The reference stays valid until the next Insert() or Invalidate().
+     */
+    const TextRun& Insert(int32_t font, int32_t width_limit, std::string_view text, TextRun&& run);
+
+    /**
+     * \brief Drops all cached runs, for example when fonts are reloaded.
+     */
+    void Invalidate() noexcept;
+
+    [[nodiscard]] inline const TextRunCacheStatistics& GetStatistics() const noexcept { return m_statistics; }
+    [[nodiscard]] inline size_t GetByteCount() const noexcept { return m_byte_count; }
+    [[nodiscard]] inline size_t GetRunCount() const noexcept { return m_entries.size(); }
+};
+
+/**
+ * \brief Renders a string with the pen stepping and width limit of Text_BlitTTF().
+ *
+ * Glyphs are drawn from left to right. Drawing stops before the first visible glyph whose advance would cross the
+ * width limit.
+ *
+ * \param glyphs Glyphs of the string in order.
+ * \param glyph_count Number of glyphs.
+ * \param width_limit Width available to the string in pixels.
+ * \param run Receives the rendered string.
+ */
+void TextRun_Render(const TextRunGlyph* glyphs, size_t glyph_count, int32_t width_limit, TextRun& run);
+
+/**
+ * \brief Fills the set pixels of a run with a color.
+ *
+ * \param run Rendered string.
+ * \param target Frame buffer address of the pen origin.
+ * \param pitch Frame buffer row length in bytes.
+ * \param color Palette index.
+ */
+void TextRun_Blit(const TextRun& run, uint8_t* target, int32_t pitch, uint8_t color) noexcept;
+
+#endif /* TEXTRUNCACHE_HPP */
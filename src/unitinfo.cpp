@@ -35,6 +35,7 @@
 #include "hash.hpp"
 #include "message_manager.hpp"
 #include "mouseevent.hpp"
+#include "objectpool.hpp"
 #include "paths_manager.hpp"
 #include "randomizer.hpp"
 #include "registerarray.hpp"
@@ -412,6 +413,8 @@ UnitInfo::UnitInfo(const UnitInfo& other)
 
 UnitInfo::~UnitInfo() { delete[] name; }
 
+OBJECTPOOL_DEFINE_ALLOCATOR(UnitInfo)
+
 FileObject* UnitInfo::Allocate() noexcept { return new (std::nothrow) UnitInfo(); }
 
 static uint32_t UnitInfo_TypeIndex;
@@ -1798,8 +1801,7 @@ void UnitInfo::Move() {
                 path_steps[path_step_index]->y -= offset_y;
             }
 
-            Access_UpdateMapStatus(this, true);
-            Access_UpdateMapStatus(&*unit, false);
+            Access_UpdateMapStatusMove(this, &*unit);
         }
 
         if (visible_to_team[GameManager_PlayerTeam]) {
@@ -3980,8 +3982,7 @@ void UnitInfo::StepMoveUnit(Point position) {
 
                     Redraw();
 
-                    Access_UpdateMapStatus(this, true);
-                    Access_UpdateMapStatus(&*unit_copy, false);
+                    Access_UpdateMapStatusMove(this, &*unit_copy);
 
                     if (orders == ORDER_MOVE || orders == ORDER_MOVE_TO_UNIT || orders == ORDER_MOVE_TO_ATTACK) {
                         BlockedOnPathRequest();
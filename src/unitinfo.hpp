@@ -26,6 +26,7 @@
 
 #include "button.hpp"
 #include "complex.hpp"
+#include "objectpool.hpp"
 #include "paths.hpp"
 #include "point.hpp"
 #include "smartlist.hpp"
@@ -118,6 +119,9 @@ public:
     /** Destructor. */
     ~UnitInfo();
 
+    /** Pooled allocation, see ObjectPool. */
+    OBJECTPOOL_DECLARE_ALLOCATOR();
+
     /**
      * Get UTF-8 encoded null terminated name of unit without mark segment.
      *
@@ -287,7 +287,7 @@ void UnitInfoGroup::RenderLists() {
     }
 }
 
-void UnitInfoGroup::ProcessDirtyZone(Rect* bounds) {
+void UnitInfoGroup::ProcessDirtyZone(const Rect* bounds) {
     bounds1 = *bounds;
 
     bounds2.ulx = ((bounds1.ulx << 16) / Gfx_MapScalingFactor) - Gfx_MapWindowUlx;
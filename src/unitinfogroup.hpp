@@ -69,7 +69,7 @@ public:
     Rect* GetBounds1();
     Rect* GetBounds2();
 
-    void ProcessDirtyZone(Rect* bounds);
+    void ProcessDirtyZone(const Rect* bounds);
 };
 
 #endif /* UNITINFOGROUP_HPP */
@@ -21,6 +21,7 @@
 
 #include "unitpath.hpp"
 
+#include "objectpool.hpp"
 #include "unitinfo.hpp"
 
 UnitPath::UnitPath() : m_end_x(0), m_end_y(0), m_distance_x(0), m_distance_y(0), m_euclidean_distance(0) {}
@@ -38,6 +39,8 @@ UnitPath::UnitPath(int32_t distance_x, int32_t distance_y, int32_t euclidean_dis
 
 UnitPath::~UnitPath() {}
 
+OBJECTPOOL_DEFINE_ALLOCATOR(UnitPath)
+
 Point UnitPath::GetPosition(UnitInfo* unit) const { return Point(unit->grid_x, unit->grid_y); }
 
 bool UnitPath::IsInPath(int32_t grid_x, int32_t grid_y) const { return false; }
@@ -23,6 +23,7 @@
 #define UNITPATH_HPP
 
 #include "gnw.h"
+#include "objectpool.hpp"
 #include "point.hpp"
 #include "smartfile.hpp"
 
@@ -43,6 +44,9 @@ public:
     UnitPath(int32_t distance_x, int32_t distance_y, int32_t euclidean_distance, int32_t target_x, int32_t target_y);
     virtual ~UnitPath();
 
+    /** Pooled allocation, see ObjectPool. */
+    OBJECTPOOL_DECLARE_ALLOCATOR();
+
     virtual uint32_t GetTypeIndex() const = 0;
     virtual void FileLoad(SmartFileReader& file) noexcept = 0;
     virtual void FileSave(SmartFileWriter& file) noexcept = 0;
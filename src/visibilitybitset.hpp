@@ -0,0 +1,91 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef VISIBILITYBITSET_HPP
+#define VISIBILITYBITSET_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * \class VisibilityBitset
+ * \brief One bit per map cell telling whether a heat map layer covers the cell.
+ *
+ * The bitset mirrors the zero or non-zero state of a heat map counter layer. Cells are stored in map order, cell index
+ * = grid_y * width + grid_x, packed into 64 bit words so that whole rows of the map can be read a word at a time. Bits
+ * past the last cell of the last word are always zero.
+ */
+class VisibilityBitset {
+public:
+    using Word = uint64_t;
+
+    static constexpr size_t WORD_BITS = sizeof(Word) * 8;
+
+    VisibilityBitset() = default;
+    explicit VisibilityBitset(const size_t cell_count) { Resize(cell_count); }
+
+    /**
+     * \brief Resizes the bitset and clears all bits.
+     *
+     * \param cell_count Number of map cells to track.
+     */
+    inline void Resize(const size_t cell_count) {
+        m_cell_count = cell_count;
+        m_words.assign((cell_count + WORD_BITS - 1) / WORD_BITS, 0);
+    }
+
+    inline void Clear() noexcept { std::fill(m_words.begin(), m_words.end(), 0); }
+
+    inline void Set(const size_t index) noexcept { m_words[index / WORD_BITS] |= Word{1} << (index % WORD_BITS); }
+    inline void Reset(const size_t index) noexcept { m_words[index / WORD_BITS] &= ~(Word{1} << (index % WORD_BITS)); }
+
+    [[nodiscard]] inline bool Test(const size_t index) const noexcept {
+        return (m_words[index / WORD_BITS] >> (index % WORD_BITS)) & 1;
+    }
+
+    /**
+     * \brief Counts the set bits.
+     *
+     * \return Number of covered cells.
+     */
+    [[nodiscard]] inline size_t Count() const noexcept {
+        size_t count = 0;
+
+        for (const Word word : m_words) {
+            count += static_cast<size_t>(std::popcount(word));
+        }
+
+        return count;
+    }
+
+    [[nodiscard]] inline size_t GetCellCount() const noexcept { return m_cell_count; }
+    [[nodiscard]] inline size_t GetWordCount() const noexcept { return m_words.size(); }
+    [[nodiscard]] inline const Word* GetWords() const noexcept { return m_words.data(); }
+
+private:
+    size_t m_cell_count{0};
+    std::vector<Word> m_words;
+};
+
+#endif /* VISIBILITYBITSET_HPP */
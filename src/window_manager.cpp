@@ -31,10 +31,10 @@
 
 #define WINDOW_ITEM(rect, unknown, id, buffer, name) {rect, unknown, id, buffer}
 
-static void WindowManager_SwapSystemPalette(ImageBigHeader* image);
+static void WindowManager_SwapSystemPalette(const ImageBigHeader* image);
 static void WindowManager_ScaleWindows();
-static bool WindowManager_CustomSpriteScaler(ResourceID id, ImageBigHeader* image, WindowInfo* window, int32_t ulx,
-                                             int32_t uly);
+static bool WindowManager_CustomSpriteScaler(ResourceID id, const ImageBigHeader* image, WindowInfo* window,
+                                             int32_t ulx, int32_t uly);
 static void WindowManager_ResizeSimpleImage(ResourceID id, double scale);
 static void WindowManager_ScaleWindow(int32_t wid, double scale);
 static void WindowManager_ScaleButtonResource(ResourceID id, double scale);
@@ -452,7 +452,7 @@ void WindowManager_ScaleWindows() {
     }
 }
 
-bool WindowManager_CustomSpriteScaler(ResourceID id, ImageBigHeader* image, WindowInfo* window, int32_t ulx,
+bool WindowManager_CustomSpriteScaler(ResourceID id, const ImageBigHeader* image, WindowInfo* window, int32_t ulx,
                                       int32_t uly) {
     bool result = false;
 
@@ -581,7 +581,7 @@ void WindowManager_FadeIn(int32_t time_limit) {
     Color_FadeSystemPalette(WindowManager_SystemPalette, Color_GetColorPalette(), time_limit);
 }
 
-void WindowManager_SwapSystemPalette(ImageBigHeader* image) {
+void WindowManager_SwapSystemPalette(const ImageBigHeader* image) {
     uint8_t* palette;
 
     WindowManager_ClearWindow();
@@ -599,24 +599,20 @@ void WindowManager_SwapSystemPalette(ImageBigHeader* image) {
 }
 
 void WindowManager_LoadPalette(ResourceID id) {
-    uint8_t* resource;
-    ImageBigHeader* image;
+    const ImageBigHeader* image;
 
-    resource = ResourceManager_ReadResource(id);
-    image = reinterpret_cast<ImageBigHeader*>(resource);
+    image = reinterpret_cast<const ImageBigHeader*>(ResourceManager_GetResourceView(id));
 
     if (image) {
         WindowManager_SwapSystemPalette(image);
     }
-
-    delete[] resource;
 }
 
-void WindowManager_DecodeBigImage(struct ImageBigHeader* image, uint8_t* buffer, int32_t ulx, int32_t uly,
+void WindowManager_DecodeBigImage(const struct ImageBigHeader* image, uint8_t* buffer, int32_t ulx, int32_t uly,
                                   int32_t pitch) {
     int32_t image_height;
     int32_t image_width;
-    uint8_t* image_data;
+    const uint8_t* image_data;
     int32_t buffer_position;
 
     image_width = image->width;
@@ -631,7 +627,7 @@ void WindowManager_DecodeBigImage(struct ImageBigHeader* image, uint8_t* buffer,
         int16_t opt_word;
 
         for (int32_t line_position = 0; line_position < image_width; line_position += opt_word) {
-            opt_word = *reinterpret_cast<int16_t*>(image_data);
+            opt_word = *reinterpret_cast<const int16_t*>(image_data);
             image_data += sizeof(opt_word);
 
             if (opt_word > 0) {
@@ -658,15 +654,14 @@ void WindowManager_DecodeBigImage(struct ImageBigHeader* image, uint8_t* buffer,
 
 int32_t WindowManager_LoadBigImage(ResourceID id, WindowInfo* window, int32_t pitch, bool palette_from_image,
                                    bool draw_to_screen, int32_t ulx, int32_t uly, bool center_align, bool rescale) {
-    uint8_t* resource;
-    ImageBigHeader* image;
+    const ImageBigHeader* image;
     int32_t width = WindowManager_GetWidth(window);
     int32_t height = WindowManager_GetHeight(window);
 
     process_bk();
 
-    resource = ResourceManager_ReadResource(id);
-    image = reinterpret_cast<ImageBigHeader*>(resource);
+    // the image is decoded straight from the resource archive
+    image = reinterpret_cast<const ImageBigHeader*>(ResourceManager_GetResourceView(id));
 
     if (!image) {
         return 0;
@@ -747,8 +742,6 @@ int32_t WindowManager_LoadBigImage(ResourceID id, WindowInfo* window, int32_t pi
         win_draw(window->id);
     }
 
-    delete[] resource;
-
     return 1;
 }
 
@@ -104,7 +104,7 @@ void WindowManager_ClearWindow();
 void WindowManager_FadeOut(int32_t time_limit);
 void WindowManager_FadeIn(int32_t time_limit);
 void WindowManager_LoadPalette(ResourceID id);
-void WindowManager_DecodeBigImage(struct ImageBigHeader* image, uint8_t* buffer, int32_t ulx, int32_t uly,
+void WindowManager_DecodeBigImage(const struct ImageBigHeader* image, uint8_t* buffer, int32_t ulx, int32_t uly,
                                   int32_t pitch);
 int32_t WindowManager_LoadBigImage(ResourceID id, WindowInfo* window, int32_t pitch, bool palette_from_image,
                                    bool draw_to_screen = true, int32_t ulx = -1, int32_t uly = -1,
@@ -31,6 +31,9 @@
 #include "timer.h"
 #include "window_manager.hpp"
 
+// 32 tiles of 64 x 64 pixels, 128 KiB per read, so that the load bar advances in small steps on large tile sets
+static constexpr int32_t WORLD_TILE_CHUNK_SIZE = 32;
+
 World::World(ResourceID resource_id)
     : m_resource_id(resource_id),
       m_is_fully_loaded(false),
@@ -164,6 +167,10 @@ bool World::LoadFullMap(DrawLoadBar* load_bar) {
     ApplyBugFixes();
     InitColorCycles();
 
+    // tiles and brightness tables are regenerated in place
+    Gfx_InvalidateMapTileCache();
+    Gfx_InvalidateSpriteCache();
+
     m_is_fully_loaded = true;
 
     load_bar->SetValue(100);
@@ -182,6 +189,8 @@ void World::UnloadFullMap() {
     m_cargo_map.reset();
     m_color_cycles.clear();
 
+    Gfx_InvalidateMapTileCache();
+
     m_is_fully_loaded = false;
 }
 
@@ -430,12 +439,12 @@ bool World::LoadTilesAndMetadata(FILE* fp, DrawLoadBar* load_bar) {
 
 bool World::LoadMapTiles(FILE* fp, DrawLoadBar* load_bar) {
     int32_t tile_size{GFX_MAP_TILE_SIZE};
-    int32_t tile_count_stride{(m_tile_count + 7) / 8};
+    int32_t progress_bar_value{-1};
     uint8_t* tile_data_chunk{nullptr};
 
     if (ResourceManager_DisableEnhancedGraphics) {
         tile_size /= 2;
-        tile_data_chunk = new (std::nothrow) uint8_t[tile_count_stride * GFX_MAP_TILE_SIZE * GFX_MAP_TILE_SIZE];
+        tile_data_chunk = new (std::nothrow) uint8_t[WORLD_TILE_CHUNK_SIZE * GFX_MAP_TILE_SIZE * GFX_MAP_TILE_SIZE];
     }
 
     m_tile_buffer = std::make_unique<uint8_t[]>(m_tile_count * tile_size * tile_size);
@@ -445,14 +454,20 @@ bool World::LoadMapTiles(FILE* fp, DrawLoadBar* load_bar) {
         return false;
     }
 
-    for (int32_t i = 0; i < m_tile_count; i += tile_count_stride) {
-        load_bar->SetValue(i * 50 / m_tile_count + 20);
+    for (int32_t i = 0; i < m_tile_count; i += WORLD_TILE_CHUNK_SIZE) {
+        const int32_t value = i * 50 / m_tile_count + 20;
+
+        // every load bar update redraws the screen, skip chunks that do not advance it
+        if (value != progress_bar_value) {
+            progress_bar_value = value;
+            load_bar->SetValue(value);
+        }
 
         if (!ResourceManager_DisableEnhancedGraphics) {
             tile_data_chunk = &m_tile_buffer[i * GFX_MAP_TILE_SIZE * GFX_MAP_TILE_SIZE];
         }
 
-        const int32_t tile_count = std::min(tile_count_stride, m_tile_count - i);
+        const int32_t tile_count = std::min(WORLD_TILE_CHUNK_SIZE, m_tile_count - i);
         const uint32_t data_size = tile_count * GFX_MAP_TILE_SIZE * GFX_MAP_TILE_SIZE;
 
         if (data_size != fread(tile_data_chunk, sizeof(uint8_t), data_size, fp)) {
@@ -174,6 +174,7 @@ public:
     [[nodiscard]] uint8_t GetGridOverlayColor(uint8_t surface_type) const;
 
     [[nodiscard]] const Point& GetMapSize() const { return m_map_size; }
+    [[nodiscard]] uint16_t GetTileCount() const { return m_tile_count; }
     [[nodiscard]] const uint16_t* GetTileIds() const { return m_tile_ids.get(); }
     [[nodiscard]] const uint8_t* GetTileBuffer() const { return m_tile_buffer.get(); }
     [[nodiscard]] const uint8_t* GetSurfaceMap() const { return m_surface_map.get(); }
@@ -0,0 +1,173 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "bandrenderer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+#include "maptilecache.hpp"
+
+static constexpr uint32_t TEST_TILE_SIZE = 64;
+static constexpr uint32_t TEST_TILE_COUNT = 61;
+static constexpr int32_t TEST_MARGIN = 24;
+static constexpr uint8_t TEST_MARGIN_COLOR = 0xEE;
+
+struct TestView {
+    int32_t width;
+    int32_t height;
+    uint32_t zoom_level;
+    uint32_t clip_left;
+    uint32_t clip_top;
+};
+
+static std::vector<uint8_t> MakeTestTiles() {
+    std::vector<uint8_t> tiles(TEST_TILE_COUNT * TEST_TILE_SIZE * TEST_TILE_SIZE);
+
+    for (size_t i = 0; i < tiles.size(); ++i) {
+        tiles[i] = static_cast<uint8_t>((i * 13) ^ (i >> 5));
+    }
+
+    return tiles;
+}
+
+static int32_t GetTileCount(const int32_t length, const uint32_t zoom_level, const uint32_t clip) {
+    return (length + clip + zoom_level - 1) / zoom_level;
+}
+
+/* renders the view pixel by pixel as the reference image */
+static std::vector<uint8_t> RenderGolden(const TestView& view, MapTileCache& cache, const std::vector<uint8_t>& tiles,
+                                         const uint8_t* color_table, const int32_t pitch) {
+    const int32_t tile_count_x = GetTileCount(view.width, view.zoom_level, view.clip_left);
+    std::vector<uint8_t> image(pitch * view.height, TEST_MARGIN_COLOR);
+
+    for (int32_t y = 0; y < view.height; ++y) {
+        const uint32_t map_y = y + view.clip_top;
+
+        for (int32_t x = 0; x < view.width; ++x) {
+            const uint32_t map_x = x + view.clip_left;
+            const uint32_t tile_position = (map_y / view.zoom_level) * tile_count_x + map_x / view.zoom_level;
+            const uint32_t tile_id = tile_position % TEST_TILE_COUNT;
+            const uint8_t* const tile = cache.GetTile(tiles.data(), TEST_TILE_COUNT, tile_id, TEST_TILE_SIZE,
+                                                      view.zoom_level, color_table);
+
+            image[y * pitch + x] = tile[(map_y % view.zoom_level) * view.zoom_level + map_x % view.zoom_level];
+        }
+    }
+
+    return image;
+}
+
+static void RenderBanded(const TestView& view, BandRenderer& renderer, const int32_t pitch) {
+    const auto tiles = MakeTestTiles();
+    std::vector<uint8_t> color_table(256);
+
+    for (size_t i = 0; i < color_table.size(); ++i) {
+        color_table[i] = static_cast<uint8_t>(255 - i);
+    }
+
+    MapTileCache cache(4 * 1024 * 1024);
+    const std::vector<uint8_t> golden = RenderGolden(view, cache, tiles, color_table.data(), pitch);
+
+    const int32_t tile_count_x = GetTileCount(view.width, view.zoom_level, view.clip_left);
+    const int32_t tile_count_y = GetTileCount(view.height, view.zoom_level, view.clip_top);
+    std::vector<const uint8_t*> tile_pointers(tile_count_x * tile_count_y);
+
+    for (size_t i = 0; i < tile_pointers.size(); ++i) {
+        tile_pointers[i] = cache.GetTile(tiles.data(), TEST_TILE_COUNT, i % TEST_TILE_COUNT, TEST_TILE_SIZE,
+                                         view.zoom_level, color_table.data());
+    }
+
+    const MapTileRegion region{
+        .tiles = tile_pointers.data(),
+        .tile_count_x = tile_count_x,
+        .tile_count_y = tile_count_y,
+        .zoom_level = view.zoom_level,
+        .clip_left = view.clip_left,
+        .clip_top = view.clip_top,
+        .clip_right = static_cast<uint32_t>(tile_count_x * view.zoom_level - view.clip_left - view.width),
+        .clip_bottom = static_cast<uint32_t>(tile_count_y * view.zoom_level - view.clip_top - view.height)};
+
+    std::vector<uint8_t> serial(pitch * view.height, TEST_MARGIN_COLOR);
+
+    MapTileCache_BlitRows(region, 0, tile_count_y, serial.data(), pitch);
+
+    EXPECT_EQ(serial, golden);
+
+    std::vector<uint8_t> banded(pitch * view.height, TEST_MARGIN_COLOR);
+
+    renderer.Run(tile_count_y, [&region, &banded, pitch](int32_t band) {
+        MapTileCache_BlitRows(region, band, band + 1, banded.data(), pitch);
+    });
+
+    EXPECT_EQ(banded, golden);
+}
+
+TEST(BandRenderer, RunsEveryBandOnce) {
+    BandRenderer renderer;
+
+    ASSERT_TRUE(renderer.Start(3));
+    EXPECT_EQ(renderer.GetThreadCount(), 4u);
+
+    for (int32_t band_count : {1, 2, 5, 64}) {
+        std::vector<std::atomic<int32_t>> calls(band_count);
+
+        for (int32_t pass = 0; pass < 20; ++pass) {
+            renderer.Run(band_count, [&calls](int32_t band) { calls[band].fetch_add(1); });
+        }
+
+        for (int32_t band = 0; band < band_count; ++band) {
+            EXPECT_EQ(calls[band].load(), 20) << band_count << " " << band;
+        }
+    }
+
+    renderer.Stop();
+
+    int32_t serial_calls = 0;
+
+    renderer.Run(8, [&serial_calls](int32_t) { ++serial_calls; });
+
+    EXPECT_EQ(serial_calls, 8);
+}
+
+TEST(BandRenderer, GoldenImage1080p) {
+    BandRenderer renderer;
+
+    ASSERT_TRUE(renderer.Start(3));
+
+    RenderBanded({.width = 1920, .height = 1080, .zoom_level = 64, .clip_left = 17, .clip_top = 30}, renderer,
+                 1920 + TEST_MARGIN);
+    RenderBanded({.width = 1920, .height = 1080, .zoom_level = 27, .clip_left = 0, .clip_top = 26}, renderer,
+                 1920 + TEST_MARGIN);
+}
+
+TEST(BandRenderer, GoldenImage4K) {
+    BandRenderer renderer;
+
+    ASSERT_TRUE(renderer.Start(5));
+
+    RenderBanded({.width = 3840, .height = 2160, .zoom_level = 45, .clip_left = 10, .clip_top = 20}, renderer,
+                 3840 + TEST_MARGIN);
+    RenderBanded({.width = 3840, .height = 2160, .zoom_level = 64, .clip_left = 63, .clip_top = 1}, renderer,
+                 3840 + TEST_MARGIN);
+}
@@ -0,0 +1,128 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "blitkernels.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "blitreference.hpp"
+
+TEST(BlitKernels, CopiesMatchReference) {
+    constexpr int32_t pitch = 83;
+    constexpr int32_t length = 7;
+
+    const auto source = MakePixels(pitch * length, 1, 30);
+    const auto mask = MakePixels(pitch * length, 2, 50);
+    const auto background = MakePixels(pitch * length, 3, 0);
+
+    for (int32_t offset = 0; offset < 3; ++offset) {
+        for (int32_t width = 0; width <= 72; ++width) {
+            auto expected = background;
+            auto actual = background;
+
+            ReferenceTransCopy(&source[offset], width, length, pitch, &expected[offset], pitch);
+            BlitKernels_TransCopy(&source[offset], width, length, pitch, &actual[offset], pitch);
+
+            ASSERT_EQ(expected, actual) << "trans copy " << width;
+
+            for (const bool transparent : {false, true}) {
+                expected = background;
+                actual = background;
+
+                ReferenceMaskCopy(&source[offset], width, length, pitch, &mask[offset], pitch, &expected[offset], pitch,
+                                  transparent);
+
+                if (transparent) {
+                    BlitKernels_MaskTransCopy(&source[offset], width, length, pitch, &mask[offset], pitch,
+                                              &actual[offset], pitch);
+
+                } else {
+                    BlitKernels_MaskCopy(&source[offset], width, length, pitch, &mask[offset], pitch, &actual[offset],
+                                         pitch);
+                }
+
+                ASSERT_EQ(expected, actual) << "mask copy " << width << " " << transparent;
+            }
+        }
+    }
+}
+
+TEST(BlitKernels, RemapAndSwapMatchReference) {
+    constexpr int32_t pitch = 83;
+    constexpr int32_t length = 5;
+
+    uint8_t color_table[256];
+
+    for (int32_t i = 0; i < 256; ++i) {
+        color_table[i] = static_cast<uint8_t>(255 - i);
+    }
+
+    const auto background = MakePixels(pitch * length, 4, 20);
+
+    for (int32_t width = 0; width <= 72; ++width) {
+        auto expected = background;
+        auto actual = background;
+
+        ReferenceRemap(&expected[1], width, length, pitch, color_table);
+        BlitKernels_Remap(&actual[1], width, length, pitch, color_table);
+
+        ASSERT_EQ(expected, actual) << "remap " << width;
+
+        const uint8_t c1 = background[3];
+        const uint8_t c2 = 0;
+
+        expected = background;
+        actual = background;
+
+        ReferenceSwapColors(&expected[1], width, length, pitch, c1, c2);
+        BlitKernels_SwapColors(&actual[1], width, length, pitch, c1, c2);
+
+        ASSERT_EQ(expected, actual) << "swap " << width;
+    }
+}
+
+TEST(BlitKernels, ScaleMatchesReference) {
+    constexpr int32_t dst_pitch = 150;
+    constexpr int32_t dst_length = 150;
+
+    const auto source = MakePixels(64 * 64, 5, 25);
+    const auto background = MakePixels(dst_pitch * dst_length, 6, 0);
+
+    for (int32_t ow = 1; ow <= 64; ow += 7) {
+        for (int32_t ol = 1; ol <= 64; ol += 9) {
+            for (const int32_t nw : {ow / 2, ow, 2 * ow, 3 * ow / 2 + 1, 140}) {
+                for (const int32_t nl : {ol / 3, ol, 2 * ol, 140}) {
+                    for (const bool transparent : {false, true}) {
+                        auto expected = background;
+                        auto actual = background;
+
+                        ReferenceScale(source.data(), ow, ol, 64, expected.data(), nw, nl, dst_pitch, transparent);
+                        BlitKernels_Scale(source.data(), ow, ol, 64, actual.data(), nw, nl, dst_pitch, transparent);
+
+                        ASSERT_EQ(expected, actual) << ow << "x" << ol << " to " << nw << "x" << nl;
+                    }
+                }
+            }
+        }
+    }
+}
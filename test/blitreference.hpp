@@ -0,0 +1,122 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef BLITREFERENCE_HPP
+#define BLITREFERENCE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/* reference implementations, the former scalar loops of grbuf.c, shared by the unit tests and the benchmarks */
+inline void ReferenceTransCopy(const uint8_t* src, int32_t width, int32_t length, int32_t full, uint8_t* dst,
+                               int32_t full2) {
+    for (int32_t i = 0; i < length; i++) {
+        for (int32_t j = 0; j < width; j++) {
+            if (src[j]) {
+                dst[j] = src[j];
+            }
+        }
+
+        src += full;
+        dst += full2;
+    }
+}
+
+inline void ReferenceMaskCopy(const uint8_t* src, int32_t width, int32_t length, int32_t full, const uint8_t* msk,
+                              int32_t full2, uint8_t* dst, int32_t full3, bool transparent) {
+    for (int32_t i = 0; i < length; i++) {
+        for (int32_t j = 0; j < width; j++) {
+            if (msk[j] && (!transparent || src[j])) {
+                dst[j] = src[j];
+            }
+        }
+
+        src += full;
+        msk += full2;
+        dst += full3;
+    }
+}
+
+inline void ReferenceRemap(uint8_t* buf, int32_t width, int32_t length, int32_t full, const uint8_t* color_table) {
+    for (int32_t y = 0; y < length; y++) {
+        for (int32_t x = 0; x < width; x++) {
+            buf[x] = color_table[buf[x]];
+        }
+
+        buf += full;
+    }
+}
+
+inline void ReferenceSwapColors(uint8_t* buf, int32_t width, int32_t length, int32_t full, int32_t c1, int32_t c2) {
+    for (int32_t y = 0; y < length; y++) {
+        for (int32_t x = 0; x < width; x++) {
+            if (buf[x] == c1) {
+                buf[x] = c2;
+
+            } else if (buf[x] == c2) {
+                buf[x] = c1;
+            }
+        }
+
+        buf += full;
+    }
+}
+
+inline void ReferenceScale(const uint8_t* src, int32_t ow, int32_t ol, int32_t full, uint8_t* dst, int32_t nw,
+                           int32_t nl, int32_t full2, bool transparent) {
+    const int32_t my = (nl << 16) / ol;
+    const int32_t mx = (nw << 16) / ow;
+
+    for (int32_t srcy = 0; srcy < ol; srcy++) {
+        uint32_t sx_preshift = 0;
+        uint32_t ex_preshift = (nw << 16) / ow;
+
+        for (int32_t srcx = 0; srcx < ow; srcx++) {
+            const uint8_t pixel = src[srcy * full + srcx];
+
+            if (pixel || !transparent) {
+                for (int32_t desty = my * srcy >> 16; desty < ((my + my * srcy) >> 16); desty++) {
+                    for (uint32_t destx = sx_preshift >> 16; destx < (ex_preshift >> 16); destx++) {
+                        dst[desty * full2 + destx] = pixel;
+                    }
+                }
+            }
+
+            sx_preshift += mx;
+            ex_preshift += mx;
+        }
+    }
+}
+
+inline std::vector<uint8_t> MakePixels(size_t size, uint32_t seed, uint32_t transparency) {
+    std::vector<uint8_t> pixels(size);
+
+    for (size_t i = 0; i < size; ++i) {
+        const uint32_t value = static_cast<uint32_t>((i + seed) * 2654435761u) >> 13;
+
+        pixels[i] = (value % 100) < transparency ? 0 : static_cast<uint8_t>(value);
+    }
+
+    return pixels;
+}
+
+#endif /* BLITREFERENCE_HPP */
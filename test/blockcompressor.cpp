@@ -0,0 +1,121 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "blockcompressor.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+static std::vector<uint8_t> BlockCompressorTest_RoundTrip(const std::vector<uint8_t>& data) {
+    std::vector<uint8_t> packed(BlockCompressor_GetBound(data.size()));
+    const size_t packed_size = BlockCompressor_Compress(data.data(), data.size(), packed.data(), packed.size());
+
+    EXPECT_GT(packed_size, 0u);
+
+    packed.resize(packed_size);
+
+    std::vector<uint8_t> unpacked(data.size());
+
+    EXPECT_TRUE(BlockCompressor_Decompress(packed.data(), packed.size(), unpacked.data(), unpacked.size()));
+    EXPECT_EQ(unpacked, data);
+
+    return packed;
+}
+
+TEST(BlockCompressor, RoundTrip) {
+    std::vector<uint8_t> data;
+
+    BlockCompressorTest_RoundTrip(data);
+
+    data = {1, 2, 3};
+    BlockCompressorTest_RoundTrip(data);
+
+    // a sparse per cell array, the typical save file payload
+    data.assign(112 * 112 * 12, 0);
+
+    for (size_t i = 0; i < data.size(); i += 97) {
+        data[i] = static_cast<uint8_t>(i);
+    }
+
+    EXPECT_LT(BlockCompressorTest_RoundTrip(data).size(), data.size() / 8);
+
+    // long literal and match runs need length extensions
+    data.clear();
+
+    for (uint32_t i = 0; i < 1000; ++i) {
+        data.push_back(static_cast<uint8_t>(i * 7919u >> 3));
+    }
+
+    data.insert(data.end(), 5000, 0xAB);
+    data.insert(data.end(), data.begin(), data.begin() + 700);
+
+    EXPECT_LT(BlockCompressorTest_RoundTrip(data).size(), 1200u);
+
+    // noise does not compress but must survive the round trip within the bound
+    uint32_t seed = 777;
+
+    for (auto& byte : data) {
+        seed = seed * 1103515245u + 12345u;
+        byte = static_cast<uint8_t>(seed >> 16);
+    }
+
+    EXPECT_LE(BlockCompressorTest_RoundTrip(data).size(), BlockCompressor_GetBound(data.size()));
+}
+
+TEST(BlockCompressor, RejectsSmallTargets) {
+    std::vector<uint8_t> data(4096);
+    uint32_t seed = 99;
+
+    for (auto& byte : data) {
+        seed = seed * 1103515245u + 12345u;
+        byte = static_cast<uint8_t>(seed >> 16);
+    }
+
+    std::vector<uint8_t> packed(data.size() - 1);
+
+    EXPECT_EQ(BlockCompressor_Compress(data.data(), data.size(), packed.data(), packed.size()), 0u);
+}
+
+TEST(BlockCompressor, RejectsDamagedBlocks) {
+    const std::string text = "the quick brown fox jumps over the lazy dog, the quick brown fox jumps over the lazy cat";
+    const std::vector<uint8_t> data(text.begin(), text.end());
+    std::vector<uint8_t> packed = BlockCompressorTest_RoundTrip(data);
+    std::vector<uint8_t> unpacked(data.size());
+
+    // wrong raw size
+    EXPECT_FALSE(BlockCompressor_Decompress(packed.data(), packed.size(), unpacked.data(), unpacked.size() - 1));
+
+    // every truncation is detected
+    for (size_t size = 0; size < packed.size(); ++size) {
+        EXPECT_FALSE(BlockCompressor_Decompress(packed.data(), size, unpacked.data(), unpacked.size()));
+    }
+
+    // corrupted bytes never write out of bounds, the result is either rejected or of the right size
+    for (size_t i = 0; i < packed.size(); ++i) {
+        std::vector<uint8_t> damaged = packed;
+
+        damaged[i] ^= 0xFF;
+
+        (void)BlockCompressor_Decompress(damaged.data(), damaged.size(), unpacked.data(), unpacked.size());
+    }
+}
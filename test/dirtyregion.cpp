@@ -0,0 +1,144 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "dirtyregion.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+static constexpr int32_t TEST_SIZE = 96;
+
+static std::vector<uint8_t> RasterizeRegion(const DirtyRegion& region) {
+    std::vector<uint8_t> coverage(TEST_SIZE * TEST_SIZE, 0);
+
+    for (size_t i = 0; i < region.GetCount(); ++i) {
+        const Rect& rect = region[i];
+
+        for (int32_t y = rect.uly; y < rect.lry; ++y) {
+            for (int32_t x = rect.ulx; x < rect.lrx; ++x) {
+                ++coverage[y * TEST_SIZE + x];
+            }
+        }
+    }
+
+    return coverage;
+}
+
+TEST(DirtyRegion, MergesNeighbours) {
+    DirtyRegion region(0);
+
+    region.Add({0, 0, 10, 10});
+    region.Add({10, 0, 20, 10});
+    region.Add({0, 10, 20, 15});
+
+    ASSERT_EQ(region.GetCount(), 1u);
+    EXPECT_EQ(region[0].ulx, 0);
+    EXPECT_EQ(region[0].uly, 0);
+    EXPECT_EQ(region[0].lrx, 20);
+    EXPECT_EQ(region[0].lry, 15);
+    EXPECT_EQ(region.GetArea(), 300);
+    EXPECT_EQ(region.GetRequestedArea(), 300);
+
+    region.Add({2, 2, 5, 5});
+    region.Add({5, 5, 5, 9});
+
+    EXPECT_EQ(region.GetCount(), 1u);
+    EXPECT_EQ(region.GetRequestedArea(), 309);
+
+    region.Add({40, 40, 50, 50});
+
+    EXPECT_EQ(region.GetCount(), 2u);
+    EXPECT_TRUE(region.Intersects({45, 0, 46, 41}));
+    EXPECT_FALSE(region.Intersects({20, 15, 40, 40}));
+
+    const Rect bounds = region.GetBounds();
+
+    EXPECT_EQ(bounds.ulx, 0);
+    EXPECT_EQ(bounds.lry, 50);
+
+    region.Clear();
+
+    EXPECT_TRUE(region.IsEmpty());
+    EXPECT_EQ(region.GetRequestedArea(), 0);
+}
+
+TEST(DirtyRegion, MergeCostBoundsWaste) {
+    DirtyRegion strict(0);
+    DirtyRegion relaxed(50);
+
+    for (DirtyRegion* region : {&strict, &relaxed}) {
+        region->Add({0, 0, 10, 10});
+        region->Add({12, 0, 22, 10});
+    }
+
+    // the gap of 2 x 10 is cheaper than a second rectangle only for the relaxed region
+    EXPECT_EQ(strict.GetCount(), 2u);
+    EXPECT_EQ(strict.GetArea(), 200);
+    EXPECT_EQ(relaxed.GetCount(), 1u);
+    EXPECT_EQ(relaxed.GetArea(), 220);
+}
+
+TEST(DirtyRegion, RandomRectanglesStayDisjoint) {
+    std::mt19937 generator(1234);
+    std::uniform_int_distribution<int32_t> position(0, TEST_SIZE - 1);
+
+    for (int64_t merge_cost : {0, 64, 512}) {
+        for (int32_t round = 0; round < 50; ++round) {
+            DirtyRegion region(merge_cost);
+            std::vector<uint8_t> requested(TEST_SIZE * TEST_SIZE, 0);
+
+            for (int32_t i = 0; i < 30; ++i) {
+                int32_t x1 = position(generator);
+                int32_t x2 = position(generator);
+                int32_t y1 = position(generator);
+                int32_t y2 = position(generator);
+
+                const Rect rect = {std::min(x1, x2), std::min(y1, y2), std::max(x1, x2) + 1, std::max(y1, y2) + 1};
+
+                region.Add(rect);
+
+                for (int32_t y = rect.uly; y < rect.lry; ++y) {
+                    for (int32_t x = rect.ulx; x < rect.lrx; ++x) {
+                        requested[y * TEST_SIZE + x] = 1;
+                    }
+                }
+            }
+
+            const auto coverage = RasterizeRegion(region);
+            int64_t covered_area = 0;
+
+            for (size_t i = 0; i < coverage.size(); ++i) {
+                ASSERT_LE(coverage[i], 1) << "overlapping rectangles";
+                ASSERT_GE(coverage[i], requested[i]) << "lost dirty pixel";
+
+                if (merge_cost == 0) {
+                    ASSERT_EQ(coverage[i], requested[i]);
+                }
+
+                covered_area += coverage[i];
+            }
+
+            EXPECT_EQ(region.GetArea(), covered_area);
+        }
+    }
+}
@@ -0,0 +1,173 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "frameprofiler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+TEST(FrameProfiler, NestedScopesRecordSelfTime) {
+    FrameProfiler profiler;
+    const uint32_t outer = profiler.GetSectionId("Outer");
+    const uint32_t inner = profiler.GetSectionId("Inner");
+
+    EXPECT_EQ(profiler.GetSectionId("Outer"), outer);
+    EXPECT_EQ(profiler.GetSectionCount(), 2u);
+    EXPECT_FALSE(profiler.BeginScope(outer, 0));
+
+    profiler.SetEnabled(true);
+    profiler.MarkFrame(1000);
+
+    ASSERT_TRUE(profiler.BeginScope(outer, 1000));
+    ASSERT_TRUE(profiler.BeginScope(inner, 1100));
+    profiler.EndScope(1400);
+    ASSERT_TRUE(profiler.BeginScope(inner, 1500));
+    profiler.EndScope(1600);
+    profiler.EndScope(2000);
+    profiler.MarkFrame(3000);
+
+    ASSERT_EQ(profiler.GetFrameCount(), 2u);
+
+    const FrameProfiler::Frame& frame = profiler.GetFrame(0);
+
+    EXPECT_EQ(frame.start_ns, 1000u);
+    EXPECT_EQ(frame.duration_ns, 2000u);
+    EXPECT_EQ(frame.section_ns[outer], 600u);
+    EXPECT_EQ(frame.section_ns[inner], 400u);
+    EXPECT_EQ(frame.section_calls[outer], 1u);
+    EXPECT_EQ(frame.section_calls[inner], 2u);
+
+    // a scope that spans a frame boundary is accounted to the frame in which it ends
+    ASSERT_TRUE(profiler.BeginScope(outer, 3500));
+    profiler.MarkFrame(4000);
+    profiler.EndScope(4500);
+    profiler.MarkFrame(5000);
+
+    EXPECT_EQ(profiler.GetFrame(1).section_ns[outer], 0u);
+    EXPECT_EQ(profiler.GetFrame(0).section_ns[outer], 1000u);
+}
+
+TEST(FrameProfiler, IgnoresOtherThreadsAndDeepNesting) {
+    FrameProfiler profiler;
+    const uint32_t section = profiler.GetSectionId("Section");
+
+    profiler.SetEnabled(true);
+
+    std::thread thread([&profiler, section]() { EXPECT_FALSE(profiler.BeginScope(section, 0)); });
+
+    thread.join();
+
+    for (uint32_t i = 0; i < FrameProfiler::MAX_DEPTH + 4; ++i) {
+        ASSERT_TRUE(profiler.BeginScope(section, 100 * i));
+    }
+
+    for (uint32_t i = FrameProfiler::MAX_DEPTH + 4; i > 0; --i) {
+        profiler.EndScope(10000 - 100 * i);
+    }
+
+    profiler.MarkFrame(20000);
+
+    // self times of nested scopes add up to the time of the outermost scope, opened at 0 and closed at 9900
+    EXPECT_EQ(profiler.GetFrame(0).section_ns[section], 9900u);
+    EXPECT_EQ(profiler.GetFrame(0).section_calls[section], FrameProfiler::MAX_DEPTH);
+    EXPECT_EQ(profiler.GetTraceEventCount(), FrameProfiler::MAX_DEPTH + 1);
+}
+
+TEST(FrameProfiler, FrameHistoryWrapsAround) {
+    FrameProfiler profiler;
+    const uint32_t section = profiler.GetSectionId("Section");
+
+    profiler.SetEnabled(true);
+    profiler.MarkFrame(0);
+
+    for (uint64_t i = 1; i <= FrameProfiler::FRAME_HISTORY + 10; ++i) {
+        ASSERT_TRUE(profiler.BeginScope(section, i * 1000));
+        profiler.EndScope(i * 1000 + i);
+        profiler.MarkFrame(i * 1000 + 500);
+    }
+
+    ASSERT_EQ(profiler.GetFrameCount(), FrameProfiler::FRAME_HISTORY);
+
+    for (uint32_t age = 0; age < FrameProfiler::FRAME_HISTORY; ++age) {
+        const uint64_t frame = FrameProfiler::FRAME_HISTORY + 10 - age;
+
+        EXPECT_EQ(profiler.GetFrame(age).section_ns[section], frame);
+        EXPECT_EQ(profiler.GetFrame(age).duration_ns, 1000u);
+    }
+
+    profiler.SetEnabled(true);
+
+    EXPECT_EQ(profiler.GetFrameCount(), 0u);
+    EXPECT_EQ(profiler.GetTraceEventCount(), 0u);
+}
+
+TEST(FrameProfiler, WritesChromeTrace) {
+    FrameProfiler profiler;
+    const uint32_t outer = profiler.GetSectionId("Outer");
+    const uint32_t inner = profiler.GetSectionId("In\"ner");
+
+    profiler.SetEnabled(true);
+
+    ASSERT_TRUE(profiler.BeginScope(outer, 1000));
+    ASSERT_TRUE(profiler.BeginScope(inner, 1500));
+    profiler.EndScope(2500);
+    profiler.EndScope(4000);
+    profiler.MarkFrame(5000);
+
+    std::ostringstream stream;
+
+    ASSERT_TRUE(profiler.WriteChromeTrace(stream));
+
+    EXPECT_EQ(stream.str(),
+              "{\"traceEvents\":[\n"
+              "{\"name\":\"In\\\"ner\",\"ph\":\"X\",\"ts\":1.500,\"dur\":1.000,\"pid\":1,\"tid\":1},\n"
+              "{\"name\":\"Outer\",\"ph\":\"X\",\"ts\":1.000,\"dur\":3.000,\"pid\":1,\"tid\":1},\n"
+              "{\"name\":\"Frame\",\"ph\":\"i\",\"s\":\"g\",\"ts\":5.000,\"pid\":1,\"tid\":1}\n"
+              "],\"displayTimeUnit\":\"ms\"}\n");
+}
+
+TEST(FrameProfiler, ScopesFillTraceBuffer) {
+    constexpr int32_t scopes = FrameProfiler::TRACE_CAPACITY + 1000;
+    FrameProfiler& profiler = FrameProfiler_Get();
+    const uint32_t section = profiler.GetSectionId("Scopes");
+
+    profiler.SetEnabled(false);
+
+    for (int32_t i = 0; i < scopes; ++i) {
+        FrameProfilerScope scope(section);
+    }
+
+    profiler.SetEnabled(true);
+
+    for (int32_t i = 0; i < scopes; ++i) {
+        FrameProfilerScope scope(section);
+    }
+
+    profiler.MarkFrame(FrameProfiler::GetTime());
+    profiler.SetEnabled(false);
+
+    // disabled scopes are not counted, the trace keeps the most recent events only
+    EXPECT_EQ(profiler.GetFrame(0).section_calls[section], static_cast<uint32_t>(scopes));
+    EXPECT_EQ(profiler.GetTraceEventCount(), static_cast<size_t>(FrameProfiler::TRACE_CAPACITY));
+}
@@ -0,0 +1,300 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "heatmap.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+static constexpr int32_t TEST_MAP_WIDTH = 24;
+static constexpr int32_t TEST_MAP_HEIGHT = 20;
+
+/* the heat map never dereferences its units, distinct addresses are enough to tell them apart */
+static int HeatMapTest_UnitTokens[3];
+
+enum : int32_t {
+    TEST_UNIT_SEA_LAND_SCANNER = 0,
+    TEST_UNIT_SEA_SCANNER = 1,
+    TEST_UNIT_SCANNER = 2,
+};
+
+static const UnitInfo* HeatMapTest_GetUnit(int32_t unit) {
+    return reinterpret_cast<const UnitInfo*>(&HeatMapTest_UnitTokens[unit]);
+}
+
+/* same cell test as Access_IsWithinScanRange(), which the span tables replaced */
+static bool HeatMapTest_IsWithinScanRange(int32_t center_x, int32_t center_y, int32_t grid_x, int32_t grid_y,
+                                          int32_t scan_range) {
+    int32_t scan_area = (scan_range * 64) * (scan_range * 64);
+    int32_t radius_x = ((grid_x - center_x) * 64);
+    int32_t radius_y = ((grid_y - center_y) * 64);
+    int32_t grid_area = radius_x * radius_x + radius_y * radius_y;
+
+    return grid_area <= scan_area;
+}
+
+struct HeatMapTestCallout {
+    char kind;
+    const UnitInfo* unit;
+    int32_t grid_x;
+    int32_t grid_y;
+
+    bool operator==(const HeatMapTestCallout& other) const = default;
+};
+
+class HeatMapTest : public ::testing::Test {
+protected:
+    [[nodiscard]] static HeatMap CreateHeatMap(std::vector<HeatMapTestCallout>& log, int32_t width = TEST_MAP_WIDTH,
+                                               int32_t height = TEST_MAP_HEIGHT) {
+        HeatMapCallouts callouts;
+
+        callouts.on_cell_revealed = [&log](const UnitInfo* unit, int32_t grid_x, int32_t grid_y) {
+            log.push_back({'+', unit, grid_x, grid_y});
+
+            return 1u;
+        };
+
+        callouts.on_cell_hidden = [&log](const UnitInfo* unit, int32_t grid_x, int32_t grid_y) {
+            log.push_back({'-', unit, grid_x, grid_y});
+        };
+
+        callouts.on_sea_revealed = [&log](const UnitInfo* unit, int32_t grid_x, int32_t grid_y) {
+            log.push_back({'s', unit, grid_x, grid_y});
+
+            return 2u;
+        };
+
+        callouts.on_land_revealed = [&log](const UnitInfo* unit, int32_t grid_x, int32_t grid_y) {
+            log.push_back({'l', unit, grid_x, grid_y});
+
+            return 4u;
+        };
+
+        return HeatMap(
+            width, height, 0,
+            [](const UnitInfo* unit) { return unit != HeatMapTest_GetUnit(TEST_UNIT_SCANNER); },
+            [](const UnitInfo* unit) { return unit == HeatMapTest_GetUnit(TEST_UNIT_SEA_LAND_SCANNER); }, callouts);
+    }
+
+    /* reference path: one Add() per covered cell, visited row by row */
+    static uint32_t AddCells(HeatMap& heat_map, const UnitInfo* unit, int32_t center_x, int32_t center_y,
+                             int32_t radius) {
+        uint32_t info = 0;
+
+        for (int32_t grid_y = 0; grid_y < heat_map.GetHeight(); ++grid_y) {
+            for (int32_t grid_x = 0; grid_x < heat_map.GetWidth(); ++grid_x) {
+                if (HeatMapTest_IsWithinScanRange(center_x, center_y, grid_x, grid_y, radius)) {
+                    uint32_t revealed_info;
+
+                    heat_map.Add(unit, grid_x, grid_y, &revealed_info);
+
+                    info |= revealed_info;
+                }
+            }
+        }
+
+        return info;
+    }
+
+    static void RemoveCells(HeatMap& heat_map, const UnitInfo* unit, int32_t center_x, int32_t center_y,
+                            int32_t radius) {
+        for (int32_t grid_y = 0; grid_y < heat_map.GetHeight(); ++grid_y) {
+            for (int32_t grid_x = 0; grid_x < heat_map.GetWidth(); ++grid_x) {
+                if (HeatMapTest_IsWithinScanRange(center_x, center_y, grid_x, grid_y, radius)) {
+                    heat_map.Remove(unit, grid_x, grid_y);
+                }
+            }
+        }
+    }
+
+    /* overlapping coverage of other units so that the tested discs cross zero only on part of their cells */
+    static void AddBackground(HeatMap& heat_map) {
+        AddCells(heat_map, HeatMapTest_GetUnit(TEST_UNIT_SCANNER), 6, 5, 4);
+        AddCells(heat_map, HeatMapTest_GetUnit(TEST_UNIT_SEA_SCANNER), 15, 12, 3);
+        AddCells(heat_map, HeatMapTest_GetUnit(TEST_UNIT_SEA_LAND_SCANNER), 20, 3, 2);
+    }
+
+    static void ExpectEqualCells(const HeatMap& heat_map, const HeatMap& expected) {
+        const auto& cells = heat_map.GetCells();
+        const auto& expected_cells = expected.GetCells();
+
+        ASSERT_EQ(cells.size(), expected_cells.size());
+
+        for (size_t i = 0; i < cells.size(); ++i) {
+            EXPECT_EQ(cells[i].complete, expected_cells[i].complete) << i;
+            EXPECT_EQ(cells[i].stealth_sea, expected_cells[i].stealth_sea) << i;
+            EXPECT_EQ(cells[i].stealth_land, expected_cells[i].stealth_land) << i;
+            EXPECT_EQ(heat_map.GetVisibility().Test(i), expected.GetVisibility().Test(i)) << i;
+            EXPECT_EQ(heat_map.GetStealthSeaVisibility().Test(i), expected.GetStealthSeaVisibility().Test(i)) << i;
+            EXPECT_EQ(heat_map.GetStealthLandVisibility().Test(i), expected.GetStealthLandVisibility().Test(i)) << i;
+        }
+    }
+};
+
+TEST_F(HeatMapTest, DiscMatchesScanRange) {
+    constexpr int32_t size = 48;
+    const UnitInfo* unit = HeatMapTest_GetUnit(TEST_UNIT_SEA_LAND_SCANNER);
+    std::vector<HeatMapTestCallout> log;
+    std::vector<HeatMapTestCallout> expected_log;
+
+    for (int32_t radius = 0; radius <= 20; ++radius) {
+        // centered, and in every corner so that the disc is clipped at each map edge
+        const int32_t centers[][2] = {{size / 2, size / 2}, {0, 0}, {size - 1, 0}, {0, size - 1}, {size - 1, size - 1}};
+
+        for (const auto& center : centers) {
+            HeatMap heat_map = CreateHeatMap(log, size, size);
+            HeatMap expected = CreateHeatMap(expected_log, size, size);
+
+            log.clear();
+            expected_log.clear();
+
+            const uint32_t info = heat_map.AddDisc(unit, center[0], center[1], radius);
+            const uint32_t expected_info = AddCells(expected, unit, center[0], center[1], radius);
+
+            EXPECT_EQ(info, expected_info);
+            EXPECT_EQ(log, expected_log) << "radius " << radius;
+
+            for (int32_t grid_y = 0; grid_y < size; ++grid_y) {
+                for (int32_t grid_x = 0; grid_x < size; ++grid_x) {
+                    EXPECT_EQ(heat_map.GetComplete(grid_x, grid_y),
+                              HeatMapTest_IsWithinScanRange(center[0], center[1], grid_x, grid_y, radius) ? 1u : 0u)
+                        << "radius " << radius << " cell " << grid_x << "," << grid_y;
+                }
+            }
+
+            ExpectEqualCells(heat_map, expected);
+        }
+    }
+}
+
+TEST_F(HeatMapTest, AddRemoveDisc) {
+    std::vector<HeatMapTestCallout> log;
+    std::vector<HeatMapTestCallout> expected_log;
+
+    for (int32_t unit = TEST_UNIT_SEA_LAND_SCANNER; unit <= TEST_UNIT_SCANNER; ++unit) {
+        for (int32_t radius : {0, 1, 5, 30}) {
+            HeatMap heat_map = CreateHeatMap(log);
+            HeatMap expected = CreateHeatMap(expected_log);
+
+            AddBackground(heat_map);
+            AddBackground(expected);
+
+            log.clear();
+            expected_log.clear();
+
+            heat_map.AddDisc(HeatMapTest_GetUnit(unit), 4, 17, radius);
+            heat_map.RemoveDisc(HeatMapTest_GetUnit(unit), 4, 17, radius);
+
+            ExpectEqualCells(heat_map, expected);
+
+            AddCells(expected, HeatMapTest_GetUnit(unit), 4, 17, radius);
+            RemoveCells(expected, HeatMapTest_GetUnit(unit), 4, 17, radius);
+
+            EXPECT_EQ(log, expected_log) << "unit " << unit << " radius " << radius;
+        }
+    }
+}
+
+TEST_F(HeatMapTest, CalloutsRequestLargerDiscs) {
+    const UnitInfo* unit = HeatMapTest_GetUnit(TEST_UNIT_SCANNER);
+    std::vector<HeatMapTestCallout> log;
+    HeatMap other = CreateHeatMap(log);
+    HeatMapCallouts callouts;
+    int32_t radius = 40;
+
+    // reveals update other heat maps, which may ask for span tables of radii never used before
+    callouts.on_cell_revealed = [&](const UnitInfo* revealed_unit, int32_t grid_x, int32_t grid_y) {
+        other.AddDisc(revealed_unit, grid_x, grid_y, ++radius);
+        other.AddDiscDelta(revealed_unit, grid_x, grid_y, grid_x, grid_y + 1, radius);
+
+        return 0u;
+    };
+
+    HeatMap heat_map(TEST_MAP_WIDTH, TEST_MAP_HEIGHT, 0, nullptr, nullptr, callouts);
+
+    heat_map.AddDisc(unit, 10, 10, 3);
+    heat_map.AddDiscDelta(unit, 10, 10, 11, 11, 3);
+
+    for (int32_t grid_y = 0; grid_y < TEST_MAP_HEIGHT; ++grid_y) {
+        for (int32_t grid_x = 0; grid_x < TEST_MAP_WIDTH; ++grid_x) {
+            const bool covered = HeatMapTest_IsWithinScanRange(10, 10, grid_x, grid_y, 3) ||
+                                 HeatMapTest_IsWithinScanRange(11, 11, grid_x, grid_y, 3);
+
+            EXPECT_EQ(heat_map.GetComplete(grid_x, grid_y), covered ? 1u : 0u) << grid_x << "," << grid_y;
+        }
+    }
+}
+
+TEST_F(HeatMapTest, DiscDeltaMatchesFullUpdate) {
+    const UnitInfo* unit = HeatMapTest_GetUnit(TEST_UNIT_SEA_LAND_SCANNER);
+    std::vector<HeatMapTestCallout> log;
+    std::vector<HeatMapTestCallout> expected_log;
+
+    for (int32_t radius : {0, 1, 2, 5, 30}) {
+        for (int32_t step_y = -1; step_y <= 1; ++step_y) {
+            for (int32_t step_x = -1; step_x <= 1; ++step_x) {
+                if (step_x == 0 && step_y == 0) {
+                    continue;
+                }
+
+                // every start cell, so that the discs are clipped at each map edge and the moves end on the border
+                for (int32_t from_y = 0; from_y < TEST_MAP_HEIGHT; ++from_y) {
+                    for (int32_t from_x = 0; from_x < TEST_MAP_WIDTH; ++from_x) {
+                        const int32_t to_x = from_x + step_x;
+                        const int32_t to_y = from_y + step_y;
+
+                        if (to_x < 0 || to_x >= TEST_MAP_WIDTH || to_y < 0 || to_y >= TEST_MAP_HEIGHT) {
+                            continue;
+                        }
+
+                        HeatMap heat_map = CreateHeatMap(log);
+                        HeatMap expected = CreateHeatMap(expected_log);
+
+                        AddBackground(heat_map);
+                        AddBackground(expected);
+                        AddCells(heat_map, unit, from_x, from_y, radius);
+                        AddCells(expected, unit, from_x, from_y, radius);
+
+                        log.clear();
+                        expected_log.clear();
+
+                        // the full update of Access_UpdateMapStatusMove() adds the new disc before removing the old
+                        const uint32_t info = heat_map.AddDiscDelta(unit, from_x, from_y, to_x, to_y, radius);
+                        heat_map.RemoveDiscDelta(unit, from_x, from_y, to_x, to_y, radius);
+
+                        const uint32_t expected_info = AddCells(expected, unit, to_x, to_y, radius);
+                        RemoveCells(expected, unit, from_x, from_y, radius);
+
+                        SCOPED_TRACE(::testing::Message() << "radius " << radius << " from " << from_x << "," << from_y
+                                                          << " to " << to_x << "," << to_y);
+
+                        EXPECT_EQ(info, expected_info);
+                        EXPECT_EQ(log, expected_log);
+
+                        ExpectEqualCells(heat_map, expected);
+                    }
+                }
+            }
+        }
+    }
+}
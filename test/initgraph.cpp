@@ -0,0 +1,175 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "initgraph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(InitGraph, SerialRunKeepsRegistrationOrder) {
+    InitGraph graph;
+    std::vector<uint32_t> order;
+
+    const uint32_t a = graph.AddStage("a", [&order]() { order.push_back(0); }, {}, true);
+    const uint32_t b = graph.AddStage("b", [&order]() { order.push_back(1); }, {}, false);
+    const uint32_t c = graph.AddStage("c", [&order]() { order.push_back(2); }, {a}, true);
+    graph.AddStage("d", [&order]() { order.push_back(3); }, {b, c}, false);
+
+    graph.Run(0);
+
+    EXPECT_EQ(order, (std::vector<uint32_t>{0, 1, 2, 3}));
+
+    for (uint32_t i = 0; i < graph.GetStageCount(); ++i) {
+        EXPECT_EQ(graph.GetTiming(i).thread, InitGraph::CALLER_THREAD);
+    }
+}
+
+TEST(InitGraph, ConcurrentRunHonorsDependencies) {
+    constexpr uint32_t layer_count = 8;
+    constexpr uint32_t layer_width = 6;
+    InitGraph graph;
+    std::mutex mutex;
+    std::vector<uint32_t> completed;
+    std::vector<uint32_t> previous_layer;
+    const std::thread::id caller = std::this_thread::get_id();
+    std::atomic<uint32_t> misplaced{0};
+
+    for (uint32_t layer = 0; layer < layer_count; ++layer) {
+        std::vector<uint32_t> current_layer;
+
+        for (uint32_t i = 0; i < layer_width; ++i) {
+            const uint32_t stage = graph.GetStageCount();
+            const bool pinned = (i % 3) == 0;
+            const auto function = [&, stage, pinned]() {
+                if (pinned && std::this_thread::get_id() != caller) {
+                    ++misplaced;
+                }
+
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+
+                std::lock_guard<std::mutex> lock(mutex);
+
+                completed.push_back(stage);
+            };
+
+            // every stage depends on two stages of the previous layer
+            if (previous_layer.empty()) {
+                current_layer.push_back(graph.AddStage("stage", function, {}, pinned));
+
+            } else {
+                current_layer.push_back(graph.AddStage("stage", function,
+                                                       {previous_layer[i], previous_layer[(i + 1) % layer_width]},
+                                                       pinned));
+            }
+        }
+
+        previous_layer = current_layer;
+    }
+
+    graph.Run(3);
+
+    ASSERT_EQ(completed.size(), layer_count * layer_width);
+    EXPECT_EQ(misplaced, 0u);
+
+    std::vector<uint32_t> position(completed.size());
+
+    for (uint32_t i = 0; i < completed.size(); ++i) {
+        position[completed[i]] = i;
+    }
+
+    for (uint32_t stage = layer_width; stage < completed.size(); ++stage) {
+        const uint32_t layer_base = (stage / layer_width - 1) * layer_width;
+        const uint32_t i = stage % layer_width;
+
+        EXPECT_GT(position[stage], position[layer_base + i]);
+        EXPECT_GT(position[stage], position[layer_base + (i + 1) % layer_width]);
+
+        EXPECT_GE(graph.GetTiming(stage).start_ns,
+                  graph.GetTiming(layer_base + i).start_ns + graph.GetTiming(layer_base + i).duration_ns);
+    }
+}
+
+TEST(InitGraph, WritesReport) {
+    InitGraph graph;
+
+    const uint32_t first = graph.AddStage("first", []() {}, {}, true);
+    graph.AddStage("second \"quoted\"", []() { throw std::runtime_error("failure"); }, {first}, false);
+
+    EXPECT_THROW(graph.Run(1), std::runtime_error);
+
+    std::ostringstream stream;
+
+    ASSERT_TRUE(graph.WriteReport(stream));
+
+    const std::string report = stream.str();
+
+    EXPECT_NE(report.find("\"name\":\"first\""), std::string::npos);
+    EXPECT_NE(report.find("\"name\":\"second \\\"quoted\\\"\""), std::string::npos);
+    EXPECT_NE(report.find("\"dependencies\":[0]"), std::string::npos);
+    EXPECT_NE(report.find("\"main_thread\":true"), std::string::npos);
+    EXPECT_GE(graph.GetTotalTime(), graph.GetTiming(0).duration_ns);
+}
+
+TEST(InitGraph, StopsOnFirstFailure) {
+    for (const uint32_t worker_count : {0u, 3u}) {
+        InitGraph graph;
+        const std::thread::id caller = std::this_thread::get_id();
+        std::atomic<uint32_t> executed{0};
+        std::atomic<uint32_t> independent{0};
+
+        const uint32_t first = graph.AddStage("first", [&executed]() { ++executed; }, {}, true);
+        const uint32_t failing =
+            graph.AddStage("failing", []() { throw std::runtime_error("failure"); }, {first}, false);
+        const uint32_t dependent = graph.AddStage("dependent", [&executed]() { ++executed; }, {failing}, true);
+        graph.AddStage("later", [&executed]() { ++executed; }, {dependent}, false);
+        graph.AddStage("independent", [&independent]() { ++independent; }, {first}, true);
+
+        try {
+            graph.Run(worker_count);
+
+            ADD_FAILURE() << "the failure was not reported";
+
+        } catch (const std::runtime_error& e) {
+            // the exception reaches the caller after the workers joined, also if a worker ran the stage
+            EXPECT_EQ(std::this_thread::get_id(), caller);
+            EXPECT_STREQ(e.what(), "failure");
+        }
+
+        EXPECT_EQ(executed, 1u) << worker_count;
+
+        // the serial order would run the independent stage after the failed one
+        if (worker_count == 0) {
+            EXPECT_EQ(independent, 0u);
+        }
+
+        // a second run starts over
+        EXPECT_THROW(graph.Run(worker_count), std::runtime_error);
+        EXPECT_EQ(executed, 2u);
+    }
+}
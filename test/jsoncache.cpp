@@ -0,0 +1,116 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "jsoncache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+static constexpr uint32_t JsonCacheTest_Kind = 7;
+
+static void JsonCacheTest_Truncate(const std::filesystem::path& path, size_t bytes) {
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - bytes);
+}
+
+TEST(JsonCache, RoundTrip) {
+    const std::filesystem::path path = std::filesystem::path(testing::TempDir()) / "jsoncache" / "roundtrip.bin";
+    const JsonCacheKey key = JsonCache_ComputeKey(JsonCacheTest_Kind, {"schema", "document"});
+    JsonCacheWriter writer(3);
+
+    const uint32_t en = writer.AddString("en-US");
+    const uint32_t de = writer.AddString("de-DE");
+
+    EXPECT_EQ(writer.AddString("en-US"), en);
+
+    writer.AddRecord({0x1234, en, writer.AddString("Hello")});
+    writer.AddRecord({0x1234, de, writer.AddString("Hallo")});
+    writer.AddRecord({0xFFFFFFFF, en, writer.AddString("")});
+
+    ASSERT_TRUE(writer.Write(path, JsonCacheTest_Kind, key));
+
+    JsonCache cache;
+
+    ASSERT_TRUE(cache.Open(path, JsonCacheTest_Kind, key, 3));
+    ASSERT_EQ(cache.GetRecordCount(), 3u);
+
+    EXPECT_EQ(cache.GetRecord(0)[0], 0x1234u);
+    EXPECT_EQ(cache.GetString(cache.GetRecord(0)[1]), "en-US");
+    EXPECT_EQ(cache.GetString(cache.GetRecord(0)[2]), "Hello");
+    EXPECT_EQ(cache.GetString(cache.GetRecord(1)[1]), "de-DE");
+    EXPECT_EQ(cache.GetString(cache.GetRecord(1)[2]), "Hallo");
+    EXPECT_EQ(cache.GetRecord(2)[0], 0xFFFFFFFFu);
+    EXPECT_EQ(cache.GetString(cache.GetRecord(2)[2]), "");
+    EXPECT_EQ(cache.GetString(1000000), "");
+
+    // a rewrite replaces the file of an open reader without disturbing it
+    JsonCacheWriter empty_writer(3);
+
+    ASSERT_TRUE(empty_writer.Write(path, JsonCacheTest_Kind, key));
+    EXPECT_EQ(cache.GetString(cache.GetRecord(1)[2]), "Hallo");
+
+    ASSERT_TRUE(cache.Open(path, JsonCacheTest_Kind, key, 3));
+    EXPECT_EQ(cache.GetRecordCount(), 0u);
+}
+
+TEST(JsonCache, RejectsStaleOrDamagedFiles) {
+    const std::filesystem::path path = std::filesystem::path(testing::TempDir()) / "jsoncache" / "damaged.bin";
+    const JsonCacheKey key = JsonCache_ComputeKey(JsonCacheTest_Kind, {"schema", "document"});
+    const JsonCacheKey other_key = JsonCache_ComputeKey(JsonCacheTest_Kind, {"schema", "document2"});
+    JsonCacheWriter writer(2);
+    JsonCache cache;
+
+    writer.AddRecord({writer.AddString("key"), writer.AddString("value")});
+
+    EXPECT_FALSE(cache.Open(path.parent_path() / "missing.bin", JsonCacheTest_Kind, key, 2));
+
+    ASSERT_TRUE(writer.Write(path, JsonCacheTest_Kind, key));
+
+    EXPECT_TRUE(cache.Open(path, JsonCacheTest_Kind, key, 2));
+    EXPECT_FALSE(cache.Open(path, JsonCacheTest_Kind, other_key, 2));
+    EXPECT_FALSE(cache.Open(path, JsonCacheTest_Kind + 1, key, 2));
+    EXPECT_FALSE(cache.Open(path, JsonCacheTest_Kind, key, 3));
+    EXPECT_EQ(cache.GetRecordCount(), 0u);
+
+    // a file that lost its last byte has an unterminated string table and a size mismatch
+    JsonCacheTest_Truncate(path, 1);
+
+    EXPECT_FALSE(cache.Open(path, JsonCacheTest_Kind, key, 2));
+
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+        file << "MXJC";
+    }
+
+    EXPECT_FALSE(cache.Open(path, JsonCacheTest_Kind, key, 2));
+}
+
+TEST(JsonCache, KeyCoversEverySource) {
+    const JsonCacheKey key = JsonCache_ComputeKey(JsonCacheTest_Kind, {"ab", "c"});
+
+    EXPECT_EQ(key, JsonCache_ComputeKey(JsonCacheTest_Kind, {"ab", "c"}));
+    EXPECT_NE(key, JsonCache_ComputeKey(JsonCacheTest_Kind, {"a", "bc"}));
+    EXPECT_NE(key, JsonCache_ComputeKey(JsonCacheTest_Kind, {"ab", "d"}));
+    EXPECT_NE(key, JsonCache_ComputeKey(JsonCacheTest_Kind + 1, {"ab", "c"}));
+}
@@ -0,0 +1,130 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "maptilecache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+static constexpr uint32_t TEST_TILE_SIZE = 64;
+static constexpr uint32_t TEST_TILE_COUNT = 40;
+
+static std::vector<uint8_t> MakeTestTiles() {
+    std::vector<uint8_t> tiles(TEST_TILE_COUNT * TEST_TILE_SIZE * TEST_TILE_SIZE);
+
+    for (size_t i = 0; i < tiles.size(); ++i) {
+        tiles[i] = static_cast<uint8_t>((i * 7) ^ (i >> 6));
+    }
+
+    return tiles;
+}
+
+static std::array<uint8_t, 256> MakeTestColorTable(const uint8_t shift) {
+    std::array<uint8_t, 256> table;
+
+    for (size_t i = 0; i < table.size(); ++i) {
+        table[i] = static_cast<uint8_t>(i + shift);
+    }
+
+    return table;
+}
+
+TEST(MapTileCache, MatchesResampling) {
+    const auto tiles = MakeTestTiles();
+    const auto color_table = MakeTestColorTable(3);
+    MapTileCache cache(1024 * 1024);
+
+    for (uint32_t zoom_level : {4u, 17u, 32u, 45u, 64u}) {
+        const uint32_t zoom_factor = (((TEST_TILE_SIZE - 1) << 16) / (zoom_level - 1)) + 8;
+
+        for (uint32_t tile_id = 0; tile_id < TEST_TILE_COUNT; tile_id += 7) {
+            const uint8_t* scaled =
+                cache.GetTile(tiles.data(), TEST_TILE_COUNT, tile_id, TEST_TILE_SIZE, zoom_level, color_table.data());
+            const uint8_t* source = &tiles[tile_id * TEST_TILE_SIZE * TEST_TILE_SIZE];
+
+            for (uint32_t y = 0; y < zoom_level; ++y) {
+                for (uint32_t x = 0; x < zoom_level; ++x) {
+                    const uint8_t expected =
+                        color_table[source[((y * zoom_factor) >> 16) * TEST_TILE_SIZE + ((x * zoom_factor) >> 16)]];
+
+                    ASSERT_EQ(scaled[y * zoom_level + x], expected) << zoom_level << " " << tile_id;
+                }
+            }
+        }
+    }
+}
+
+TEST(MapTileCache, LeastRecentlyUsedEviction) {
+    const auto tiles = MakeTestTiles();
+    const auto color_table = MakeTestColorTable(0);
+    constexpr uint32_t zoom_level = 32;
+    MapTileCache cache(3 * zoom_level * zoom_level);
+
+    EXPECT_NE(cache.GetTile(tiles.data(), TEST_TILE_COUNT, 0, TEST_TILE_SIZE, zoom_level, color_table.data()), nullptr);
+    EXPECT_EQ(cache.GetCapacity(), 3);
+
+    (void)cache.GetTile(tiles.data(), TEST_TILE_COUNT, 1, TEST_TILE_SIZE, zoom_level, color_table.data());
+    (void)cache.GetTile(tiles.data(), TEST_TILE_COUNT, 2, TEST_TILE_SIZE, zoom_level, color_table.data());
+    (void)cache.GetTile(tiles.data(), TEST_TILE_COUNT, 0, TEST_TILE_SIZE, zoom_level, color_table.data());
+
+    EXPECT_EQ(cache.GetStatistics().misses, 3);
+    EXPECT_EQ(cache.GetStatistics().hits, 1);
+
+    // tile 1 is the least recently used one now
+    (void)cache.GetTile(tiles.data(), TEST_TILE_COUNT, 3, TEST_TILE_SIZE, zoom_level, color_table.data());
+    (void)cache.GetTile(tiles.data(), TEST_TILE_COUNT, 0, TEST_TILE_SIZE, zoom_level, color_table.data());
+    (void)cache.GetTile(tiles.data(), TEST_TILE_COUNT, 2, TEST_TILE_SIZE, zoom_level, color_table.data());
+
+    EXPECT_EQ(cache.GetStatistics().evictions, 1);
+    EXPECT_EQ(cache.GetStatistics().hits, 3);
+
+    (void)cache.GetTile(tiles.data(), TEST_TILE_COUNT, 1, TEST_TILE_SIZE, zoom_level, color_table.data());
+
+    EXPECT_EQ(cache.GetStatistics().misses, 5);
+    EXPECT_EQ(cache.GetStatistics().evictions, 2);
+}
+
+TEST(MapTileCache, Invalidation) {
+    const auto tiles = MakeTestTiles();
+    const auto dark_table = MakeTestColorTable(0);
+    const auto bright_table = MakeTestColorTable(100);
+    MapTileCache cache(1024 * 1024);
+
+    const uint8_t dark = cache.GetTile(tiles.data(), TEST_TILE_COUNT, 5, TEST_TILE_SIZE, 16, dark_table.data())[0];
+    const uint8_t bright = cache.GetTile(tiles.data(), TEST_TILE_COUNT, 5, TEST_TILE_SIZE, 16, bright_table.data())[0];
+
+    EXPECT_EQ(static_cast<uint8_t>(dark + 100), bright);
+    EXPECT_EQ(cache.GetStatistics().hits, 0);
+
+    (void)cache.GetTile(tiles.data(), TEST_TILE_COUNT, 5, TEST_TILE_SIZE, 20, bright_table.data());
+    (void)cache.GetTile(tiles.data(), TEST_TILE_COUNT, 5, TEST_TILE_SIZE, 20, bright_table.data());
+
+    EXPECT_EQ(cache.GetStatistics().hits, 1);
+
+    cache.Invalidate();
+
+    (void)cache.GetTile(tiles.data(), TEST_TILE_COUNT, 5, TEST_TILE_SIZE, 20, bright_table.data());
+
+    EXPECT_EQ(cache.GetStatistics().hits, 1);
+    EXPECT_EQ(cache.GetStatistics().invalidations, 4);
+}
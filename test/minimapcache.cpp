@@ -0,0 +1,145 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "minimapcache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "minimapreference.hpp"
+
+static bool CoveredAreaMatches(const MinimapCache& cache, const std::vector<uint8_t>& reference) {
+    for (int32_t y = 0; y < cache.GetCoveredHeight(); ++y) {
+        for (int32_t x = 0; x < cache.GetCoveredWidth(); ++x) {
+            if (cache.GetPixels()[y * cache.GetPitch() + x] != reference[y * cache.GetTargetWidth() + x]) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+TEST(MinimapCache, MatchesFullRecomposition) {
+    struct Size {
+        int32_t map_width;
+        int32_t map_height;
+        int32_t target_width;
+        int32_t target_height;
+    };
+
+    const Size sizes[] = {{112, 112, 112, 112}, {112, 112, 220, 224}, {64, 48, 224, 224}, {150, 120, 224, 224}};
+
+    for (const auto& size : sizes) {
+        MinimapCache cache;
+        std::vector<uint8_t> base(size.map_width * size.map_height);
+        std::vector<TestDot> dots;
+        uint32_t seed = 12345;
+
+        const auto random = [&seed](uint32_t range) {
+            seed = seed * 1103515245u + 12345u;
+
+            return (seed >> 8) % range;
+        };
+
+        for (auto& color : base) {
+            color = static_cast<uint8_t>(16 + random(64));
+        }
+
+        cache.Configure(size.map_width, size.map_height, size.target_width, size.target_height);
+
+        ASSERT_LE(cache.GetCoveredWidth(), size.target_width);
+        ASSERT_LE(cache.GetCoveredHeight(), size.target_height);
+
+        for (int32_t frame = 0; frame < 50; ++frame) {
+            const uint32_t flips = random(40);
+
+            for (uint32_t i = 0; i < flips; ++i) {
+                const uint32_t cell = random(base.size());
+
+                base[cell] ^= 0x80;
+                cache.InvalidateCell(cell);
+            }
+
+            if (frame % 3 == 0) {
+                dots.clear();
+                cache.ClearUnitDots();
+
+                const uint32_t dot_count = random(30);
+
+                for (uint32_t i = 0; i < dot_count; ++i) {
+                    const TestDot dot{static_cast<int32_t>(random(size.map_width)),
+                                      static_cast<int32_t>(random(size.map_height)),
+                                      static_cast<int32_t>(1 + random(2)), static_cast<uint8_t>(1 + random(4))};
+
+                    dots.push_back(dot);
+                    cache.AddUnitDot(dot.grid_x, dot.grid_y, dot.size, dot.color);
+                }
+            }
+
+            cache.Compose(base.data());
+
+            ASSERT_TRUE(CoveredAreaMatches(cache, ReferenceMinimap(base, dots, size.map_width, size.map_height,
+                                                                   size.target_width, size.target_height)))
+                << size.map_width << "x" << size.map_height << " frame " << frame;
+        }
+
+        EXPECT_EQ(cache.GetStatistics().full_rebuilds, 1u);
+    }
+}
+
+TEST(MinimapCache, RedrawsOnlyChangedCells) {
+    MinimapCache cache;
+    std::vector<uint8_t> base(64 * 64, 20);
+
+    cache.Configure(64, 64, 128, 128);
+    cache.AddUnitDot(10, 10, 2, 1);
+    cache.Compose(base.data());
+
+    const uint64_t initial = cache.GetStatistics().redrawn_cells;
+
+    EXPECT_EQ(initial, base.size());
+
+    // an unchanged dot layer and a base cell that was reported but kept its color redraw nothing
+    cache.ClearUnitDots();
+    cache.AddUnitDot(10, 10, 2, 1);
+    cache.InvalidateCell(0);
+    cache.Compose(base.data());
+
+    EXPECT_EQ(cache.GetStatistics().redrawn_cells, initial);
+
+    // moving the dot one cell to the right uncovers one column and covers another
+    cache.ClearUnitDots();
+    cache.AddUnitDot(11, 10, 2, 1);
+    cache.Compose(base.data());
+
+    EXPECT_EQ(cache.GetStatistics().redrawn_cells, initial + 4);
+    EXPECT_EQ(cache.GetPixels()[20 * 128 + 20], 20);
+    EXPECT_EQ(cache.GetPixels()[20 * 128 + 22], 1);
+
+    // a new target size redraws every cell but keeps the dots
+    cache.Configure(64, 64, 64, 64);
+    cache.Compose(base.data());
+
+    EXPECT_EQ(cache.GetStatistics().full_rebuilds, 2u);
+    EXPECT_EQ(cache.GetPixels()[10 * 64 + 12], 1);
+}
@@ -0,0 +1,72 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MINIMAPREFERENCE_HPP
+#define MINIMAPREFERENCE_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+struct TestDot {
+    int32_t grid_x;
+    int32_t grid_y;
+    int32_t size;
+    uint8_t color;
+};
+
+/* composes the layers at map resolution and scales them with the cscale() loop, the former full redraw */
+inline std::vector<uint8_t> ReferenceMinimap(const std::vector<uint8_t>& base, const std::vector<TestDot>& dots,
+                                             int32_t ow, int32_t ol, int32_t nw, int32_t nl) {
+    std::vector<uint8_t> map = base;
+    std::vector<uint8_t> target(nw * nl, 0);
+
+    for (const auto& dot : dots) {
+        for (int32_t y = dot.grid_y; y < std::min(dot.grid_y + dot.size, ol); ++y) {
+            for (int32_t x = dot.grid_x; x < std::min(dot.grid_x + dot.size, ow); ++x) {
+                map[y * ow + x] = dot.color;
+            }
+        }
+    }
+
+    const int32_t my = (nl << 16) / ol;
+    const int32_t mx = (nw << 16) / ow;
+
+    for (int32_t srcy = 0; srcy < ol; srcy++) {
+        uint32_t sx_preshift = 0;
+        uint32_t ex_preshift = mx;
+
+        for (int32_t srcx = 0; srcx < ow; srcx++) {
+            for (int32_t desty = my * srcy >> 16; desty < ((my + my * srcy) >> 16); desty++) {
+                for (uint32_t destx = sx_preshift >> 16; destx < (ex_preshift >> 16); destx++) {
+                    target[desty * nw + destx] = map[srcy * ow + srcx];
+                }
+            }
+
+            sx_preshift += mx;
+            ex_preshift += mx;
+        }
+    }
+
+    return target;
+}
+
+#endif /* MINIMAPREFERENCE_HPP */
@@ -0,0 +1,129 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "objectpool.hpp"
+
+#include <gtest/gtest.h>
+
+#include "testobject.hpp"
+
+class TestPooledObject : public TestObject {
+    uint8_t payload[40];
+
+public:
+    explicit TestPooledObject(uint32_t* status) : TestObject(status), payload{} {}
+
+    OBJECTPOOL_DECLARE_ALLOCATOR();
+};
+
+OBJECTPOOL_DEFINE_ALLOCATOR(TestPooledObject)
+
+TEST(ObjectPool, Recycle) {
+    ObjectPool& pool = ObjectPool::Create("Recycle");
+    void* first = pool.Allocate(48);
+    void* second = pool.Allocate(48);
+
+    EXPECT_NE(first, nullptr);
+    EXPECT_NE(second, nullptr);
+    EXPECT_NE(first, second);
+
+    pool.Release(first, 48);
+
+    void* third = pool.Allocate(48);
+
+    EXPECT_EQ(third, first);
+
+    const ObjectPoolStatistics statistics = pool.GetStatistics();
+
+    EXPECT_EQ(statistics.allocations, 3);
+    EXPECT_EQ(statistics.recycled_allocations, 2);
+    EXPECT_EQ(statistics.releases, 1);
+    EXPECT_EQ(statistics.slabs, 1);
+    EXPECT_EQ(statistics.live_objects, 2);
+    EXPECT_EQ(statistics.peak_live_objects, 2);
+
+    pool.Release(second, 48);
+    pool.Release(third, 48);
+
+    EXPECT_EQ(pool.GetStatistics().live_objects, 0);
+}
+
+TEST(ObjectPool, SizeClasses) {
+    ObjectPool& pool = ObjectPool::Create("SizeClasses");
+    void* small = pool.Allocate(16);
+
+    pool.Release(small, 16);
+
+    void* large = pool.Allocate(64);
+
+    EXPECT_NE(large, small);
+    EXPECT_EQ(pool.GetStatistics().slabs, 2);
+
+    void* huge = pool.Allocate(64 * 1024);
+
+    EXPECT_NE(huge, nullptr);
+    EXPECT_EQ(pool.GetStatistics().heap_allocations, 1);
+
+    pool.Release(huge, 64 * 1024);
+    pool.Release(large, 64);
+}
+
+TEST(ObjectPool, TurnStatistics) {
+    ObjectPool& pool = ObjectPool::Create("TurnStatistics");
+    void* first = pool.Allocate(32);
+
+    ObjectPool::ResetTurnStatistics();
+
+    EXPECT_EQ(pool.GetTurnStatistics().allocations, 0);
+    EXPECT_EQ(pool.GetTurnStatistics().live_objects, 1);
+
+    void* second = pool.Allocate(32);
+
+    pool.Release(first, 32);
+
+    const ObjectPoolStatistics statistics = pool.GetTurnStatistics();
+
+    EXPECT_EQ(statistics.allocations, 1);
+    EXPECT_EQ(statistics.releases, 1);
+    EXPECT_EQ(statistics.slabs, 0);
+    EXPECT_EQ(statistics.peak_live_objects, 2);
+
+    pool.Release(second, 32);
+}
+
+TEST(ObjectPool, SmartPointerRelease) {
+    uint32_t status{TEST_CLASS_UNDEFINED};
+    TestPooledObject* object = new (std::nothrow) TestPooledObject(&status);
+
+    {
+        SmartPointer<TestObject> sp(object);
+
+        EXPECT_EQ(status, TEST_CLASS_CONSTRUCTED);
+        EXPECT_EQ(TestPooledObject_GetObjectPool().GetStatistics().live_objects, 1);
+    }
+
+    EXPECT_EQ(status, TEST_CLASS_DESTRUCTED);
+    EXPECT_EQ(TestPooledObject_GetObjectPool().GetStatistics().live_objects, 0);
+
+    SmartPointer<TestObject> recycled(new (std::nothrow) TestPooledObject(&status));
+
+    EXPECT_EQ(recycled.Get(), object);
+}
@@ -0,0 +1,143 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "paletteregiontracker.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+static constexpr int32_t TEST_WIDTH = 200;
+static constexpr int32_t TEST_HEIGHT = 130;
+static constexpr uint8_t TEST_BACKGROUND = 1;
+static constexpr uint8_t TEST_CYCLED = 100;
+
+class PaletteRegionTrackerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        pixels.assign(TEST_WIDTH * TEST_HEIGHT, TEST_BACKGROUND);
+        tracker.Resize(TEST_WIDTH, TEST_HEIGHT);
+    }
+
+    void Collect() { tracker.CollectChangedRegions(pixels.data(), TEST_WIDTH, regions); }
+
+    void ExpectRegion(size_t index, int32_t x, int32_t y, int32_t width, int32_t height) {
+        ASSERT_LT(index, regions.size());
+        EXPECT_EQ(regions[index].x, x);
+        EXPECT_EQ(regions[index].y, y);
+        EXPECT_EQ(regions[index].width, width);
+        EXPECT_EQ(regions[index].height, height);
+    }
+
+    std::vector<uint8_t> pixels;
+    std::vector<PaletteRegion> regions;
+    PaletteRegionTracker tracker;
+};
+
+TEST_F(PaletteRegionTrackerTest, FullRefreshAfterResize) {
+    EXPECT_TRUE(tracker.HasChangedColors());
+
+    Collect();
+
+    ASSERT_EQ(regions.size(), 1u);
+    ExpectRegion(0, 0, 0, TEST_WIDTH, TEST_HEIGHT);
+    EXPECT_FALSE(tracker.HasChangedColors());
+
+    Collect();
+
+    EXPECT_TRUE(regions.empty());
+}
+
+TEST_F(PaletteRegionTrackerTest, OnlyTilesWithChangedColors) {
+    Collect();
+
+    pixels[10 * TEST_WIDTH + 70] = TEST_CYCLED;
+    pixels[129 * TEST_WIDTH + 199] = TEST_CYCLED;
+    pixels[100 * TEST_WIDTH + 5] = TEST_CYCLED;
+    pixels[70 * TEST_WIDTH + 127] = TEST_CYCLED;
+
+    tracker.InvalidatePixels(0, 0, TEST_WIDTH, TEST_HEIGHT);
+    tracker.MarkColorChanged(TEST_CYCLED);
+
+    Collect();
+
+    // redrawn tiles are refreshed without a scan
+    ASSERT_EQ(regions.size(), 1u);
+    ExpectRegion(0, 0, 0, TEST_WIDTH, TEST_HEIGHT);
+
+    tracker.MarkColorChanged(TEST_CYCLED);
+
+    Collect();
+
+    // the two affected tiles of the middle tile row are merged into one span, edge tiles are clipped to the frame
+    ASSERT_EQ(regions.size(), 3u);
+    ExpectRegion(0, 64, 0, 64, 64);
+    ExpectRegion(1, 0, 64, 128, 64);
+    ExpectRegion(2, 192, 128, 8, 2);
+
+    tracker.MarkColorChanged(TEST_CYCLED + 1);
+
+    Collect();
+
+    EXPECT_TRUE(regions.empty());
+}
+
+TEST_F(PaletteRegionTrackerTest, RescansInvalidatedTilesOnly) {
+    pixels[10 * TEST_WIDTH + 70] = TEST_CYCLED;
+
+    Collect();
+
+    tracker.MarkColorChanged(TEST_BACKGROUND);
+
+    Collect();
+
+    // overwritten without invalidation, the tile still reports the cached color set
+    pixels[10 * TEST_WIDTH + 70] = TEST_BACKGROUND;
+    tracker.MarkColorChanged(TEST_CYCLED);
+
+    Collect();
+
+    ASSERT_EQ(regions.size(), 1u);
+    ExpectRegion(0, 64, 0, 64, 64);
+
+    tracker.InvalidatePixels(70, 10, 1, 1);
+    tracker.MarkColorChanged(TEST_CYCLED);
+
+    Collect();
+
+    ASSERT_EQ(regions.size(), 1u);
+    ExpectRegion(0, 64, 0, 64, 64);
+
+    tracker.MarkColorChanged(TEST_CYCLED);
+
+    Collect();
+
+    EXPECT_TRUE(regions.empty());
+
+    tracker.InvalidatePixels(-50, -50, 10, 10);
+    tracker.InvalidatePixels(TEST_WIDTH, 0, 10, 10);
+    tracker.MarkColorChanged(TEST_BACKGROUND);
+
+    Collect();
+
+    ASSERT_EQ(regions.size(), 1u);
+    ExpectRegion(0, 0, 0, TEST_WIDTH, TEST_HEIGHT);
+}
@@ -0,0 +1,72 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "pixelconvert.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+static std::vector<uint32_t> MakeTestColorTable() {
+    std::vector<uint32_t> table(256);
+
+    for (uint32_t i = 0; i < table.size(); ++i) {
+        table[i] = 0xFF000000 | ((i * 0x010203) ^ (i << 17));
+    }
+
+    return table;
+}
+
+TEST(PixelConvert, MatchesTableLookup) {
+    const auto color_table = MakeTestColorTable();
+    constexpr int32_t source_pitch = 67;
+    constexpr int32_t target_pitch = 71 * sizeof(uint32_t);
+    constexpr int32_t height = 5;
+    constexpr uint32_t guard = 0xDEADBEEF;
+
+    std::vector<uint8_t> source(source_pitch * height);
+
+    for (size_t i = 0; i < source.size(); ++i) {
+        source[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+
+    for (int32_t offset = 0; offset < 3; ++offset) {
+        for (int32_t width = 0; width <= 64; ++width) {
+            std::vector<uint32_t> target(target_pitch / sizeof(uint32_t) * height, guard);
+
+            PixelConvert_Index8ToRgb32(&source[offset], source_pitch, &target[offset], target_pitch, width, height,
+                                       color_table.data());
+
+            for (int32_t y = 0; y < height; ++y) {
+                for (int32_t x = 0; x < target_pitch / static_cast<int32_t>(sizeof(uint32_t)); ++x) {
+                    const uint32_t pixel = target[y * target_pitch / sizeof(uint32_t) + x];
+
+                    if (x >= offset && x < offset + width) {
+                        ASSERT_EQ(pixel, color_table[source[y * source_pitch + x]]) << width << " " << x << " " << y;
+
+                    } else {
+                        ASSERT_EQ(pixel, guard) << width << " " << x << " " << y;
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,122 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "resourcearchive.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+static std::vector<uint8_t> WriteTestArchive(const std::string& file_path, size_t size) {
+    std::vector<uint8_t> contents(size);
+    uint32_t seed = 12345;
+
+    for (auto& byte : contents) {
+        seed = seed * 1103515245u + 12345u;
+        byte = static_cast<uint8_t>(seed >> 16);
+    }
+
+    FILE* fp = fopen(file_path.c_str(), "wb");
+
+    EXPECT_NE(fp, nullptr);
+
+    if (fp) {
+        EXPECT_EQ(fwrite(contents.data(), contents.size(), 1, fp), 1u);
+        fclose(fp);
+    }
+
+    return contents;
+}
+
+TEST(ResourceArchive, ViewsMatchFileContents) {
+    const std::string file_path = testing::TempDir() + "resourcearchive.res";
+    const std::vector<uint8_t> contents = WriteTestArchive(file_path, 100000);
+    ResourceArchive archive;
+
+    EXPECT_FALSE(archive.Open(testing::TempDir() + "missing.res"));
+    EXPECT_FALSE(archive.IsOpen());
+
+    ASSERT_TRUE(archive.Open(file_path));
+    ASSERT_EQ(archive.GetSize(), contents.size());
+
+    const uint8_t* view = archive.GetData(1000, 5000);
+
+    ASSERT_NE(view, nullptr);
+    EXPECT_EQ(memcmp(view, &contents[1000], 5000), 0);
+
+    EXPECT_NE(archive.GetData(contents.size() - 10, 10), nullptr);
+    EXPECT_EQ(archive.GetData(contents.size() - 10, 11), nullptr);
+    EXPECT_EQ(archive.GetData(contents.size() + 1, 0), nullptr);
+    EXPECT_EQ(archive.GetData(SIZE_MAX, 2), nullptr);
+
+    uint8_t buffer[64];
+
+    ASSERT_TRUE(archive.Read(contents.size() - sizeof(buffer), buffer, sizeof(buffer)));
+    EXPECT_EQ(memcmp(buffer, &contents[contents.size() - sizeof(buffer)], sizeof(buffer)), 0);
+    EXPECT_FALSE(archive.Read(contents.size() - sizeof(buffer) + 1, buffer, sizeof(buffer)));
+
+    archive.Close();
+
+    EXPECT_FALSE(archive.IsOpen());
+    EXPECT_EQ(archive.GetData(0, 1), nullptr);
+
+    std::remove(file_path.c_str());
+}
+
+TEST(ResourceArchive, ConcurrentReads) {
+    const std::string file_path = testing::TempDir() + "resourcearchive_threads.res";
+    const std::vector<uint8_t> contents = WriteTestArchive(file_path, 1 << 20);
+    ResourceArchive archive;
+
+    ASSERT_TRUE(archive.Open(file_path));
+
+    std::vector<std::thread> threads;
+    std::vector<int32_t> mismatches(4, 0);
+
+    for (size_t i = 0; i < mismatches.size(); ++i) {
+        threads.emplace_back([&archive, &contents, &mismatches, i]() {
+            std::vector<uint8_t> buffer(4096);
+
+            for (size_t offset = i * 512; offset + buffer.size() <= contents.size(); offset += 3001) {
+                if (!archive.Read(offset, buffer.data(), buffer.size()) ||
+                    memcmp(buffer.data(), &contents[offset], buffer.size()) != 0) {
+                    ++mismatches[i];
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const int32_t count : mismatches) {
+        EXPECT_EQ(count, 0);
+    }
+
+    archive.Close();
+
+    std::remove(file_path.c_str());
+}
@@ -0,0 +1,143 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "resourceloader.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+static uint8_t* LoadTestResource(uint32_t id) {
+    uint8_t* buffer = new uint8_t[4];
+
+    buffer[0] = static_cast<uint8_t>(id);
+    buffer[1] = static_cast<uint8_t>(id >> 8);
+    buffer[2] = 0xA5;
+    buffer[3] = 0x5A;
+
+    return buffer;
+}
+
+TEST(ResourceLoader, ClaimsPrefetchedResources) {
+    ResourceLoader loader(100, LoadTestResource);
+    uint8_t* buffer = nullptr;
+
+    EXPECT_FALSE(loader.Prefetch(1));
+    EXPECT_FALSE(loader.Claim(1, &buffer));
+
+    ASSERT_TRUE(loader.Start());
+
+    for (uint32_t id = 0; id < 100; id += 2) {
+        EXPECT_TRUE(loader.Prefetch(id));
+    }
+
+    EXPECT_FALSE(loader.Prefetch(0));
+    EXPECT_FALSE(loader.Prefetch(100));
+
+    // resources that were never prefetched are left to the caller
+    EXPECT_FALSE(loader.Claim(1, &buffer));
+
+    for (uint32_t id = 0; id < 100; id += 2) {
+        if (loader.Claim(id, &buffer)) {
+            EXPECT_EQ(buffer[0], id);
+            EXPECT_EQ(buffer[2], 0xA5);
+
+            delete[] buffer;
+        }
+
+        EXPECT_FALSE(loader.Claim(id, &buffer));
+    }
+
+    const ResourceLoaderStatistics statistics = loader.GetStatistics();
+
+    EXPECT_EQ(statistics.requests, 50u);
+    EXPECT_EQ(statistics.ready_claims + statistics.waited_claims + statistics.cancellations, 50u);
+    EXPECT_EQ(loader.GetPendingCount(), 0u);
+}
+
+TEST(ResourceLoader, WaitsForResourceInProgress) {
+    std::atomic<bool> release{false};
+    std::atomic<bool> started{false};
+    ResourceLoader loader(4, [&release, &started](uint32_t id) -> uint8_t* {
+        started = true;
+
+        while (!release) {
+            std::this_thread::yield();
+        }
+
+        return LoadTestResource(id);
+    });
+    uint8_t* buffer = nullptr;
+
+    ASSERT_TRUE(loader.Start());
+    ASSERT_TRUE(loader.Prefetch(2));
+    ASSERT_TRUE(loader.Prefetch(3));
+
+    while (!started) {
+        std::this_thread::yield();
+    }
+
+    // 3 waits behind 2 in the queue, the claim withdraws it instead of waiting
+    EXPECT_FALSE(loader.Claim(3, &buffer));
+
+    std::thread releaser([&release]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        release = true;
+    });
+
+    ASSERT_TRUE(loader.Claim(2, &buffer));
+
+    releaser.join();
+
+    EXPECT_EQ(buffer[0], 2);
+
+    delete[] buffer;
+
+    const ResourceLoaderStatistics statistics = loader.GetStatistics();
+
+    EXPECT_EQ(statistics.waited_claims, 1u);
+    EXPECT_EQ(statistics.cancellations, 1u);
+
+    // a withdrawn resource can be requested again
+    EXPECT_TRUE(loader.Prefetch(3));
+
+    loader.Stop();
+
+    EXPECT_FALSE(loader.Claim(3, &buffer));
+}
+
+TEST(ResourceLoader, FailedLoadsFallBackToCaller) {
+    ResourceLoader loader(4, [](uint32_t) -> uint8_t* { return nullptr; });
+    uint8_t* buffer = nullptr;
+
+    ASSERT_TRUE(loader.Start());
+    ASSERT_TRUE(loader.Prefetch(1));
+
+    while (loader.GetStatistics().loads == 0) {
+        std::this_thread::yield();
+    }
+
+    EXPECT_FALSE(loader.Claim(1, &buffer));
+    EXPECT_TRUE(loader.Prefetch(1));
+}
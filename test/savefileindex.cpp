@@ -0,0 +1,172 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "savefileindex.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+class SaveFileIndexTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        directory = std::filesystem::path(testing::TempDir()) / "savefileindex";
+        index_path = directory / "cache" / "saves.idx";
+
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(directory); }
+
+public:
+    std::filesystem::path directory;
+    std::filesystem::path index_path;
+};
+
+static void SaveFileIndexTest_WriteFile(const std::filesystem::path& path, size_t size) {
+    FILE* fp = fopen(path.string().c_str(), "wb");
+
+    ASSERT_NE(fp, nullptr);
+
+    const std::vector<uint8_t> contents(size, 0x42);
+
+    EXPECT_EQ(fwrite(contents.data(), contents.size(), 1, fp), 1u);
+    fclose(fp);
+}
+
+TEST_F(SaveFileIndexTest, ValidatesStamps) {
+    const auto save_path = directory / "save1.dta";
+    const std::vector<uint8_t> summary = {1, 2, 3, 4};
+    std::vector<uint8_t> summary_readback;
+
+    SaveFileIndexTest_WriteFile(save_path, 100);
+
+    {
+        SaveFileIndex index(index_path, 1);
+
+        EXPECT_FALSE(index.Find(save_path, summary_readback));
+
+        index.Update(save_path, std::vector<uint8_t>(summary));
+
+        EXPECT_TRUE(index.Find(save_path, summary_readback));
+        EXPECT_EQ(summary_readback, summary);
+
+        // files that do not exist are not indexed
+        index.Update(directory / "missing.dta", std::vector<uint8_t>(summary));
+
+        EXPECT_EQ(index.GetEntryCount(), 1u);
+        EXPECT_TRUE(index.Flush());
+        EXPECT_TRUE(std::filesystem::exists(index_path));
+    }
+
+    // the records survive in the index file
+    {
+        SaveFileIndex index(index_path, 1);
+
+        summary_readback.clear();
+
+        EXPECT_TRUE(index.Find(save_path, summary_readback));
+        EXPECT_EQ(summary_readback, summary);
+    }
+
+    // a different summary layout discards the records
+    {
+        SaveFileIndex index(index_path, 2);
+
+        EXPECT_FALSE(index.Find(save_path, summary_readback));
+    }
+
+    // a replaced save file needs to be read again
+    SaveFileIndexTest_WriteFile(save_path, 101);
+
+    {
+        SaveFileIndex index(index_path, 1);
+
+        EXPECT_FALSE(index.Find(save_path, summary_readback));
+        EXPECT_EQ(index.GetEntryCount(), 0u);
+        EXPECT_TRUE(index.Flush());
+    }
+
+    {
+        SaveFileIndex index(index_path, 1);
+
+        EXPECT_FALSE(index.Find(save_path, summary_readback));
+        EXPECT_EQ(index.GetEntryCount(), 0u);
+    }
+}
+
+TEST_F(SaveFileIndexTest, RejectsDamagedIndex) {
+    const auto save_path = directory / "save1.dta";
+    std::vector<uint8_t> summary_readback;
+
+    SaveFileIndexTest_WriteFile(save_path, 100);
+
+    {
+        SaveFileIndex index(index_path, 1);
+
+        index.Update(save_path, {9, 9, 9});
+
+        EXPECT_TRUE(index.Flush());
+    }
+
+    std::filesystem::resize_file(index_path, std::filesystem::file_size(index_path) - 2);
+
+    SaveFileIndex index(index_path, 1);
+
+    EXPECT_FALSE(index.Find(save_path, summary_readback));
+    EXPECT_EQ(index.GetEntryCount(), 0u);
+}
+
+TEST_F(SaveFileIndexTest, IndexesEverySlot) {
+    constexpr uint32_t slot_count = 10;
+    std::vector<std::filesystem::path> save_paths;
+
+    for (uint32_t i = 0; i < slot_count; ++i) {
+        save_paths.push_back(directory / ("save" + std::to_string(i) + ".dta"));
+
+        SaveFileIndexTest_WriteFile(save_paths.back(), 100 + i);
+    }
+
+    {
+        SaveFileIndex index(index_path, 1);
+
+        for (uint32_t i = 0; i < slot_count; ++i) {
+            const std::string save_name = "Save game " + std::to_string(i);
+
+            index.Update(save_paths[i], std::vector<uint8_t>(save_name.begin(), save_name.end()));
+        }
+
+        EXPECT_TRUE(index.Flush());
+    }
+
+    SaveFileIndex index(index_path, 1);
+    std::vector<uint8_t> summary;
+
+    for (uint32_t i = 0; i < slot_count; ++i) {
+        EXPECT_TRUE(index.Find(save_paths[i], summary));
+        EXPECT_EQ(std::string(summary.begin(), summary.end()), "Save game " + std::to_string(i));
+    }
+
+    EXPECT_EQ(index.GetEntryCount(), slot_count);
+}
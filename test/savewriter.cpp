@@ -0,0 +1,162 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "savewriter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "smartfile.hpp"
+
+class SaveWriterTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        file_path = testing::TempDir() + "savewriter.dat";
+        std::filesystem::remove(file_path);
+    }
+
+    void TearDown() override { std::filesystem::remove(file_path); }
+
+public:
+    std::filesystem::path file_path;
+};
+
+/* per cell arrays of a late game are mostly zero */
+static std::vector<uint32_t> SaveWriterTest_MakeHeatMaps(uint32_t seed) {
+    std::vector<uint32_t> heat_maps(4 * 112 * 112 * 3);
+
+    for (auto& counter : heat_maps) {
+        seed = seed * 1103515245u + 12345u;
+        counter = (seed >> 28) == 0 ? (seed >> 8) % 5 : 0;
+    }
+
+    return heat_maps;
+}
+
+static std::vector<uint8_t> SaveWriterTest_Serialize(uint32_t seed) {
+    const auto heat_maps = SaveWriterTest_MakeHeatMaps(seed);
+    const uint32_t version = static_cast<uint32_t>(SmartFileFormat::LATEST);
+    std::vector<uint8_t> stream;
+    SmartFileWriter writer;
+
+    EXPECT_TRUE(writer.Open(stream));
+    EXPECT_TRUE(writer.Write(&version, sizeof(version)));
+    EXPECT_TRUE(writer.Write(heat_maps.data(), heat_maps.size() * sizeof(uint32_t)));
+    EXPECT_TRUE(writer.Close());
+
+    return stream;
+}
+
+static std::vector<uint8_t> SaveWriterTest_ReadBack(const std::filesystem::path& path, size_t size) {
+    std::vector<uint8_t> contents(size);
+    SmartFileReader reader;
+
+    EXPECT_TRUE(reader.Open(path.string()));
+    EXPECT_EQ(reader.GetFormat(), SmartFileFormat::V72);
+    EXPECT_TRUE(reader.Read(contents.data(), contents.size()));
+
+    return contents;
+}
+
+TEST_F(SaveWriterTest, WritesInBackground) {
+    SaveWriter writer;
+    const auto first = SaveWriterTest_Serialize(1);
+    const auto second = SaveWriterTest_Serialize(2);
+
+    ASSERT_TRUE(writer.Start());
+
+    writer.Submit(file_path, std::vector<uint8_t>(first));
+
+    // a second save waits for the first one to leave the writer
+    writer.Submit(file_path, std::vector<uint8_t>(second));
+
+    EXPECT_TRUE(writer.Wait());
+    EXPECT_EQ(SaveWriterTest_ReadBack(file_path, second.size()), second);
+    EXPECT_FALSE(std::filesystem::exists(file_path.string() + ".tmp"));
+
+    // a pending save is still written when the thread is stopped
+    writer.Submit(file_path, std::vector<uint8_t>(first));
+    writer.Stop();
+
+    EXPECT_EQ(SaveWriterTest_ReadBack(file_path, first.size()), first);
+}
+
+TEST_F(SaveWriterTest, CommitsAfterWrite) {
+    SaveWriter writer;
+    const auto first = SaveWriterTest_Serialize(3);
+    const auto second = SaveWriterTest_Serialize(4);
+    auto backup_path = file_path;
+    bool is_committed = false;
+
+    backup_path += ".bak";
+
+    std::filesystem::remove(backup_path);
+
+    ASSERT_TRUE(SaveWriter::WriteFile(file_path, first, {}));
+    ASSERT_TRUE(writer.Start());
+
+    // the commit function sees the previous save in place, like the backup rotation of autosaves
+    writer.Submit(file_path, std::vector<uint8_t>(second), [&](const std::filesystem::path& path) {
+        is_committed = true;
+
+        EXPECT_EQ(SaveWriterTest_ReadBack(path, first.size()), first);
+
+        std::filesystem::rename(path, backup_path);
+    });
+
+    EXPECT_TRUE(writer.Wait());
+    EXPECT_TRUE(is_committed);
+    EXPECT_EQ(SaveWriterTest_ReadBack(file_path, second.size()), second);
+    EXPECT_EQ(SaveWriterTest_ReadBack(backup_path, first.size()), first);
+
+    std::filesystem::remove(backup_path);
+}
+
+TEST_F(SaveWriterTest, KeepsPreviousFileOnFailure) {
+    SaveWriter writer;
+    const auto first = SaveWriterTest_Serialize(5);
+    const auto missing_path = std::filesystem::path(testing::TempDir()) / "savewriter_missing" / "save.dat";
+
+    ASSERT_TRUE(SaveWriter::WriteFile(file_path, first, {}));
+    ASSERT_TRUE(writer.Start());
+
+    writer.Submit(missing_path, SaveWriterTest_Serialize(6));
+
+    EXPECT_FALSE(writer.Wait());
+    EXPECT_FALSE(std::filesystem::exists(missing_path));
+
+    // the temporary file cannot replace a directory, the failed rename must not leave it behind
+    const auto directory_path = std::filesystem::path(testing::TempDir()) / "savewriter_directory";
+
+    std::filesystem::create_directories(directory_path / "child");
+
+    writer.Submit(directory_path, SaveWriterTest_Serialize(7));
+
+    EXPECT_FALSE(writer.Wait());
+    EXPECT_TRUE(std::filesystem::is_directory(directory_path));
+    EXPECT_FALSE(std::filesystem::exists(directory_path.string() + ".tmp"));
+    EXPECT_EQ(SaveWriterTest_ReadBack(file_path, first.size()), first);
+
+    std::filesystem::remove_all(directory_path);
+}
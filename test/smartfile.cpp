@@ -23,6 +23,11 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
 #include "point.hpp"
 #include "registerarray.hpp"
 
@@ -154,3 +159,262 @@ TEST_F(SmartFileTest, ReadWrite) {
 
     EXPECT_EQ(object_readback == object_readback_copy, true);
 }
+
+TEST_F(SmartFileTest, ReadsEveryFormat) {
+    const uint16_t formats[] = {static_cast<uint16_t>(SmartFileFormat::V71),
+                                static_cast<uint16_t>(SmartFileFormat::V72)};
+    std::vector<uint8_t> buffer(300000);
+
+    for (size_t i = 0; i < buffer.size(); ++i) {
+        buffer[i] = static_cast<uint8_t>(i % 251);
+    }
+
+    for (const uint16_t format : formats) {
+        SmartPointer<TestSmartFileObject> object = dynamic_cast<TestSmartFileObject*>(TestSmartFileObject::Allocate());
+        const uint32_t version = format;
+
+        object->SetInt32(-12345);
+
+        SmartFileWriter writer;
+        EXPECT_TRUE(writer.Open(file_path.c_str()));
+        EXPECT_TRUE(writer.SetFormat(format));
+        EXPECT_TRUE(writer.Write(version));
+        EXPECT_TRUE(writer.Write(buffer));
+        writer.WriteObject(object.Get());
+        EXPECT_TRUE(writer.Close());
+
+        uint32_t version_readback{0};
+        std::vector<uint8_t> buffer_readback;
+
+        // the format is detected from the file, the object stream is the same in both formats
+        SmartFileReader reader;
+        EXPECT_TRUE(reader.Open(file_path.c_str()));
+        EXPECT_EQ(static_cast<uint16_t>(reader.GetFormat()), format);
+        EXPECT_TRUE(reader.Read(version_readback));
+        EXPECT_TRUE(reader.Read(buffer_readback));
+        SmartPointer<TestSmartFileObject> object_readback = dynamic_cast<TestSmartFileObject*>(reader.ReadObject());
+        EXPECT_FALSE(reader.Read(version_readback));
+        EXPECT_TRUE(reader.Close());
+
+        EXPECT_EQ(version_readback, version);
+        EXPECT_EQ(buffer_readback, buffer);
+        ASSERT_NE(object_readback.Get(), nullptr);
+        EXPECT_EQ(object_readback->GetInt32(), -12345);
+    }
+
+    // the repetitive buffer shrinks in the compressed format
+    EXPECT_LT(std::filesystem::file_size(file_path), buffer.size() / 4);
+}
+
+TEST_F(SmartFileTest, RejectsDamagedBlocks) {
+    std::vector<uint8_t> buffer(100000, 0x11);
+
+    SmartFileWriter writer;
+    EXPECT_TRUE(writer.Open(file_path.c_str()));
+    EXPECT_TRUE(writer.Write(buffer));
+    EXPECT_TRUE(writer.Close());
+
+    // break the block header
+    {
+        FILE* fp = fopen(file_path.c_str(), "r+b");
+        uint32_t raw_size = UINT32_MAX;
+
+        ASSERT_NE(fp, nullptr);
+        ASSERT_EQ(fseek(fp, sizeof(uint32_t), SEEK_SET), 0);
+        ASSERT_EQ(fwrite(&raw_size, sizeof(raw_size), 1, fp), 1u);
+        fclose(fp);
+    }
+
+    SmartFileReader reader;
+    EXPECT_TRUE(reader.Open(file_path.c_str()));
+    EXPECT_EQ(reader.GetFormat(), SmartFileFormat::V72);
+    EXPECT_FALSE(reader.Read(buffer));
+    EXPECT_TRUE(reader.Close());
+
+    // a truncated file
+    EXPECT_TRUE(writer.Open(file_path.c_str()));
+    EXPECT_TRUE(writer.Write(buffer));
+    EXPECT_TRUE(writer.Close());
+
+    std::filesystem::resize_file(file_path, std::filesystem::file_size(file_path) - 3);
+
+    EXPECT_TRUE(reader.Open(file_path.c_str()));
+    EXPECT_FALSE(reader.Read(buffer));
+    EXPECT_TRUE(reader.Close());
+}
+
+TEST_F(SmartFileTest, TransfersSpans) {
+    const uint16_t formats[] = {static_cast<uint16_t>(SmartFileFormat::V71),
+                                static_cast<uint16_t>(SmartFileFormat::V72)};
+    std::vector<uint32_t> cells(3 * SmartFile_BlockSize / sizeof(uint32_t) + 7);
+    std::vector<uint16_t> small_cells(1000);
+
+    for (size_t i = 0; i < cells.size(); ++i) {
+        cells[i] = static_cast<uint32_t>(i * 2654435761u);
+    }
+
+    for (size_t i = 0; i < small_cells.size(); ++i) {
+        small_cells[i] = static_cast<uint16_t>(i);
+    }
+
+    // spans larger than the stream buffer start and end in the middle of it
+    for (const uint16_t format : formats) {
+        const uint8_t marker = 0x5A;
+
+        SmartFileWriter writer;
+        EXPECT_TRUE(writer.Open(file_path.c_str()));
+        EXPECT_TRUE(writer.SetFormat(format));
+        EXPECT_TRUE(writer.Write(marker));
+        EXPECT_TRUE(writer.WriteSpan(std::span(cells)));
+        EXPECT_TRUE(writer.WriteSpan(std::span(small_cells)));
+        EXPECT_TRUE(writer.WriteSpan(std::span(cells)));
+        EXPECT_TRUE(writer.Write(marker));
+        EXPECT_TRUE(writer.Close());
+
+        std::vector<uint32_t> cells_readback(cells.size());
+        std::vector<uint16_t> small_cells_readback(small_cells.size());
+        uint8_t marker_readback{0};
+
+        SmartFileReader reader;
+        EXPECT_TRUE(reader.Open(file_path.c_str()));
+        EXPECT_TRUE(reader.Read(marker_readback));
+        EXPECT_EQ(marker_readback, marker);
+        EXPECT_TRUE(reader.ReadSpan(std::span(cells_readback)));
+        EXPECT_EQ(cells_readback, cells);
+        EXPECT_TRUE(reader.ReadSpan(std::span(small_cells_readback)));
+        EXPECT_EQ(small_cells_readback, small_cells);
+        cells_readback.assign(cells.size(), 0);
+        EXPECT_TRUE(reader.ReadSpan(std::span(cells_readback)));
+        EXPECT_EQ(cells_readback, cells);
+        marker_readback = 0;
+        EXPECT_TRUE(reader.Read(marker_readback));
+        EXPECT_EQ(marker_readback, marker);
+        EXPECT_FALSE(reader.Read(marker_readback));
+        EXPECT_TRUE(reader.Close());
+    }
+}
+
+TEST_F(SmartFileTest, ReadsMemoryStream) {
+    std::vector<uint8_t> stream;
+    const std::string text{"memory"};
+
+    SmartFileWriter writer;
+    EXPECT_TRUE(writer.Open(stream));
+    EXPECT_TRUE(writer.Write(text));
+    EXPECT_TRUE(writer.Write(uint32_t{77}));
+    EXPECT_TRUE(writer.Close());
+
+    std::string text_readback;
+    uint32_t value_readback{0};
+
+    SmartFileReader reader;
+    EXPECT_TRUE(reader.Open(std::move(stream)));
+    EXPECT_TRUE(reader.Read(text_readback));
+    EXPECT_TRUE(reader.Read(value_readback));
+    EXPECT_FALSE(reader.Read(value_readback));
+    EXPECT_TRUE(reader.Close());
+
+    EXPECT_EQ(text_readback, text);
+    EXPECT_EQ(value_readback, 77u);
+}
+
+TEST_F(SmartFileTest, ReadsFieldByField) {
+    constexpr uint32_t unit_count = 3000;
+    constexpr uint32_t field_count = 64;
+    const uint16_t formats[] = {static_cast<uint16_t>(SmartFileFormat::V71),
+                                static_cast<uint16_t>(SmartFileFormat::V72)};
+
+    // unit objects save dozens of small members each, one call per member, across many stream buffer refills
+    for (const uint16_t format : formats) {
+        SmartFileWriter writer;
+        EXPECT_TRUE(writer.Open(file_path.c_str()));
+        EXPECT_TRUE(writer.SetFormat(format));
+
+        for (uint32_t i = 0; i < unit_count; ++i) {
+            for (uint32_t j = 0; j < field_count; j += 2) {
+                const uint16_t small_field = static_cast<uint16_t>(i + j);
+                const uint32_t large_field = i * j;
+
+                writer.Write(small_field);
+                writer.Write(large_field);
+            }
+        }
+
+        EXPECT_TRUE(writer.Close());
+
+        SmartFileReader reader;
+        uint32_t mismatches = 0;
+
+        EXPECT_TRUE(reader.Open(file_path.c_str()));
+
+        for (uint32_t i = 0; i < unit_count; ++i) {
+            for (uint32_t j = 0; j < field_count; j += 2) {
+                uint16_t small_field;
+                uint32_t large_field;
+
+                reader.Read(small_field);
+                reader.Read(large_field);
+
+                mismatches += (small_field != static_cast<uint16_t>(i + j)) + (large_field != i * j);
+            }
+        }
+
+        uint16_t small_field;
+
+        EXPECT_FALSE(reader.Read(small_field));
+        EXPECT_TRUE(reader.Close());
+        EXPECT_EQ(mismatches, 0u);
+    }
+}
+
+TEST_F(SmartFileTest, ResolvesBackReferences) {
+    constexpr uint32_t object_count = 2000;
+    std::vector<SmartPointer<TestSmartFileObject>> objects;
+
+    for (uint32_t i = 0; i < object_count; ++i) {
+        objects.emplace_back(dynamic_cast<TestSmartFileObject*>(TestSmartFileObject::Allocate()));
+        objects.back()->SetUint32a(i);
+    }
+
+    // every object is written once and then referenced again by index, like units in teams, hash maps and tasks
+    SmartFileWriter writer;
+    EXPECT_TRUE(writer.Open(file_path.c_str()));
+    writer.WriteObjectCount(object_count);
+
+    for (auto& object : objects) {
+        writer.WriteObject(object.Get());
+    }
+
+    writer.WriteObjectCount(object_count);
+
+    for (auto it = objects.rbegin(); it != objects.rend(); ++it) {
+        writer.WriteObject(it->Get());
+    }
+
+    EXPECT_TRUE(writer.Close());
+
+    std::vector<SmartPointer<TestSmartFileObject>> objects_readback;
+    uint32_t mismatches = 0;
+
+    SmartFileReader reader;
+    EXPECT_TRUE(reader.Open(file_path.c_str()));
+    EXPECT_EQ(reader.ReadObjectCount(), object_count);
+
+    for (uint32_t i = 0; i < object_count; ++i) {
+        objects_readback.emplace_back(dynamic_cast<TestSmartFileObject*>(reader.ReadObject()));
+        mismatches += objects_readback.back()->GetUint32a() != i;
+    }
+
+    EXPECT_EQ(reader.ReadObjectCount(), object_count);
+
+    for (uint32_t i = object_count; i > 0; --i) {
+        mismatches += reader.ReadObject() != objects_readback[i - 1].Get();
+    }
+
+    EXPECT_TRUE(reader.Close());
+    EXPECT_EQ(mismatches, 0u);
+
+    // the writer hands the objects back without an index, the reader keeps only the referenced ones
+    EXPECT_EQ(objects.front()->GetIndex(), 0u);
+    EXPECT_EQ(objects.back()->GetIndex(), 0u);
+}
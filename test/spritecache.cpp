@@ -0,0 +1,285 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "spritecache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstring>
+#include <random>
+#include <vector>
+
+struct TestSprite {
+    int32_t width;
+    int32_t height;
+    std::vector<uint8_t> buffer;
+    std::vector<uint32_t> row_offsets;
+};
+
+static TestSprite MakeTestSprite(std::mt19937& random, int32_t width, int32_t height) {
+    TestSprite sprite{width, height, {}, {}};
+
+    for (int32_t y = 0; y < height; ++y) {
+        int32_t x = 0;
+
+        sprite.row_offsets.push_back(static_cast<uint32_t>(sprite.buffer.size()));
+
+        while (x < width) {
+            const int32_t transparent_count = std::min<int32_t>(random() % 24, width - x);
+            const int32_t opaque_count = std::min<int32_t>(random() % 24 + 1, width - x - transparent_count);
+
+            if (opaque_count <= 0) {
+                break;
+            }
+
+            sprite.buffer.push_back(static_cast<uint8_t>(transparent_count));
+            sprite.buffer.push_back(static_cast<uint8_t>(opaque_count));
+
+            for (int32_t i = 0; i < opaque_count; ++i) {
+                sprite.buffer.push_back(static_cast<uint8_t>(random()));
+            }
+
+            x += transparent_count + opaque_count;
+        }
+
+        sprite.buffer.push_back(0xFF);
+    }
+
+    return sprite;
+}
+
+static std::array<uint8_t, 256> MakeTestColorTable(const uint8_t multiplier) {
+    std::array<uint8_t, 256> table;
+
+    for (size_t i = 0; i < table.size(); ++i) {
+        table[i] = static_cast<uint8_t>(i * multiplier + 1);
+    }
+
+    return table;
+}
+
+static uint32_t GetScalingFactor(int32_t size, int32_t scaled_size) {
+    return (((size - 1) << 16) / (scaled_size - 1)) + 8;
+}
+
+/* clipped decoder of Gfx_DecodeSprite() with the global state turned into parameters */
+static void DecodeReference(const SpriteCacheSource& source, int32_t offset_x, int32_t offset_y, int32_t width,
+                            int32_t height, uint8_t* target, int32_t pitch) {
+    int32_t target_offset = 0;
+    int32_t scaled_height = height;
+
+    for (uint32_t row_index = offset_y * source.scaling_factor_height;; row_index += source.scaling_factor_height) {
+        const uint8_t* row = &source.resource_buffer[source.row_offsets[row_index >> 16]];
+        int32_t offset = target_offset;
+        int16_t pixel_count = 0;
+        int16_t column = 0;
+        int16_t hidden = offset_x;
+        int16_t remaining = width;
+        int32_t ebp;
+
+        for (;;) {
+            if (*row == 0xFF) {
+                target_offset += pitch;
+
+                if (!--scaled_height) {
+                    return;
+                }
+
+                break;
+            }
+
+            int32_t temp;
+            const int32_t transparent_count = *row++;
+            const int32_t opaque_count = *row++;
+            const uint8_t* row_address = row;
+
+            row += opaque_count;
+            pixel_count += transparent_count;
+
+            if (pixel_count) {
+                temp = (((pixel_count << 16) / source.scaling_factor_width) + 1) - column;
+                column += temp;
+
+                if (hidden) {
+                    hidden -= temp;
+
+                    if (hidden < 0) {
+                        temp = -hidden;
+                        hidden = 0;
+                        remaining -= temp;
+
+                        if (remaining > 0) {
+                            offset += temp;
+
+                        } else {
+                            target_offset += pitch;
+
+                            if (!--scaled_height) {
+                                return;
+                            }
+
+                            break;
+                        }
+                    }
+
+                } else {
+                    remaining -= temp;
+
+                    if (remaining > 0) {
+                        offset += temp;
+
+                    } else {
+                        target_offset += pitch;
+
+                        if (!--scaled_height) {
+                            return;
+                        }
+
+                        break;
+                    }
+                }
+            }
+
+            row_address -= pixel_count;
+            pixel_count += opaque_count;
+            ebp = column;
+            temp = (((pixel_count << 16) / source.scaling_factor_width) + 1) - ebp;
+            column += temp;
+
+            if (hidden) {
+                hidden -= temp;
+
+                if (hidden >= 0) {
+                    continue;
+                }
+
+                ebp += hidden + temp;
+                temp = -hidden;
+                hidden = 0;
+            }
+
+            remaining -= temp;
+
+            if (remaining < 0) {
+                temp += remaining;
+                remaining = 0;
+            }
+
+            if (temp) {
+                uint8_t* address = &target[offset];
+
+                if (source.team_color) {
+                    memset(address, source.color_table[source.team_color], temp);
+
+                } else {
+                    ebp *= source.scaling_factor_width;
+
+                    for (int32_t i = 0; i < temp; ++i) {
+                        address[i] = source.color_table[source.color_indices[row_address[ebp >> 16]]];
+                        ebp += source.scaling_factor_width;
+                    }
+                }
+
+                offset += temp;
+            }
+        }
+    }
+}
+
+TEST(SpriteCache, MatchesClippedDecode) {
+    std::mt19937 random(7);
+    const auto color_indices = MakeTestColorTable(3);
+    const auto color_table = MakeTestColorTable(5);
+
+    for (int32_t iteration = 0; iteration < 2000; ++iteration) {
+        const TestSprite sprite = MakeTestSprite(random, random() % 120 + 2, random() % 120 + 2);
+        const int32_t scaled_width = random() % 200 + 2;
+        const int32_t scaled_height = random() % 200 + 2;
+        const SpriteCacheSource source{.resource_buffer = sprite.buffer.data(),
+                                       .row_offsets = sprite.row_offsets.data(),
+                                       .scaling_factor_width = GetScalingFactor(sprite.width, scaled_width),
+                                       .scaling_factor_height = GetScalingFactor(sprite.height, scaled_height),
+                                       .scaled_width = static_cast<uint16_t>(scaled_width),
+                                       .scaled_height = static_cast<uint16_t>(scaled_height),
+                                       .color_indices = color_indices.data(),
+                                       .color_table = color_table.data(),
+                                       .team_color = static_cast<uint8_t>((iteration % 4) ? 0 : random() % 256)};
+        const int32_t offset_x = random() % scaled_width;
+        const int32_t offset_y = random() % scaled_height;
+        const int32_t width = random() % (scaled_width - offset_x) + 1;
+        const int32_t height = random() % (scaled_height - offset_y) + 1;
+
+        std::vector<uint8_t> expected(width * height, 0);
+        std::vector<uint8_t> actual(width * height, 0);
+        SpriteCacheFrame frame;
+
+        DecodeReference(source, offset_x, offset_y, width, height, expected.data(), width);
+        SpriteCache_DecodeFrame(source, frame);
+        SpriteCache_Blit(frame, offset_x, offset_y, width, height, actual.data(), width);
+
+        ASSERT_EQ(expected, actual) << "iteration " << iteration;
+    }
+}
+
+TEST(SpriteCache, KeysAndEviction) {
+    std::mt19937 random(11);
+    const auto color_indices = MakeTestColorTable(3);
+    const auto color_table = MakeTestColorTable(5);
+    const TestSprite sprite = MakeTestSprite(random, 64, 64);
+    SpriteCache cache(64 * 1024);
+
+    auto make_source = [&](int32_t scaled_size, uint8_t team_color) {
+        return SpriteCacheSource{.resource_buffer = sprite.buffer.data(),
+                                 .row_offsets = sprite.row_offsets.data(),
+                                 .scaling_factor_width = GetScalingFactor(sprite.width, scaled_size),
+                                 .scaling_factor_height = GetScalingFactor(sprite.height, scaled_size),
+                                 .scaled_width = static_cast<uint16_t>(scaled_size),
+                                 .scaled_height = static_cast<uint16_t>(scaled_size),
+                                 .color_indices = color_indices.data(),
+                                 .color_table = color_table.data(),
+                                 .team_color = team_color};
+    };
+
+    const SpriteCacheFrame* frame = &cache.GetFrame(make_source(32, 0));
+
+    EXPECT_EQ(frame->width, 32);
+    EXPECT_EQ(&cache.GetFrame(make_source(32, 0)), frame);
+    EXPECT_NE(&cache.GetFrame(make_source(33, 0)), frame);
+    EXPECT_NE(&cache.GetFrame(make_source(32, 7)), frame);
+    EXPECT_EQ(cache.GetStatistics().hits, 1u);
+    EXPECT_EQ(cache.GetStatistics().misses, 3u);
+    EXPECT_EQ(cache.GetFrameCount(), 3u);
+
+    // large frames push the budget and evict the least recently used ones first
+    for (int32_t scaled_size = 100; scaled_size < 140; ++scaled_size) {
+        (void)cache.GetFrame(make_source(scaled_size, 0));
+
+        EXPECT_LE(cache.GetByteCount(), 64u * 1024u);
+    }
+
+    EXPECT_GT(cache.GetStatistics().evictions, 0u);
+
+    cache.Invalidate();
+
+    EXPECT_EQ(cache.GetFrameCount(), 0u);
+    EXPECT_EQ(cache.GetByteCount(), 0u);
+}
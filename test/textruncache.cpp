@@ -0,0 +1,94 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "textruncache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "textrunreference.hpp"
+
+TEST(TextRunCache, RenderMatchesGlyphLoop) {
+    constexpr int32_t pitch = 400;
+    constexpr int32_t height = 24;
+    constexpr int32_t origin = 2 * pitch + 2;
+
+    const TestFont font = MakeTestFont(7);
+
+    for (uint32_t i = 0; i < 300; ++i) {
+        const std::string text = MakeTestString(i, i % 40);
+        const int32_t swidth = (i % 3) ? 1000 : static_cast<int32_t>(i % 200);
+        std::vector<uint8_t> expected(pitch * height, 0);
+        std::vector<uint8_t> actual(pitch * height, 0);
+
+        const int32_t width = ReferenceBlit(font, text, &expected[origin], swidth, pitch, 0x55);
+        const TextRun run = RenderTestRun(font, text, swidth);
+
+        TextRun_Blit(run, &actual[origin], pitch, 0x55);
+
+        ASSERT_EQ(run.advance, width) << text;
+        ASSERT_EQ(expected, actual) << text << " " << swidth;
+    }
+}
+
+TEST(TextRunCache, LookupAndEviction) {
+    const TestFont font = MakeTestFont(3);
+    TextRunCache cache(4096);
+
+    EXPECT_EQ(cache.Find(1, 100, "abc"), nullptr);
+
+    const TextRun& run = cache.Insert(1, 100, "abc", RenderTestRun(font, "abc", 100));
+    const size_t span_count = run.spans.size();
+
+    ASSERT_NE(cache.Find(1, 100, "abc"), nullptr);
+    EXPECT_EQ(cache.Find(1, 100, "abc")->spans.size(), span_count);
+
+    // the font, the width limit and the text are all part of the key
+    EXPECT_EQ(cache.Find(2, 100, "abc"), nullptr);
+    EXPECT_EQ(cache.Find(1, 99, "abc"), nullptr);
+    EXPECT_EQ(cache.Find(1, 100, "abd"), nullptr);
+
+    EXPECT_EQ(cache.GetStatistics().hits, 2u);
+    EXPECT_EQ(cache.GetStatistics().misses, 4u);
+
+    for (uint32_t i = 0; i < 200; ++i) {
+        const std::string text = MakeTestString(i, 20);
+
+        cache.Insert(1, 100, text, RenderTestRun(font, text, 100));
+
+        EXPECT_LE(cache.GetByteCount(), 4096u);
+    }
+
+    EXPECT_GT(cache.GetStatistics().evictions, 0u);
+    EXPECT_EQ(cache.Find(1, 100, "abc"), nullptr);
+
+    // the most recently used run survives
+    const std::string recent = MakeTestString(199, 20);
+
+    EXPECT_NE(cache.Find(1, 100, recent), nullptr);
+
+    cache.Invalidate();
+
+    EXPECT_EQ(cache.GetRunCount(), 0u);
+    EXPECT_EQ(cache.GetByteCount(), 0u);
+}
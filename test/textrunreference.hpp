@@ -0,0 +1,136 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef TEXTRUNREFERENCE_HPP
+#define TEXTRUNREFERENCE_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "textruncache.hpp"
+
+struct TestFont {
+    std::vector<std::vector<uint8_t>> bitmaps;
+    std::vector<TextRunGlyph> glyphs;
+};
+
+inline TestFont MakeTestFont(uint32_t seed) {
+    TestFont font;
+
+    font.bitmaps.resize(128);
+    font.glyphs.resize(128);
+
+    for (uint32_t i = 0; i < font.glyphs.size(); ++i) {
+        seed = seed * 1103515245u + 12345u;
+
+        TextRunGlyph& glyph = font.glyphs[i];
+        const bool blank = (seed >> 20) % 8 == 0;
+
+        glyph.width = blank ? 0 : 1 + (seed >> 8) % 12;
+        glyph.height = blank ? 0 : 1 + (seed >> 12) % 14;
+        glyph.pitch = (glyph.width + 7) / 8;
+        glyph.ulx = static_cast<int16_t>((seed >> 16) % 4) - 1;
+        glyph.uly = static_cast<int16_t>((seed >> 18) % 5) - 1;
+        glyph.advance = glyph.width + (seed >> 24) % 3;
+
+        auto& bitmap = font.bitmaps[i];
+
+        bitmap.resize(glyph.pitch * glyph.height);
+
+        for (auto& byte : bitmap) {
+            seed = seed * 1103515245u + 12345u;
+            byte = static_cast<uint8_t>(seed >> 16);
+        }
+
+        glyph.bitmap = bitmap.data();
+    }
+
+    return font;
+}
+
+/* the glyph loop of the former Text_BlitTTF() */
+inline int32_t ReferenceBlit(const TestFont& font, const std::string& text, uint8_t* buf, int32_t swidth,
+                             int32_t fullw, uint8_t color) {
+    uint8_t* const bstart = buf;
+
+    for (const char c : text) {
+        const TextRunGlyph& glyph = font.glyphs[static_cast<uint8_t>(c) & 0x7F];
+        const int32_t offset = fullw * glyph.uly + glyph.ulx;
+        uint8_t* const bnext = &buf[glyph.advance];
+
+        if (glyph.width && glyph.height) {
+            if ((intptr_t)(bnext - bstart) > swidth) {
+                break;
+            }
+
+            for (int32_t h = 0; h < glyph.height; ++h) {
+                uint8_t mask = 0x80;
+                const uint8_t* data = &glyph.bitmap[glyph.pitch * h];
+
+                for (int32_t w = 0; w < glyph.width; ++w, ++buf) {
+                    if (!mask) {
+                        mask = 0x80;
+                        ++data;
+                    }
+
+                    if (mask & *data) {
+                        buf[offset] = color;
+                    }
+
+                    mask >>= 1;
+                }
+
+                buf += fullw - glyph.width;
+            }
+        }
+
+        buf = bnext;
+    }
+
+    return static_cast<int32_t>(buf - bstart);
+}
+
+inline TextRun RenderTestRun(const TestFont& font, const std::string& text, int32_t swidth) {
+    std::vector<TextRunGlyph> glyphs;
+    TextRun run;
+
+    for (const char c : text) {
+        glyphs.push_back(font.glyphs[static_cast<uint8_t>(c) & 0x7F]);
+    }
+
+    TextRun_Render(glyphs.data(), glyphs.size(), swidth, run);
+
+    return run;
+}
+
+inline std::string MakeTestString(uint32_t seed, size_t length) {
+    std::string text;
+
+    for (size_t i = 0; i < length; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        text.push_back(static_cast<char>(32 + (seed >> 16) % 90));
+    }
+
+    return text;
+}
+
+#endif /* TEXTRUNREFERENCE_HPP */
@@ -0,0 +1,55 @@
+/* Copyright (c) 2026 M.A.X. Port Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "visibilitybitset.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(VisibilityBitset, SetReset) {
+    VisibilityBitset bitset(112 * 112);
+
+    EXPECT_EQ(bitset.GetCellCount(), 112 * 112);
+    EXPECT_EQ(bitset.GetWordCount(), (112 * 112 + 63) / 64);
+    EXPECT_EQ(bitset.Count(), 0);
+
+    bitset.Set(0);
+    bitset.Set(63);
+    bitset.Set(64);
+    bitset.Set(112 * 112 - 1);
+
+    EXPECT_TRUE(bitset.Test(0));
+    EXPECT_TRUE(bitset.Test(63));
+    EXPECT_TRUE(bitset.Test(64));
+    EXPECT_TRUE(bitset.Test(112 * 112 - 1));
+    EXPECT_FALSE(bitset.Test(1));
+    EXPECT_FALSE(bitset.Test(65));
+    EXPECT_EQ(bitset.Count(), 4);
+
+    bitset.Reset(63);
+
+    EXPECT_FALSE(bitset.Test(63));
+    EXPECT_TRUE(bitset.Test(64));
+    EXPECT_EQ(bitset.Count(), 3);
+
+    bitset.Clear();
+
+    EXPECT_EQ(bitset.Count(), 0);
+}